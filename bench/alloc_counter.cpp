@@ -0,0 +1,99 @@
+#include <atomic>   // For std::atomic
+#include <cstdlib>  // For std::malloc, std::aligned_alloc, std::free
+#include <new>      // For std::bad_alloc, std::align_val_t, std::nothrow_t
+
+#if defined(__GLIBC__)
+# include <malloc.h> // For malloc_usable_size
+#endif
+
+#include "alloc_counter.h"
+
+namespace {
+
+  std::atomic<bool>           g_enabled{ false };
+  std::atomic<std::ptrdiff_t> g_live{ 0 };
+
+  inline void
+  count(void* p, std::ptrdiff_t sign) noexcept
+  {
+#if defined(__GLIBC__)
+    if ( p != nullptr && g_enabled.load(std::memory_order_relaxed) )
+      g_live.fetch_add(sign * std::ptrdiff_t(malloc_usable_size(p)), std::memory_order_relaxed);
+#else
+    (void)p;
+    (void)sign;
+#endif
+  }
+
+  void*
+  allocate(std::size_t size, std::size_t alignment) noexcept
+  {
+    void* p;
+
+    if ( size == 0 ) size = 1;
+    if ( alignment <= alignof(std::max_align_t) ) p = std::malloc(size);
+    else p = std::aligned_alloc(alignment, ( size + alignment - 1 ) / alignment * alignment);
+    count(p, 1);
+    return p;
+  }
+
+  void*
+  allocate_or_throw(std::size_t size, std::size_t alignment)
+  {
+    void* p = allocate(size, alignment);
+
+    if ( p == nullptr ) throw std::bad_alloc();
+    return p;
+  }
+
+  void
+  deallocate(void* p) noexcept
+  {
+    count(p, -1);
+    std::free(p);
+  }
+
+} // namespace
+
+namespace bench {
+  namespace alloc_counter {
+
+    bool
+    supported() noexcept
+    {
+#if defined(__GLIBC__)
+      return true;
+#else
+      return false;
+#endif
+    }
+
+    void
+    enable(bool on) noexcept { g_enabled.store(on, std::memory_order_relaxed); }
+
+    std::ptrdiff_t
+    live_bytes() noexcept { return g_live.load(std::memory_order_relaxed); }
+
+  } // namespace alloc_counter
+} // namespace bench
+
+// A block allocated while counting was off and freed while it is on is subtracted without
+// having been added; the builds that are measured allocate and free nothing else.
+
+void* operator new(std::size_t size) { return allocate_or_throw(size, alignof(std::max_align_t)); }
+void* operator new[](std::size_t size) { return allocate_or_throw(size, alignof(std::max_align_t)); }
+void* operator new(std::size_t size, std::align_val_t al) { return allocate_or_throw(size, std::size_t(al)); }
+void* operator new[](std::size_t size, std::align_val_t al) { return allocate_or_throw(size, std::size_t(al)); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return allocate(size, alignof(std::max_align_t)); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return allocate(size, alignof(std::max_align_t)); }
+
+void operator delete(void* p) noexcept { deallocate(p); }
+void operator delete[](void* p) noexcept { deallocate(p); }
+void operator delete(void* p, std::size_t) noexcept { deallocate(p); }
+void operator delete[](void* p, std::size_t) noexcept { deallocate(p); }
+void operator delete(void* p, std::align_val_t) noexcept { deallocate(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { deallocate(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { deallocate(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { deallocate(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { deallocate(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { deallocate(p); }
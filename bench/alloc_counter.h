@@ -0,0 +1,47 @@
+#ifndef   __FT_BENCH_ALLOC_COUNTER__
+# define  __FT_BENCH_ALLOC_COUNTER__
+
+# include <cstddef> // For std::ptrdiff_t
+
+namespace bench {
+
+  /// @brief Heap accounting through the replaced global `operator new` and `operator delete`.
+  /// @details While counting is on, every allocation adds the usable size of its block and
+  /// every deallocation subtracts it, so the live byte count includes the rounding of the
+  /// system allocator but not its headers. Counting is off by default and is switched on
+  /// only around untimed builds, so the measured operations pay one relaxed load per
+  /// allocation. Only available with glibc, which reports usable sizes.
+  namespace alloc_counter {
+
+    /// @brief Whether the heap can be measured on this platform.
+    bool supported() noexcept;
+
+    /// @brief Start or stop counting.
+    void enable(bool on) noexcept;
+
+    /// @brief The bytes allocated and not yet freed while counting was on.
+    std::ptrdiff_t live_bytes() noexcept;
+
+  } // namespace alloc_counter
+
+  /// @brief Count the heap bytes allocated in a scope that are still live at its end.
+  class alloc_scope
+  {
+    public:
+      alloc_scope() noexcept : m_start{ alloc_counter::live_bytes() } { alloc_counter::enable(true); }
+      ~alloc_scope() { alloc_counter::enable(false); }
+
+      alloc_scope(const alloc_scope&) = delete;
+      alloc_scope& operator=(const alloc_scope&) = delete;
+
+      /// @brief The bytes allocated since construction and still live.
+      std::ptrdiff_t
+      bytes() const noexcept { return alloc_counter::live_bytes() - m_start; }
+
+    private:
+      std::ptrdiff_t m_start; ///< The live byte count at construction.
+  };
+
+} // namespace bench
+
+#endif // __FT_BENCH_ALLOC_COUNTER__
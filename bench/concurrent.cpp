@@ -0,0 +1,156 @@
+#include <atomic>       // For std::atomic
+#include <chrono>       // For std::chrono::steady_clock
+#include <cstddef>      // For std::size_t
+#include <cstdint>      // For std::uint64_t
+#include <map>          // For std::map
+#include <mutex>        // For std::unique_lock
+#include <random>       // For std::mt19937_64
+#include <shared_mutex> // For std::shared_mutex, std::shared_lock
+#include <string>       // For std::string, std::to_string
+#include <thread>       // For std::thread
+#include <vector>       // For std::vector
+
+#include "map/concurrent_map.h"
+
+#include "harness.h"
+#include "workload.h"
+
+namespace bench {
+  namespace {
+
+    using key = std::uint64_t;
+
+    constexpr std::size_t query_block = 1 << 16; ///< The lookups each reader cycles through, precomputed.
+    constexpr std::size_t batch       = 64;      ///< The lookups between two checks of the stop flag.
+
+    /// @brief `ft::concurrent_map`: lock-free readers, one copy-on-write writer.
+    struct ft_concurrent
+    {
+      ft::concurrent_map<key, key> m_map;
+
+      bool
+      contains(key k) const { return m_map.contains(k); }
+
+      void
+      update(key k, key v) { m_map.insert_or_assign(k, v); }
+    };
+
+    /// @brief The usual baseline: a `std::map` behind a reader-writer lock.
+    struct std_locked
+    {
+      std::map<key, key>        m_map;
+      mutable std::shared_mutex m_mutex;
+
+      bool
+      contains(key k) const
+      {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        return m_map.find(k) != m_map.end();
+      }
+
+      void
+      update(key k, key v)
+      {
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        m_map[k] = v;
+      }
+    };
+
+    /// @brief Measure `threads` readers looking up random keys of map for the minimum time,
+    /// optionally while one more thread updates random keys.
+    /// @return The total lookups per second, and the mean time per lookup of one reader.
+    template <typename Map>
+    result
+    run_readers(const options& opts, Map& map, const std::vector<key>& keys, unsigned threads, bool writer, std::string name)
+    {
+      std::atomic<bool>          go{ false };
+      std::atomic<bool>          stop{ false };
+      std::vector<std::uint64_t> counts(threads, 0);
+      std::vector<std::thread>   pool;
+
+      for ( unsigned t = 0; t < threads; ++t ) {
+        pool.emplace_back([&, t]() {
+          std::mt19937_64   rng(t + 1);
+          std::vector<key>  queries(query_block);
+          std::uint64_t     done = 0;
+          std::size_t       hits = 0;
+          std::size_t       i    = 0;
+
+          for ( key& q : queries ) q = keys[rng() % keys.size()];
+          while ( !go.load(std::memory_order_acquire) ) { }
+          while ( !stop.load(std::memory_order_relaxed) ) {
+            for ( std::size_t j = 0; j < batch; ++j, i = ( i + 1 ) % query_block ) hits += map.contains(queries[i]);
+            done += batch;
+          }
+          do_not_optimize(hits);
+          counts[t] = done;
+        });
+      }
+
+      std::thread updater;
+      if ( writer ) {
+        updater = std::thread([&]() {
+          std::mt19937_64 rng(0);
+
+          while ( !go.load(std::memory_order_acquire) ) { }
+          for ( key v = 0; !stop.load(std::memory_order_relaxed); ++v ) map.update(keys[rng() % keys.size()], v);
+        });
+      }
+
+      const auto start = std::chrono::steady_clock::now();
+      go.store(true, std::memory_order_release);
+      std::this_thread::sleep_for(std::chrono::duration<double>(opts.minTime));
+      stop.store(true, std::memory_order_relaxed);
+      for ( std::thread& t : pool ) t.join();
+      const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+      if ( updater.joinable() ) updater.join();
+
+      std::uint64_t total = 0;
+      for ( std::uint64_t c : counts ) total += c;
+
+      result r;
+      r.name          = std::move(name);
+      r.nsPerOp       = ns * threads / double(total);
+      r.mopsPerSecond = double(total) / ns * 1e3;
+      return r;
+    }
+
+    template <typename Map>
+    void
+    run_scaling(const options& opts, reporter& out, const char* mname, const std::vector<key>& keys)
+    {
+      const std::string size = std::to_string(keys.size());
+      Map               map;
+      bool              built = false;
+
+      for ( bool writer : { false, true } ) {
+        for ( unsigned threads : opts.threads ) {
+          const std::string name = std::string(writer ? "read_1writer/" : "read/") + mname
+                                 + "/threads:" + std::to_string(threads) + "/" + size;
+
+          if ( threads == 0 || !selected(opts, name) ) continue;
+          if ( !built ) {
+            for ( key k : keys ) map.update(k, k);
+            built = true;
+          }
+          out.report(run_readers(opts, map, keys, threads, writer, name));
+        }
+      }
+    }
+
+  } // namespace
+
+  void
+  run_concurrent_benchmarks(const options& opts, reporter& out)
+  {
+    std::vector<key> keys;
+
+    if ( opts.concurrentSize == 0 ) return;
+    keys.reserve(opts.concurrentSize);
+    for ( std::size_t i = 0; i < opts.concurrentSize; ++i ) keys.push_back(mix(i));
+
+    run_scaling<ft_concurrent>(opts, out, "ft::concurrent_map", keys);
+    run_scaling<std_locked>(opts, out, "std::map+shared_mutex", keys);
+  }
+
+} // namespace bench
@@ -0,0 +1,283 @@
+#include <cstddef>       // For std::size_t
+#include <cstdint>       // For std::uint64_t
+#include <functional>    // For std::hash
+#include <map>           // For std::map
+#include <memory>        // For std::unique_ptr
+#include <set>           // For std::set
+#include <string>        // For std::string, std::to_string
+#include <type_traits>   // For std::true_type, std::false_type, std::void_t
+#include <unordered_map> // For std::unordered_map
+#include <unordered_set> // For std::unordered_set
+#include <utility>       // For std::move
+#include <vector>        // For std::vector
+
+#include "map/btree_map.h"
+#include "map/flat_map.h"
+#include "map/map.h"
+#include "map/multimap.h"
+#include "map/persistent_map.h"
+#include "map/unordered_map.h"
+#include "set/btree_set.h"
+#include "set/flat_set.h"
+#include "set/multiset.h"
+#include "set/persistent_set.h"
+#include "set/set.h"
+#include "set/unordered_set.h"
+
+#include "alloc_counter.h"
+#include "harness.h"
+#include "workload.h"
+
+namespace bench {
+  namespace {
+
+    using mapped = std::uint64_t; ///< The mapped type of every map benchmark.
+
+    constexpr std::size_t scan_length = 32;     ///< The elements visited by one range scan.
+    constexpr std::size_t max_scans   = 100000; ///< The range scans per measured call.
+    constexpr std::size_t moves       = 1000;   ///< The moves per measured call.
+
+    template <typename C, typename = void>
+    struct is_map : std::false_type { };
+
+    template <typename C>
+    struct is_map<C, std::void_t<typename C::mapped_type>> : std::true_type { };
+
+    /// @brief Whether C keeps its elements in sorted arrays, inserting and erasing in O(n).
+    template <typename C>
+    struct is_flat : std::false_type { };
+
+    template <typename K, typename T>
+    struct is_flat<ft::flat_map<K, T>> : std::true_type { };
+
+    template <typename K>
+    struct is_flat<ft::flat_set<K>> : std::true_type { };
+
+    /// @brief Whether C is sorted and has `lower_bound`, which the range scans need.
+    template <typename C, typename = void>
+    struct is_ordered : std::false_type { };
+
+    template <typename C>
+    struct is_ordered<C, std::void_t<typename C::key_compare>> : std::true_type { };
+
+    /// @brief The hash of the keys of the hash containers.
+    struct key_hash
+    {
+      std::size_t operator()(int k) const noexcept { return std::hash<int>()(k); }
+      std::size_t operator()(const std::string& k) const noexcept { return std::hash<std::string>()(k); }
+      std::size_t operator()(const record64& k) const noexcept { return std::hash<std::uint64_t>()(k.key); }
+    };
+
+    template <typename C, typename K>
+    typename C::value_type
+    make_value(const K& k, std::true_type) { return typename C::value_type(k, mapped(0)); }
+
+    template <typename C, typename K>
+    typename C::value_type
+    make_value(const K& k, std::false_type) { return k; }
+
+    template <typename It>
+    std::uint64_t
+    digest(It it, std::true_type) { return key_digest(it->first); }
+
+    template <typename It>
+    std::uint64_t
+    digest(It it, std::false_type) { return key_digest(*it); }
+
+    /// @brief Sum the digests of up to `scan_length` elements from the first not less than k.
+    template <typename C, typename K, typename MapTag>
+    std::uint64_t
+    scan_from(const C& c, const K& k, MapTag map_tag, std::true_type)
+    {
+      std::uint64_t sum = 0;
+      auto          it  = c.lower_bound(k);
+
+      for ( std::size_t j = 0; j < scan_length && it != c.end(); ++j, ++it ) sum += digest(it, map_tag);
+      return sum;
+    }
+
+    /// @brief Unordered containers have no range scans; never called, see `run_fixture`.
+    template <typename C, typename K, typename MapTag>
+    std::uint64_t
+    scan_from(const C&, const K&, MapTag, std::false_type) { return 0; }
+
+    /// @brief Run the benchmarks of container C over one workload.
+    /// @details The reference container is built once, untimed, while the heap is counted;
+    /// the read benchmarks run on it, `insert` builds fresh containers and `erase` empties
+    /// copies of it. Flat containers skip `insert` and `erase` above `options::flatLimit`,
+    /// where one-by-one updates of a sorted array take quadratic time.
+    template <typename C, typename GetWorkload>
+    void
+    run_fixture(const options& opts, reporter& out, perf_counters& counters, const char* cname,
+                const char* kname, order o, std::size_t n, GetWorkload& get)
+    {
+      using K       = typename C::key_type;
+      using map_tag = is_map<C>;
+
+      const std::string suffix  = std::string("/") + cname + "/" + kname + "/" + order_name(o) + "/" + std::to_string(n);
+      const bool        updates = !is_flat<C>::value || n <= opts.flatLimit;
+      const bool        insert  = updates && selected(opts, "insert" + suffix);
+      const bool        erase   = updates && selected(opts, "erase" + suffix);
+      const bool        find    = selected(opts, "find" + suffix);
+      const bool        iterate = selected(opts, "iterate" + suffix);
+      const bool        scan    = is_ordered<C>::value && selected(opts, "range_scan" + suffix);
+      const bool        copy    = selected(opts, "copy" + suffix);
+      const bool        move    = selected(opts, "move" + suffix);
+
+      if ( !( insert || erase || find || iterate || scan || copy || move ) ) return;
+
+      const workload<K>&                  w = get();
+      std::vector<typename C::value_type> values;
+      std::ptrdiff_t                      heapBytes = 0;
+
+      values.reserve(n);
+      for ( const K& k : w.build ) values.push_back(make_value<C>(k, map_tag()));
+
+      C ref = [&]() {
+        alloc_scope heap;
+        C           c(values.begin(), values.end());
+
+        heapBytes = heap.bytes();
+        return c;
+      }();
+      const double bytesPerElem = alloc_counter::supported() ? double(heapBytes) / double(n) : -1;
+
+      auto emit = [&](result r) {
+        r.bytesPerElem = bytesPerElem;
+        out.report(r);
+      };
+
+      if ( insert ) {
+        std::vector<typename C::value_type> inserted;
+
+        inserted.reserve(n);
+        for ( const K& k : w.ops ) inserted.push_back(make_value<C>(k, map_tag()));
+        emit(measure(opts, counters, "insert" + suffix, n, [&](timer& t) {
+          C c;
+
+          t.start();
+          for ( const typename C::value_type& v : inserted ) c.insert(v);
+          t.stop();
+          do_not_optimize(c.size());
+        }));
+      }
+      if ( find ) {
+        const C& c = ref;
+
+        emit(measure(opts, counters, "find" + suffix, n, [&](timer& t) {
+          std::size_t hits = 0;
+
+          t.start();
+          for ( const K& k : w.ops ) hits += c.find(k) != c.end();
+          t.stop();
+          do_not_optimize(hits);
+        }));
+      }
+      if ( iterate ) {
+        const C& c = ref;
+
+        emit(measure(opts, counters, "iterate" + suffix, c.size(), [&](timer& t) {
+          std::uint64_t sum = 0;
+
+          t.start();
+          for ( auto it = c.begin(); it != c.end(); ++it ) sum += digest(it, map_tag());
+          t.stop();
+          do_not_optimize(sum);
+        }));
+      }
+      if ( scan ) {
+        const C&          c     = ref;
+        const std::size_t scans = n < max_scans ? n : max_scans;
+
+        emit(measure(opts, counters, "range_scan" + suffix, scans, [&](timer& t) {
+          std::uint64_t sum = 0;
+
+          t.start();
+          for ( std::size_t i = 0; i < scans; ++i ) {
+            sum += scan_from(c, w.ops[i], map_tag(), is_ordered<C>());
+          }
+          t.stop();
+          do_not_optimize(sum);
+        }));
+      }
+      if ( copy ) {
+        emit(measure(opts, counters, "copy" + suffix, ref.size(), [&](timer& t) {
+          t.start();
+          C c(ref);
+          t.stop();
+          do_not_optimize(c.size());
+        }));
+      }
+      if ( move ) {
+        emit(measure(opts, counters, "move" + suffix, moves, [&](timer& t) {
+          t.start();
+          for ( std::size_t i = 0; i < moves / 2; ++i ) {
+            C c(std::move(ref));
+            do_not_optimize(&c);
+            ref = std::move(c);
+            do_not_optimize(&ref);
+          }
+          t.stop();
+          do_not_optimize(ref.size());
+        }));
+      }
+      if ( erase ) {
+        emit(measure(opts, counters, "erase" + suffix, n, [&](timer& t) {
+          C c(ref);
+
+          t.start();
+          for ( const K& k : w.ops ) c.erase(k);
+          t.stop();
+          do_not_optimize(c.size());
+        }));
+      }
+    }
+
+    /// @brief Run every container over the keys of type K in order o, building the
+    /// workload only if some benchmark of it is selected.
+    template <typename K>
+    void
+    run_key(const options& opts, reporter& out, perf_counters& counters, const char* kname, order o, std::size_t n)
+    {
+      std::unique_ptr<workload<K>> w;
+      auto                         get = [&]() -> const workload<K>& {
+        if ( !w ) w.reset(new workload<K>(make_workload<K>(n, o)));
+        return *w;
+      };
+
+      run_fixture<std::map<K, mapped>>(opts, out, counters, "std::map", kname, o, n, get);
+      run_fixture<ft::map<K, mapped>>(opts, out, counters, "ft::map", kname, o, n, get);
+      run_fixture<ft::multimap<K, mapped>>(opts, out, counters, "ft::multimap", kname, o, n, get);
+      run_fixture<ft::btree_map<K, mapped>>(opts, out, counters, "ft::btree_map", kname, o, n, get);
+      run_fixture<ft::flat_map<K, mapped>>(opts, out, counters, "ft::flat_map", kname, o, n, get);
+      run_fixture<ft::persistent_map<K, mapped>>(opts, out, counters, "ft::persistent_map", kname, o, n, get);
+      run_fixture<std::unordered_map<K, mapped, key_hash>>(opts, out, counters, "std::unordered_map", kname, o, n, get);
+      run_fixture<ft::unordered_map<K, mapped, key_hash>>(opts, out, counters, "ft::unordered_map", kname, o, n, get);
+      run_fixture<ft::node_unordered_map<K, mapped, key_hash>>(opts, out, counters, "ft::node_unordered_map", kname, o, n, get);
+      run_fixture<std::set<K>>(opts, out, counters, "std::set", kname, o, n, get);
+      run_fixture<ft::set<K>>(opts, out, counters, "ft::set", kname, o, n, get);
+      run_fixture<ft::multiset<K>>(opts, out, counters, "ft::multiset", kname, o, n, get);
+      run_fixture<ft::btree_set<K>>(opts, out, counters, "ft::btree_set", kname, o, n, get);
+      run_fixture<ft::flat_set<K>>(opts, out, counters, "ft::flat_set", kname, o, n, get);
+      run_fixture<ft::persistent_set<K>>(opts, out, counters, "ft::persistent_set", kname, o, n, get);
+      run_fixture<std::unordered_set<K, key_hash>>(opts, out, counters, "std::unordered_set", kname, o, n, get);
+      run_fixture<ft::unordered_set<K, key_hash>>(opts, out, counters, "ft::unordered_set", kname, o, n, get);
+    }
+
+  } // namespace
+
+  void
+  run_container_benchmarks(const options& opts, reporter& out)
+  {
+    perf_counters counters;
+
+    for ( std::size_t n : opts.sizes ) {
+      for ( order o : { order::sorted, order::random, order::zipf } ) {
+        run_key<int>(opts, out, counters, "int", o, n);
+        run_key<std::string>(opts, out, counters, "string", o, n);
+        run_key<record64>(opts, out, counters, "record64", o, n);
+      }
+    }
+  }
+
+} // namespace bench
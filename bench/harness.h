@@ -0,0 +1,166 @@
+#ifndef   __FT_BENCH_HARNESS__
+# define  __FT_BENCH_HARNESS__
+
+# include <chrono>    // For std::chrono::steady_clock
+# include <cstddef>   // For std::size_t
+# include <cstdint>   // For std::uint64_t
+# include <cstdio>    // For std::printf, std::fflush
+# include <regex>     // For std::regex, std::regex_search
+# include <string>    // For std::string
+# include <utility>   // For std::move
+# include <vector>    // For std::vector
+
+# include "perf_counters.h" // For perf_counters
+
+namespace bench {
+
+  /// @brief Command line settings shared by every benchmark.
+  struct options
+  {
+    std::regex               filter{ "." };                                   ///< Only benchmarks whose name matches run.
+    std::vector<std::size_t> sizes{ 1000, 10000, 100000, 1000000 };           ///< The element counts of the container benchmarks.
+    std::vector<unsigned>    threads{ 1, 2, 4, 8, 16, 32, 64 };               ///< The reader counts of the concurrent benchmarks.
+    std::size_t              concurrentSize = 1000000;                        ///< The element count of the concurrent benchmarks.
+    std::size_t              flatLimit      = 100000;                         ///< The largest size at which flat containers insert and erase one by one.
+    double                   minTime        = 0.1;                            ///< The least measured time per benchmark, in seconds.
+    bool                     csv            = false;                          ///< Print comma separated values instead of a table.
+  };
+
+  /// @brief One line of output. Negative fields are not available and print as "-".
+  struct result
+  {
+    std::string name;                 ///< The benchmark name, `op/container/key/order/size`.
+    double      nsPerOp       = -1;   ///< Mean wall time per operation, in nanoseconds.
+    double      mopsPerSecond = -1;   ///< Operations per second over all threads, in millions.
+    double      bytesPerElem  = -1;   ///< Heap bytes held by the container per element.
+    double      llcMissPerOp  = -1;   ///< Last level cache misses per operation.
+    double      l1dMissPerOp  = -1;   ///< L1 data cache read misses per operation.
+  };
+
+  /// @brief Print results as an aligned table or as CSV.
+  class reporter
+  {
+    public:
+      explicit
+      reporter(bool csv) : m_csv{ csv }, m_header{ false } { }
+
+      void
+      report(const result& r)
+      {
+        if ( !m_header ) {
+          if ( m_csv ) std::printf("name,ns_per_op,mops_per_s,bytes_per_elem,llc_miss_per_op,l1d_miss_per_op\n");
+          else std::printf("%-56s %12s %10s %11s %10s %10s\n", "benchmark", "ns/op", "Mops/s", "bytes/elem", "LLC/op", "L1D/op");
+          m_header = true;
+        }
+        if ( m_csv ) {
+          std::printf("%s,%s,%s,%s,%s,%s\n", r.name.c_str(), __field(r.nsPerOp, "").c_str(),
+                      __field(r.mopsPerSecond, "").c_str(), __field(r.bytesPerElem, "").c_str(),
+                      __field(r.llcMissPerOp, "").c_str(), __field(r.l1dMissPerOp, "").c_str());
+        }
+        else {
+          std::printf("%-56s %12s %10s %11s %10s %10s\n", r.name.c_str(), __field(r.nsPerOp, "-").c_str(),
+                      __field(r.mopsPerSecond, "-").c_str(), __field(r.bytesPerElem, "-").c_str(),
+                      __field(r.llcMissPerOp, "-").c_str(), __field(r.l1dMissPerOp, "-").c_str());
+        }
+        std::fflush(stdout);
+      }
+
+    private:
+      static std::string
+      __field(double v, const char* missing)
+      {
+        char buf[32];
+
+        if ( v < 0 ) return missing;
+        std::snprintf(buf, sizeof(buf), v < 10 ? "%.3f" : v < 1000 ? "%.1f" : "%.0f", v);
+        return buf;
+      }
+
+    private:
+      bool m_csv;    ///< Whether to print CSV.
+      bool m_header; ///< Whether the header was printed.
+  };
+
+  /// @brief Keep the compiler from discarding a computed value.
+  template <typename T>
+  inline void
+  do_not_optimize(const T& value)
+  {
+    asm volatile("" : : "r,m"(value) : "memory");
+  }
+
+  /// @brief Accumulates the time and cache misses of the measured regions of a benchmark.
+  class timer
+  {
+    public:
+      explicit
+      timer(perf_counters& counters) : m_counters{ counters }, m_ns{ 0 }, m_start{ } { }
+
+      void
+      start()
+      {
+        m_counters.start();
+        m_start = std::chrono::steady_clock::now();
+      }
+
+      void
+      stop()
+      {
+        const auto end = std::chrono::steady_clock::now();
+
+        m_counters.stop();
+        m_ns += std::chrono::duration<double, std::nano>(end - m_start).count();
+      }
+
+      double
+      elapsed_ns() const noexcept { return m_ns; }
+
+    private:
+      perf_counters&                        m_counters; ///< The cache miss counters, run only while timing.
+      double                                m_ns;       ///< The accumulated time.
+      std::chrono::steady_clock::time_point m_start;    ///< The start of the current region.
+  };
+
+  /// @brief Run `body(timer&)` until its measured regions add up to the minimum time, and
+  /// report the time and misses per operation.
+  /// @details Each call of body performs `opsPerCall` operations and brackets them with
+  /// `timer::start` and `timer::stop`, leaving its setup and teardown out of the
+  /// measurement. It is called at least once and at most 1000 times.
+  template <typename Body>
+  inline result
+  measure(const options& opts, perf_counters& counters, std::string name, std::size_t opsPerCall, Body&& body)
+  {
+    timer       t(counters);
+    std::size_t calls = 0;
+
+    counters.reset();
+    do {
+      body(t);
+      ++calls;
+    } while ( t.elapsed_ns() < opts.minTime * 1e9 && calls < 1000 );
+
+    const double                ops    = double(calls) * double(opsPerCall == 0 ? 1 : opsPerCall);
+    const perf_counters::values misses = counters.read();
+    result                      r;
+
+    r.name          = std::move(name);
+    r.nsPerOp       = t.elapsed_ns() / ops;
+    r.mopsPerSecond = r.nsPerOp > 0 ? 1e3 / r.nsPerOp : -1;
+    if ( misses.llc != perf_counters::unavailable ) r.llcMissPerOp = double(misses.llc) / ops;
+    if ( misses.l1d != perf_counters::unavailable ) r.l1dMissPerOp = double(misses.l1d) / ops;
+    return r;
+  }
+
+  /// @brief Whether the benchmark named name was selected on the command line.
+  inline bool
+  selected(const options& opts, const std::string& name)
+  {
+    return std::regex_search(name, opts.filter);
+  }
+
+  void run_container_benchmarks(const options& opts, reporter& out);
+  void run_concurrent_benchmarks(const options& opts, reporter& out);
+
+} // namespace bench
+
+#endif // __FT_BENCH_HARNESS__
@@ -0,0 +1,134 @@
+#include <cstdio>    // For std::printf, std::fprintf
+#include <cstdlib>   // For std::strtod
+#include <cstring>   // For std::strcmp, std::strlen, std::strncmp
+#include <regex>     // For std::regex, std::regex_error
+#include <string>    // For std::string
+#include <vector>    // For std::vector
+
+#include "alloc_counter.h"
+#include "harness.h"
+#include "perf_counters.h"
+
+namespace {
+
+  const char* const usage =
+    "usage: ft_bench [options]\n"
+    "\n"
+    "Benchmarks the ft containers against std::map, std::set and the std unordered\n"
+    "containers. Names are\n"
+    "  <op>/<container>/<key>/<order>/<size>\n"
+    "with op in insert, find, iterate, range_scan (lower_bound then 32 steps, ordered\n"
+    "containers only), copy, move, erase; key in int, string (16 chars, heap\n"
+    "allocated), record64 (64 bytes); order in sorted, random, zipf (theta 0.99).\n"
+    "The concurrent benchmarks are\n"
+    "  read/<map>/threads:<t>/<size> and read_1writer/<map>/threads:<t>/<size>\n"
+    "where t readers look up random keys, alone or beside one updating thread.\n"
+    "\n"
+    "  --filter=REGEX        run the benchmarks whose name matches REGEX\n"
+    "  --sizes=N,...         container sizes, e.g. 1e3,1e5,1e8 (default 1e3,1e4,1e5,1e6)\n"
+    "  --threads=T,...       reader counts (default 1,2,4,8,16,32,64)\n"
+    "  --concurrent-size=N   keys in the concurrent maps (default 1e6)\n"
+    "  --flat-limit=N        largest size at which flat containers insert and erase\n"
+    "                        one by one (default 1e5)\n"
+    "  --min-time=SECONDS    least measured time per benchmark (default 0.1)\n"
+    "  --format=console|csv  output format (default console)\n"
+    "\n"
+    "ns/op is the mean time per operation; for iterate and copy an operation is one\n"
+    "element. bytes/elem is the heap held by the container per element, allocator\n"
+    "rounding included. LLC/op and L1D/op are cache misses per operation, shown when\n"
+    "perf counters are available to the process.\n";
+
+  /// @brief Parse a count written as an integer or in scientific notation, like 1e6.
+  bool
+  parse_count(const char* s, std::size_t& out)
+  {
+    char*        end;
+    const double v = std::strtod(s, &end);
+
+    if ( end == s || v < 0 ) return false;
+    out = static_cast<std::size_t>(v + 0.5);
+    return true;
+  }
+
+  template <typename T>
+  bool
+  parse_list(const char* s, std::vector<T>& out)
+  {
+    std::vector<T> values;
+    std::string    list(s);
+    std::size_t    pos = 0;
+
+    while ( pos <= list.size() ) {
+      std::size_t comma = list.find(',', pos);
+      std::size_t v;
+
+      if ( comma == std::string::npos ) comma = list.size();
+      if ( !parse_count(list.substr(pos, comma - pos).c_str(), v) ) return false;
+      values.push_back(static_cast<T>(v));
+      pos = comma + 1;
+    }
+    out = values;
+    return true;
+  }
+
+  /// @brief The value of a `--name=value` argument, or nullptr if arg is another option.
+  const char*
+  option_value(const char* arg, const char* name)
+  {
+    const std::size_t len = std::strlen(name);
+
+    if ( std::strncmp(arg, name, len) != 0 || arg[len] != '=' ) return nullptr;
+    return arg + len + 1;
+  }
+
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+  bench::options opts;
+
+  for ( int i = 1; i < argc; ++i ) {
+    const char* arg = argv[i];
+    const char* v;
+    bool        ok  = true;
+
+    if ( std::strcmp(arg, "--help") == 0 || std::strcmp(arg, "-h") == 0 ) {
+      std::printf("%s", usage);
+      return 0;
+    }
+    else if ( ( v = option_value(arg, "--filter") ) ) {
+      try { opts.filter = std::regex(v); }
+      catch ( const std::regex_error& ) { ok = false; }
+    }
+    else if ( ( v = option_value(arg, "--sizes") ) ) ok = parse_list(v, opts.sizes);
+    else if ( ( v = option_value(arg, "--threads") ) ) ok = parse_list(v, opts.threads);
+    else if ( ( v = option_value(arg, "--concurrent-size") ) ) ok = parse_count(v, opts.concurrentSize);
+    else if ( ( v = option_value(arg, "--flat-limit") ) ) ok = parse_count(v, opts.flatLimit);
+    else if ( ( v = option_value(arg, "--min-time") ) ) opts.minTime = std::strtod(v, nullptr);
+    else if ( ( v = option_value(arg, "--format") ) ) {
+      ok        = std::strcmp(v, "console") == 0 || std::strcmp(v, "csv") == 0;
+      opts.csv  = std::strcmp(v, "csv") == 0;
+    }
+    else ok = false;
+
+    if ( !ok ) {
+      std::fprintf(stderr, "ft_bench: bad argument '%s'\n\n%s", arg, usage);
+      return 2;
+    }
+  }
+
+  if ( !opts.csv ) {
+    bench::perf_counters probe;
+
+    std::printf("# perf counters: %s; heap accounting: %s\n",
+                probe.available() ? "available" : "unavailable",
+                bench::alloc_counter::supported() ? "available" : "unavailable");
+  }
+
+  bench::reporter out(opts.csv);
+
+  bench::run_container_benchmarks(opts, out);
+  bench::run_concurrent_benchmarks(opts, out);
+  return 0;
+}
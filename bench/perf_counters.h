@@ -0,0 +1,116 @@
+#ifndef   __FT_BENCH_PERF_COUNTERS__
+# define  __FT_BENCH_PERF_COUNTERS__
+
+# include <cstdint>   // For std::uint64_t
+# include <cstring>   // For std::memset
+
+# if defined(__linux__)
+#  include <linux/perf_event.h> // For perf_event_attr, PERF_*
+#  include <sys/ioctl.h>        // For ioctl
+#  include <sys/syscall.h>      // For SYS_perf_event_open
+#  include <unistd.h>           // For syscall, read, close
+# endif
+
+namespace bench {
+
+  /// @brief Hardware cache miss counters of the calling thread, read through `perf_event_open`.
+  /// @details Counts last level cache misses and L1 data cache read misses in user mode.
+  /// Where the counters cannot be opened — another OS, a container without
+  /// `CAP_PERFMON`, `perf_event_paranoid` above 2, a virtual machine without a PMU — every
+  /// call does nothing and `read()` reports them as `unavailable`.
+  class perf_counters
+  {
+    public:
+      static constexpr std::uint64_t unavailable = ~std::uint64_t(0); ///< The value of a counter that could not be opened.
+
+      /// @brief The counts accumulated since the last `reset()`.
+      struct values
+      {
+        std::uint64_t llc; ///< Last level cache misses.
+        std::uint64_t l1d; ///< L1 data cache read misses.
+      };
+
+    public:
+      perf_counters() : m_llc{ __open(false) }, m_l1d{ __open(true) } { }
+
+      perf_counters(const perf_counters&) = delete;
+      perf_counters& operator=(const perf_counters&) = delete;
+
+      ~perf_counters()
+      {
+# if defined(__linux__)
+        if ( m_llc >= 0 ) ::close(m_llc);
+        if ( m_l1d >= 0 ) ::close(m_l1d);
+# endif
+      }
+
+      /// @brief Whether any counter could be opened.
+      bool
+      available() const noexcept { return m_llc >= 0 || m_l1d >= 0; }
+
+      void
+      reset() noexcept { __control(__reset); }
+
+      void
+      start() noexcept { __control(__enable); }
+
+      void
+      stop() noexcept { __control(__disable); }
+
+      values
+      read() const noexcept { return values{ __read(m_llc), __read(m_l1d) }; }
+
+    private:
+      enum __request { __reset, __enable, __disable };
+
+# if defined(__linux__)
+      static int
+      __open(bool l1d) noexcept
+      {
+        perf_event_attr attr;
+
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size           = sizeof(attr);
+        attr.type           = l1d ? PERF_TYPE_HW_CACHE : PERF_TYPE_HARDWARE;
+        attr.config         = l1d ? PERF_COUNT_HW_CACHE_L1D | ( PERF_COUNT_HW_CACHE_OP_READ << 8 )
+                                    | ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 )
+                                  : PERF_COUNT_HW_CACHE_MISSES;
+        attr.disabled       = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+        return static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+      }
+
+      void
+      __control(__request r) noexcept
+      {
+        const unsigned long request = r == __reset  ? PERF_EVENT_IOC_RESET
+                                    : r == __enable ? PERF_EVENT_IOC_ENABLE
+                                                    : PERF_EVENT_IOC_DISABLE;
+
+        if ( m_llc >= 0 ) ::ioctl(m_llc, request, 0);
+        if ( m_l1d >= 0 ) ::ioctl(m_l1d, request, 0);
+      }
+
+      static std::uint64_t
+      __read(int fd) noexcept
+      {
+        std::uint64_t count;
+
+        if ( fd < 0 || ::read(fd, &count, sizeof(count)) != sizeof(count) ) return unavailable;
+        return count;
+      }
+# else
+      static int           __open(bool) noexcept { return -1; }
+      void                 __control(__request) noexcept { }
+      static std::uint64_t __read(int) noexcept { return unavailable; }
+# endif
+
+    private:
+      int m_llc; ///< The last level cache miss counter, or -1.
+      int m_l1d; ///< The L1 data cache read miss counter, or -1.
+  };
+
+} // namespace bench
+
+#endif // __FT_BENCH_PERF_COUNTERS__
@@ -0,0 +1,186 @@
+#ifndef   __FT_BENCH_WORKLOAD__
+# define  __FT_BENCH_WORKLOAD__
+
+# include <algorithm> // For std::sort, std::shuffle
+# include <cmath>     // For std::pow
+# include <cstddef>   // For std::size_t
+# include <cstdint>   // For std::uint64_t, std::uint32_t
+# include <cstdio>    // For std::snprintf
+# include <map>       // For std::map
+# include <random>    // For std::mt19937_64, std::uniform_real_distribution
+# include <string>    // For std::string
+# include <utility>   // For std::pair
+# include <vector>    // For std::vector
+
+namespace bench {
+
+  /// @brief A 64-byte key ordered by its first word, for containers of large elements.
+  struct record64
+  {
+    std::uint64_t key;        ///< The ordering key.
+    std::uint64_t payload[7]; ///< Filler up to one cache line.
+  };
+
+  static_assert(sizeof(record64) == 64, "bench::record64 is one cache line");
+
+  inline bool
+  operator<(const record64& x, const record64& y) noexcept { return x.key < y.key; }
+
+  inline bool
+  operator==(const record64& x, const record64& y) noexcept { return x.key == y.key; }
+
+  /// @brief How the keys of a benchmark are presented to the container.
+  enum class order
+  {
+    sorted, ///< Ascending: best case for hints, rightmost-path growth and prefetching.
+    random, ///< A uniform shuffle.
+    zipf    ///< Draws of a Zipf distribution over the keys, a few of them very hot.
+  };
+
+  inline const char*
+  order_name(order o) noexcept
+  {
+    return o == order::sorted ? "sorted" : o == order::random ? "random" : "zipf";
+  }
+
+  /// @brief A bijection on 64-bit words that scatters consecutive ids (splitmix64's finalizer).
+  inline std::uint64_t
+  mix(std::uint64_t x) noexcept
+  {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ull;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebull;
+    x ^= x >> 31;
+    return x;
+  }
+
+  /// @brief The key of id; distinct ids give distinct keys.
+  /// @details Ints are scattered over the 32-bit range by an odd multiplier, which is a
+  /// bijection modulo 2^32, so they stay distinct for up to 2^32 ids. Strings are the
+  /// 16 hex digits of the whole mixed id, so they are distinct for every id. That is
+  /// longer than the small-string buffer of the common standard libraries, so every key
+  /// lives on the heap and comparisons chase a pointer.
+  template <typename K> K make_key(std::uint64_t id);
+
+  template <>
+  inline int
+  make_key<int>(std::uint64_t id) { return static_cast<int>(static_cast<std::uint32_t>(id * 2654435761u)); }
+
+  template <>
+  inline std::string
+  make_key<std::string>(std::uint64_t id)
+  {
+    char buf[20];
+
+    std::snprintf(buf, sizeof(buf), "%016llx", static_cast<unsigned long long>(mix(id)));
+    return std::string(buf, 16);
+  }
+
+  template <>
+  inline record64
+  make_key<record64>(std::uint64_t id)
+  {
+    record64 r{ mix(id), { } };
+
+    for ( std::uint64_t& w : r.payload ) w = id;
+    return r;
+  }
+
+  /// @brief A cheap summary of a key, folded into a checksum so that reads are not elided.
+  inline std::uint64_t key_digest(int k) noexcept { return static_cast<std::uint64_t>(k); }
+  inline std::uint64_t key_digest(const std::string& k) noexcept { return k.size() + static_cast<unsigned char>(k[1]); }
+  inline std::uint64_t key_digest(const record64& k) noexcept { return k.key; }
+
+  /// @brief Zipf distribution over [0, n) with exponent theta < 1.
+  /// @details The rejection-free method of Gray et al., "Quickly Generating Billion-Record
+  /// Synthetic Databases" (SIGMOD 1994), as used by YCSB: O(1) memory, and one O(n)
+  /// harmonic sum at construction.
+  class zipf_distribution
+  {
+    public:
+      zipf_distribution(std::size_t n, double theta = 0.99)
+        : m_n{ n },
+          m_theta{ theta },
+          m_zetan{ __zeta(n, theta) },
+          m_alpha{ 1.0 / ( 1.0 - theta ) },
+          m_eta{ ( 1.0 - std::pow(2.0 / double(n), 1.0 - theta) ) / ( 1.0 - __zeta(2, theta) / m_zetan ) },
+          m_uniform{ 0.0, 1.0 } { }
+
+      template <typename Rng>
+      std::size_t
+      operator()(Rng& rng)
+      {
+        const double u  = m_uniform(rng);
+        const double uz = u * m_zetan;
+
+        if ( uz < 1.0 ) return 0;
+        if ( uz < 1.0 + std::pow(0.5, m_theta) ) return m_n > 1 ? 1 : 0;
+
+        const std::size_t r = static_cast<std::size_t>(double(m_n) * std::pow(m_eta * u - m_eta + 1.0, m_alpha));
+        return r < m_n ? r : m_n - 1;
+      }
+
+    private:
+      /// @brief The generalized harmonic number of n, memoized since it is O(n).
+      static double
+      __zeta(std::size_t n, double theta)
+      {
+        static std::map<std::pair<std::size_t, double>, double> cache;
+
+        auto it = cache.find({ n, theta });
+        if ( it != cache.end() ) return it->second;
+
+        double sum = 0;
+        for ( std::size_t i = 1; i <= n; ++i ) sum += 1.0 / std::pow(double(i), theta);
+        return cache[{ n, theta }] = sum;
+      }
+
+    private:
+      std::size_t                            m_n;       ///< The number of ranks.
+      double                                 m_theta;   ///< The skew.
+      double                                 m_zetan;   ///< The harmonic number of n.
+      double                                 m_alpha;   ///< 1 / (1 - theta).
+      double                                 m_eta;     ///< The scale of the inversion.
+      std::uniform_real_distribution<double> m_uniform; ///< Uniform draws in [0, 1).
+  };
+
+  /// @brief The keys of one benchmark fixture.
+  template <typename K>
+  struct workload
+  {
+    std::vector<K> build; ///< The n distinct keys, in the order the reference container is built from.
+    std::vector<K> ops;   ///< n keys in the order of the fixture: what is inserted, looked up and erased.
+  };
+
+  /// @brief The keys of n elements presented in order o, from a fixed seed.
+  /// @details The reference container is built from the distinct keys in ascending order
+  /// for `sorted` and shuffled otherwise, which decides how its nodes lie in memory. The
+  /// operation keys are the same n keys in that order, except for `zipf`, where they are
+  /// n draws over the shuffled keys: a few keys recur very often and many never appear.
+  template <typename K>
+  workload<K>
+  make_workload(std::size_t n, order o)
+  {
+    std::mt19937_64 rng(42);
+    workload<K>     w;
+
+    w.build.reserve(n);
+    for ( std::size_t i = 0; i < n; ++i ) w.build.push_back(make_key<K>(i));
+    if ( o == order::sorted ) std::sort(w.build.begin(), w.build.end());
+    else std::shuffle(w.build.begin(), w.build.end(), rng);
+
+    if ( o != order::zipf ) {
+      w.ops = w.build;
+      return w;
+    }
+    zipf_distribution zipf(n);
+
+    w.ops.reserve(n);
+    for ( std::size_t i = 0; i < n; ++i ) w.ops.push_back(w.build[zipf(rng)]);
+    return w;
+  }
+
+} // namespace bench
+
+#endif // __FT_BENCH_WORKLOAD__
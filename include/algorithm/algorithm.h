@@ -0,0 +1,52 @@
+#ifndef   __FT_ALGORITHM__
+# define  __FT_ALGORITHM__
+
+namespace ft {
+
+  /// @brief Check whether two ranges are element-wise equal.
+  /// @param __first1 The beginning of the first range.
+  /// @param __last1 The end of the first range.
+  /// @param __first2 The beginning of the second range, at least as long as the first.
+  /// @return True if every pair of corresponding elements compares equal.
+  template <typename _InputIterator1, typename _InputIterator2>
+  inline bool
+  equal(_InputIterator1 __first1, _InputIterator1 __last1, _InputIterator2 __first2)
+  {
+    for ( ; __first1 != __last1; ++__first1, ++__first2 ) {
+      if ( !(*__first1 == *__first2) ) return false;
+    }
+    return true;
+  }
+
+  /// @brief Lexicographically compare two ranges.
+  /// @return True if the first range compares less than the second one.
+  template <typename _InputIterator1, typename _InputIterator2>
+  inline bool
+  lexicographical_compare(_InputIterator1 __first1, _InputIterator1 __last1,
+                          _InputIterator2 __first2, _InputIterator2 __last2)
+  {
+    for ( ; __first1 != __last1 && __first2 != __last2; ++__first1, ++__first2 ) {
+      if ( *__first1 < *__first2 ) return true;
+      if ( *__first2 < *__first1 ) return false;
+    }
+    return __first1 == __last1 && __first2 != __last2;
+  }
+
+  /// @brief Lexicographically compare two ranges with a custom comparator.
+  /// @return True if the first range compares less than the second one.
+  template <typename _InputIterator1, typename _InputIterator2, typename _Compare>
+  inline bool
+  lexicographical_compare(_InputIterator1 __first1, _InputIterator1 __last1,
+                          _InputIterator2 __first2, _InputIterator2 __last2,
+                          _Compare __comp)
+  {
+    for ( ; __first1 != __last1 && __first2 != __last2; ++__first1, ++__first2 ) {
+      if ( __comp(*__first1, *__first2) ) return true;
+      if ( __comp(*__first2, *__first1) ) return false;
+    }
+    return __first1 == __last1 && __first2 != __last2;
+  }
+
+} // namespace ft
+
+#endif // __FT_ALGORITHM__
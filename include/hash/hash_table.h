@@ -0,0 +1,885 @@
+#ifndef   __FT_HASH_TABLE__
+# define  __FT_HASH_TABLE__
+
+# include <cstddef>     // For std::size_t, std::ptrdiff_t
+# include <cstdint>     // For std::uint64_t
+# include <cstring>     // For std::memset
+# include <memory>      // For std::allocator, std::allocator_traits
+# include <tuple>       // For std::tuple, std::get, std::make_from_tuple, std::forward_as_tuple
+# include <type_traits> // For std::true_type, std::false_type, std::integral_constant, std::enable_if_t, std::is_same, std::decay_t
+# include <utility>     // For std::move, std::forward, std::swap
+
+# include "../utility/pair.h"       // For ft::pair, ft::piecewise_construct
+# include "hash_table_group.h"      // For hash_table_ctrl, hash_table_group, hash_table_probe
+# include "hash_table_policy.h"     // For hash_table_slot, hash_table_hasher, hash_table_key_equal, __hash_table_mix
+# include "hash_table_iterator.h"   // For hash_table_iterator, hash_table_const_iterator
+
+namespace ft {
+
+  /// @brief Open-addressing hash table engine for the unordered containers with unique keys.
+  /// @details The layout is that of a Swiss table. Every slot has a control byte telling
+  /// whether it is empty, deleted or full, and for full slots 7 bits of the hash of the
+  /// key (H2). The rest of the hash (H1) picks the group of control bytes where probing
+  /// starts. A lookup loads a whole group, 16 bytes with SSE2, finds the slots whose byte
+  /// equals H2 with one vector compare, and compares keys only for those, which is nearly
+  /// always one key. It stops at the first group that has an empty slot.
+  ///
+  /// The capacity is always 2^k - 1. The control bytes are followed by a sentinel, where
+  /// iteration stops, and by copies of the first bytes, so that a group can be loaded from
+  /// any slot without wrapping around. The slots and the control bytes share one
+  /// allocation. A table fills to 7/8 of its capacity before it grows. Erased slots whose
+  /// group was never full become empty again; the others become deleted tombstones, which
+  /// probing goes past and which the next rehash drops.
+  ///
+  /// Values are stored in the slots themselves unless `_NodeStable` is set, in which case
+  /// each slot points to a separately allocated value, see `hash_table_slot`. A rehash
+  /// then moves pointers instead of values, and references stay valid until erasure. In
+  /// both layouts any insertion may rehash and invalidate every iterator.
+  ///
+  /// Moving a value during a rehash must not throw.
+  ///
+  /// @tparam _NodeStable Whether values are allocated one by one and never move.
+  template <
+    typename _Key,
+    typename _Val,
+    typename _KeyOfValue,
+    typename _Hash,
+    typename _Equal,
+    typename _Alloc     = std::allocator<_Val>,
+    bool     _NodeStable = false
+  > class hash_table
+  {
+    protected:
+      using slot_policy        = hash_table_slot<_Val, _Alloc, _NodeStable>;
+      using slot_type          = typename slot_policy::slot_type;
+      using slot_allocator     = typename std::allocator_traits<_Alloc>::template rebind_alloc<slot_type>;
+      using slot_alloc_traits  = std::allocator_traits<slot_allocator>;
+      using value_alloc_traits = std::allocator_traits<_Alloc>;
+      using group              = hash_table_group;
+
+    public:
+      using key_type        = _Key;             ///< The type of the keys.
+      using value_type      = _Val;             ///< The type of the stored values.
+      using hasher          = _Hash;            ///< The hash function type.
+      using key_equal       = _Equal;           ///< The key equality type.
+      using pointer         = value_type*;      ///< Pointer type to the value.
+      using const_pointer   = const value_type*;///< Const pointer type to the value.
+      using reference       = value_type&;      ///< Reference type to the value.
+      using const_reference = const value_type&;///< Const reference type to the value.
+      using size_type       = std::size_t;      ///< Unsigned integer type for sizes.
+      using difference_type = std::ptrdiff_t;   ///< Signed integer type for distances.
+      using allocator_type  = _Alloc;           ///< The allocator type given by the user.
+
+      using iterator       = hash_table_iterator<value_type, slot_policy>;       ///< Forward iterator.
+      using const_iterator = hash_table_const_iterator<value_type, slot_policy>; ///< Constant forward iterator.
+
+    private:
+      /// @brief The table state: allocator, hash function, key equality, control bytes and slots.
+      /// @details Inheriting from the allocator and the function objects lets stateless ones take no space.
+      struct hash_table_impl
+        : public slot_allocator,
+          public hash_table_hasher<_Hash>,
+          public hash_table_key_equal<_Equal>
+      {
+        hash_table_ctrl* m_ctrl       = __empty_ctrl(); ///< The control bytes, then the sentinel and the cloned bytes.
+        slot_type*       m_slots      = nullptr;        ///< The slots, or nullptr when nothing is allocated.
+        size_type        m_size       = 0;              ///< The number of full slots.
+        size_type        m_capacity   = 0;              ///< The number of slots, 0 or 2^k - 1.
+        size_type        m_growthLeft = 0;              ///< The insertions into empty slots left before a rehash.
+
+        hash_table_impl()
+          : slot_allocator{ }, hash_table_hasher<_Hash>{ }, hash_table_key_equal<_Equal>{ } { }
+
+        hash_table_impl(const _Hash& __h, const _Equal& __e, const slot_allocator& __a)
+          : slot_allocator(__a), hash_table_hasher<_Hash>(__h), hash_table_key_equal<_Equal>(__e) { }
+
+        hash_table_impl(const hash_table_impl& __x)
+          : slot_allocator(slot_alloc_traits::select_on_container_copy_construction(__x)),
+            hash_table_hasher<_Hash>(__x.__hasher()),
+            hash_table_key_equal<_Equal>(__x.__key_eq()) { }
+
+        hash_table_impl(hash_table_impl&& __x) noexcept
+          : slot_allocator(std::move(static_cast<slot_allocator&>(__x))),
+            hash_table_hasher<_Hash>(__x.__hasher()),
+            hash_table_key_equal<_Equal>(__x.__key_eq()),
+            m_ctrl{ __x.m_ctrl }, m_slots{ __x.m_slots }, m_size{ __x.m_size },
+            m_capacity{ __x.m_capacity }, m_growthLeft{ __x.m_growthLeft }
+        {
+          __x.__reset();
+        }
+
+        void
+        __reset() noexcept
+        {
+          m_ctrl       = __empty_ctrl();
+          m_slots      = nullptr;
+          m_size       = 0;
+          m_capacity   = 0;
+          m_growthLeft = 0;
+        }
+      };
+
+      hash_table_impl m_impl; ///< The allocator, function objects and storage of the table.
+
+      /// @brief SFINAE helper accepting the key type, or any type if the hash and equality are transparent.
+      template <typename _Kt>
+      using __lookup_t = std::enable_if_t<std::is_same<_Kt, key_type>::value ||
+                                          ( is_transparent_compare<_Hash>::value &&
+                                            is_transparent_compare<_Equal>::value )>;
+
+    public:
+      /// @brief Default constructor. Allocates nothing.
+      hash_table() = default;
+
+      /// @brief Constructor with an initial bucket count, the function objects and an allocator.
+      /// @param __n The number of slots to allocate at once, rounded up to 2^k - 1; 0 allocates nothing.
+      hash_table(size_type __n, const _Hash& __h, const _Equal& __e, const allocator_type& __a = allocator_type())
+        : m_impl(__h, __e, slot_allocator(__a))
+      {
+        if ( __n != 0 ) __resize(__normalize_capacity(__n));
+      }
+
+      /// @brief Copy constructor.
+      /// @param __x The table to copy from.
+      hash_table(const hash_table& __x)
+        : m_impl(__x.m_impl)
+      {
+        __copy(__x);
+      }
+
+      /// @brief Move constructor.
+      /// @details Steals the storage of __x, leaving it empty.
+      hash_table(hash_table&&) = default;
+
+      /// @brief Destructor.
+      ~hash_table() noexcept { __release(); }
+
+      /// @brief Copy assignment operator.
+      /// @param __x The table to copy from.
+      /// @return A reference to this table.
+      hash_table&
+      operator=(const hash_table& __x)
+      {
+        if ( this == &__x ) {
+          return *this;
+        }
+        __release();
+        __alloc_on_copy(__x, typename slot_alloc_traits::propagate_on_container_copy_assignment());
+        m_impl.__hasher() = __x.m_impl.__hasher();
+        m_impl.__key_eq() = __x.m_impl.__key_eq();
+        __copy(__x);
+        return *this;
+      }
+
+      /// @brief Move assignment operator.
+      /// @param __x The table to move from.
+      /// @return A reference to this table.
+      /// @details The storage is stolen when the allocators allow it; otherwise the values are moved one by one.
+      hash_table&
+      operator=(hash_table&& __x)
+        noexcept(slot_alloc_traits::is_always_equal::value &&
+                 std::is_nothrow_move_assignable<_Hash>::value &&
+                 std::is_nothrow_move_assignable<_Equal>::value)
+      {
+        m_impl.__hasher() = std::move(__x.m_impl.__hasher());
+        m_impl.__key_eq() = std::move(__x.m_impl.__key_eq());
+        __move_assign(__x, std::integral_constant<bool,
+                             slot_alloc_traits::propagate_on_container_move_assignment::value ||
+                             slot_alloc_traits::is_always_equal::value>());
+        return *this;
+      }
+
+    public:
+      /// @brief Get the hash function.
+      _Hash
+      hash_function() const { return m_impl.__hasher(); }
+
+      /// @brief Get the key equality.
+      _Equal
+      key_eq() const { return m_impl.__key_eq(); }
+
+      /// @brief Get a copy of the allocator.
+      allocator_type
+      get_allocator() const noexcept { return allocator_type(__slot_allocator()); }
+
+    public:
+      iterator
+      begin() noexcept
+      {
+        iterator __it(m_impl.m_ctrl, m_impl.m_slots);
+
+        __hash_table_skip_free(__it.m_ctrl, __it.m_slot);
+        return __it;
+      }
+
+      const_iterator
+      begin() const noexcept { return const_cast<hash_table*>(this)->begin(); }
+
+      iterator
+      end() noexcept { return __iterator_at(m_impl.m_capacity); }
+
+      const_iterator
+      end() const noexcept { return const_cast<hash_table*>(this)->end(); }
+
+    public:
+      bool
+      empty() const noexcept { return m_impl.m_size == 0; }
+
+      size_type
+      size() const noexcept { return m_impl.m_size; }
+
+      size_type
+      max_size() const noexcept { return value_alloc_traits::max_size(_Alloc(__slot_allocator())); }
+
+    public:
+      /// @brief Get the number of slots.
+      size_type
+      bucket_count() const noexcept { return m_impl.m_capacity; }
+
+      /// @brief Get the ratio of elements to slots.
+      float
+      load_factor() const noexcept
+      {
+        return m_impl.m_capacity == 0 ? 0.0f : static_cast<float>(m_impl.m_size) / static_cast<float>(m_impl.m_capacity);
+      }
+
+      /// @brief Get the load factor at which the table grows, fixed at 7/8.
+      float
+      max_load_factor() const noexcept { return 0.875f; }
+
+      /// @brief Make room for __n elements, so that inserting them does not rehash.
+      void
+      reserve(size_type __n)
+      {
+        if ( __n > m_impl.m_size + m_impl.m_growthLeft )
+          __resize(__normalize_capacity(__growth_to_lower_bound_capacity(__n)));
+      }
+
+      /// @brief Rebuild the table with at least __n slots and room for its elements.
+      /// @details Drops every tombstone. `rehash(0)` shrinks the table to fit, and frees it when empty.
+      void
+      rehash(size_type __n)
+      {
+        if ( __n == 0 && m_impl.m_size == 0 ) {
+          __release();
+          return;
+        }
+
+        const size_type __fit = __growth_to_lower_bound_capacity(m_impl.m_size);
+        __resize(__normalize_capacity(__n > __fit ? __n : __fit));
+      }
+
+    public:
+      /// @brief Insert a value if no element with an equal key exists.
+      /// @param __v The value to insert.
+      /// @return An iterator to the element with the key of __v, and whether insertion took place.
+      pair<iterator, bool>
+      __insert_unique(const value_type& __v) { return __try_emplace_unique(_KeyOfValue()(__v), __v); }
+
+      pair<iterator, bool>
+      __insert_unique(value_type&& __v) { return __emplace_unique(std::move(__v)); }
+
+      /// @brief Construct a value and insert it if its key is not present yet.
+      /// @param __args The arguments forwarded to the constructor of the value.
+      /// @return An iterator to the element with that key, and whether insertion took place.
+      /// @details For maps, a key and a mapped value, a pair of them, or piecewise argument
+      /// tuples are split into the key and the rest, and handed to `__try_emplace_unique`,
+      /// so that nothing is built when the key exists. The key of a map element is const
+      /// and is never moved from: it is copied out of a pair, and moved only when it was
+      /// built here. Other arguments build the value first to learn its key.
+      template <typename... _Args>
+      pair<iterator, bool>
+      __emplace_unique(_Args&&... __args)
+      {
+        return __emplace_unique_aux(__is_map(), std::forward<_Args>(__args)...);
+      }
+
+      /// @brief Construct a value in its slot only if no element has the key __k.
+      /// @param __k The key the new value will have.
+      /// @param __args The arguments forwarded to the constructor of the value.
+      /// @return An iterator to the element with key __k, and whether insertion took place.
+      /// @details Nothing is constructed, and no argument moved from, when the key exists.
+      template <typename _Kt, typename... _Args>
+      pair<iterator, bool>
+      __try_emplace_unique(const _Kt& __k, _Args&&... __args)
+      {
+        const size_type __h = __hash(__k);
+        size_type       __i = __find_index(__k, __h);
+
+        if ( __i != m_impl.m_capacity ) return pair<iterator, bool>(__iterator_at(__i), false);
+        __i = __prepare_insert(__h);
+        __construct_at(__i, std::forward<_Args>(__args)...);
+        return pair<iterator, bool>(__iterator_at(__i), true);
+      }
+
+      /// @brief Insert every value of a range, skipping duplicate keys.
+      template <typename _InputIterator>
+      void
+      __insert_range_unique(_InputIterator __first, _InputIterator __last)
+      {
+        for ( ; __first != __last; ++__first )
+          __insert_unique(*__first);
+      }
+
+    public:
+      /// @brief Erase the element at a position.
+      /// @return An iterator to the element following the erased one.
+      /// @details No other element moves, so other iterators stay valid.
+      iterator
+      erase(const_iterator __position) { return erase(__position.__const_cast()); }
+
+      iterator
+      erase(iterator __position)
+      {
+        const size_type __i = static_cast<size_type>(__position.m_ctrl - m_impl.m_ctrl);
+        _Alloc          __a(__slot_allocator());
+
+        slot_policy::__destroy(__a, m_impl.m_slots + __i);
+        __erase_meta_only(__i);
+        return ++__position;
+      }
+
+      /// @brief Erase the element with a key equal to __k, if any.
+      /// @return The number of erased elements.
+      size_type
+      erase(const key_type& __k)
+      {
+        iterator __i = find(__k);
+
+        if ( __i == end() ) return 0;
+        erase(__i);
+        return 1;
+      }
+
+      /// @brief Erase the elements in [__first, __last).
+      /// @return An iterator to the element following the last erased one.
+      iterator
+      erase(const_iterator __first, const_iterator __last)
+      {
+        if ( __first == begin() && __last == end() ) {
+          clear();
+          return end();
+        }
+
+        iterator __i = __first.__const_cast();
+        while ( __i != __last ) __i = erase(__i);
+        return __i;
+      }
+
+      /// @brief Erase every element, keeping the slots.
+      void
+      clear() noexcept
+      {
+        if ( m_impl.m_capacity == 0 ) return;
+        __destroy_all();
+        m_impl.m_size = 0;
+        __reset_ctrl();
+      }
+
+      /// @brief Swap the contents with another table.
+      /// @param __t The table to swap with.
+      void
+      swap(hash_table& __t) noexcept(std::is_nothrow_swappable<_Hash>::value && std::is_nothrow_swappable<_Equal>::value)
+      {
+        std::swap(m_impl.m_ctrl, __t.m_impl.m_ctrl);
+        std::swap(m_impl.m_slots, __t.m_impl.m_slots);
+        std::swap(m_impl.m_size, __t.m_impl.m_size);
+        std::swap(m_impl.m_capacity, __t.m_impl.m_capacity);
+        std::swap(m_impl.m_growthLeft, __t.m_impl.m_growthLeft);
+        std::swap(m_impl.__hasher(), __t.m_impl.__hasher());
+        std::swap(m_impl.__key_eq(), __t.m_impl.__key_eq());
+        __alloc_on_swap(__t, typename slot_alloc_traits::propagate_on_container_swap());
+      }
+
+    public:
+      /// @brief Find the element with a key equal to __k.
+      /// @return An iterator to the element, or end() if there is none.
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      iterator
+      find(const _Kt& __k) { return __iterator_at(__find_index(__k, __hash(__k))); }
+
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      const_iterator
+      find(const _Kt& __k) const { return const_cast<hash_table*>(this)->find(__k); }
+
+      /// @brief Count the elements with a key equal to __k, zero or one.
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      size_type
+      count(const _Kt& __k) const { return find(__k) == end() ? 0 : 1; }
+
+      /// @brief Get the range of elements with a key equal to __k, of length zero or one.
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      pair<iterator, iterator>
+      equal_range(const _Kt& __k)
+      {
+        iterator __i = find(__k);
+
+        if ( __i == end() ) return pair<iterator, iterator>(__i, __i);
+        iterator __j = __i;
+        return pair<iterator, iterator>(__i, ++__j);
+      }
+
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      pair<const_iterator, const_iterator>
+      equal_range(const _Kt& __k) const
+      {
+        pair<iterator, iterator> __r = const_cast<hash_table*>(this)->equal_range(__k);
+        return pair<const_iterator, const_iterator>(__r.first, __r.second);
+      }
+
+    public:
+      /// @brief Check the hash table invariants.
+      /// @return True if the table is valid.
+      /// @details Checks the sentinel and the cloned control bytes, the cached size and
+      /// growth budget, and that every element is found from its own hash. Intended for
+      /// debugging; runs in O(n).
+      bool
+      __hash_table_verify() const
+      {
+        if ( m_impl.m_capacity == 0 )
+          return m_impl.m_ctrl == __empty_ctrl() && m_impl.m_size == 0 && m_impl.m_growthLeft == 0;
+        if ( ( m_impl.m_capacity & ( m_impl.m_capacity + 1 ) ) != 0 ) return false;
+        if ( m_impl.m_ctrl[m_impl.m_capacity] != hash_table_sentinel ) return false;
+
+        for ( size_type __i = 0; __i < __cloned && __i < m_impl.m_capacity; ++__i )
+          if ( m_impl.m_ctrl[m_impl.m_capacity + 1 + __i] != m_impl.m_ctrl[__i] ) return false;
+
+        size_type __full    = 0;
+        size_type __deleted = 0;
+        for ( size_type __i = 0; __i < m_impl.m_capacity; ++__i ) {
+          const hash_table_ctrl __c = m_impl.m_ctrl[__i];
+
+          if ( __ctrl_is_deleted(__c) ) ++__deleted;
+          if ( !__ctrl_is_full(__c) ) continue;
+          ++__full;
+
+          const key_type& __k = _KeyOfValue()(slot_policy::__element(m_impl.m_slots + __i));
+          const size_type __h = __hash(__k);
+          if ( __c != __h2(__h) || __find_index(__k, __h) != __i ) return false;
+        }
+        return __full == m_impl.m_size
+            && m_impl.m_growthLeft + __full + __deleted == __capacity_to_growth(m_impl.m_capacity);
+      }
+
+    private:
+      static constexpr size_type __cloned = group::width - 1; ///< The control bytes copied after the sentinel.
+
+      /// @brief Whether the values are pairs of a const key and a mapped value.
+      template <typename _V>
+      struct __is_map_value : std::false_type { };
+
+      template <typename _T>
+      struct __is_map_value<ft::pair<const key_type, _T>> : std::true_type { };
+
+      using __is_map = __is_map_value<value_type>;
+
+      /// @brief Whether a piecewise key tuple holds the key itself.
+      template <typename... _Args>
+      struct __is_key_tuple : std::false_type { };
+
+      template <typename _Arg>
+      struct __is_key_tuple<_Arg> : std::is_same<std::decay_t<_Arg>, key_type> { };
+
+      /// @brief Values other than map pairs are built to learn their key, then moved into their slot.
+      template <typename... _Args>
+      pair<iterator, bool>
+      __emplace_unique_aux(std::false_type, _Args&&... __args)
+      {
+        value_type __v(std::forward<_Args>(__args)...);
+        return __try_emplace_unique(_KeyOfValue()(__v), std::move(__v));
+      }
+
+      pair<iterator, bool>
+      __emplace_unique_aux(std::false_type, value_type&& __v)
+      {
+        return __try_emplace_unique(_KeyOfValue()(__v), std::move(__v));
+      }
+
+      /// @brief Arguments a map cannot split: the pair is built, then its key copied.
+      template <typename... _Args>
+      pair<iterator, bool>
+      __emplace_unique_aux(std::true_type, _Args&&... __args)
+      {
+        value_type __v(std::forward<_Args>(__args)...);
+        return __try_emplace_unique(__v.first, __v.first, std::move(__v.second));
+      }
+
+      template <typename _K, typename _M>
+      pair<iterator, bool>
+      __emplace_unique_aux(std::true_type, _K&& __k, _M&& __m)
+      {
+        return __emplace_key_and_mapped(std::is_same<std::decay_t<_K>, key_type>(),
+                                        std::forward<_K>(__k), std::forward<_M>(__m));
+      }
+
+      template <typename _U1, typename _U2>
+      pair<iterator, bool>
+      __emplace_unique_aux(std::true_type, ft::pair<_U1, _U2>&& __p)
+      {
+        return __emplace_unique_aux(std::true_type(), std::forward<_U1>(__p.first), std::forward<_U2>(__p.second));
+      }
+
+      template <typename _U1, typename _U2>
+      pair<iterator, bool>
+      __emplace_unique_aux(std::true_type, ft::pair<_U1, _U2>& __p)
+      {
+        return __emplace_unique_aux(std::true_type(), __p.first, __p.second);
+      }
+
+      template <typename _U1, typename _U2>
+      pair<iterator, bool>
+      __emplace_unique_aux(std::true_type, const ft::pair<_U1, _U2>& __p)
+      {
+        return __emplace_unique_aux(std::true_type(), __p.first, __p.second);
+      }
+
+      template <typename... _Args1, typename... _Args2>
+      pair<iterator, bool>
+      __emplace_unique_aux(std::true_type, piecewise_construct_t, std::tuple<_Args1...> __k, std::tuple<_Args2...> __m)
+      {
+        return __emplace_piecewise(__is_key_tuple<_Args1...>(), std::move(__k), std::move(__m));
+      }
+
+      /// @brief The key is given as it is, and looked up before anything is built.
+      template <typename _K, typename _M>
+      pair<iterator, bool>
+      __emplace_key_and_mapped(std::true_type, _K&& __k, _M&& __m)
+      {
+        return __try_emplace_unique(__k, std::forward<_K>(__k), std::forward<_M>(__m));
+      }
+
+      /// @brief The key is built from __k, looked up, and moved into the slot.
+      template <typename _K, typename _M>
+      pair<iterator, bool>
+      __emplace_key_and_mapped(std::false_type, _K&& __k, _M&& __m)
+      {
+        key_type __key(std::forward<_K>(__k));
+        return __try_emplace_unique(__key, std::move(__key), std::forward<_M>(__m));
+      }
+
+      template <typename _Kt, typename... _Args2>
+      pair<iterator, bool>
+      __emplace_piecewise(std::true_type, std::tuple<_Kt>&& __k, std::tuple<_Args2...>&& __m)
+      {
+        return __try_emplace_unique(std::get<0>(__k), piecewise_construct, std::move(__k), std::move(__m));
+      }
+
+      template <typename... _Args1, typename... _Args2>
+      pair<iterator, bool>
+      __emplace_piecewise(std::false_type, std::tuple<_Args1...>&& __k, std::tuple<_Args2...>&& __m)
+      {
+        key_type __key = std::make_from_tuple<key_type>(std::move(__k));
+        return __try_emplace_unique(__key, piecewise_construct, std::forward_as_tuple(std::move(__key)), std::move(__m));
+      }
+
+      /// @brief The control bytes of a table without slots.
+      static hash_table_ctrl*
+      __empty_ctrl() noexcept { return const_cast<hash_table_ctrl*>(hash_table_empty_group); }
+
+      slot_allocator&
+      __slot_allocator() noexcept { return m_impl; }
+
+      const slot_allocator&
+      __slot_allocator() const noexcept { return m_impl; }
+
+      iterator
+      __iterator_at(size_type __i) noexcept { return iterator(m_impl.m_ctrl + __i, m_impl.m_slots + __i); }
+
+      template <typename _Kt>
+      size_type
+      __hash(const _Kt& __k) const { return __hash_table_mix(m_impl.__hasher()(__k)); }
+
+      /// @brief The part of a hash choosing where probing starts.
+      static size_type
+      __h1(size_type __h) noexcept { return __h >> 7; }
+
+      /// @brief The part of a hash stored in the control byte.
+      static hash_table_ctrl
+      __h2(size_type __h) noexcept { return static_cast<hash_table_ctrl>(__h & 0x7f); }
+
+      /// @brief The smallest capacity of the form 2^k - 1 not below __n, at least 1.
+      static size_type
+      __normalize_capacity(size_type __n) noexcept
+      {
+        return __n == 0 ? 1 : static_cast<size_type>(~std::uint64_t(0) >> __hash_table_clz(__n));
+      }
+
+      /// @brief The number of elements a capacity holds at the maximum load factor.
+      /// @details With 8-wide groups a capacity of 7 would hold 7 and leave no empty slot.
+      static size_type
+      __capacity_to_growth(size_type __capacity) noexcept
+      {
+        return ( group::width == 8 && __capacity == 7 ) ? 6 : __capacity - __capacity / 8;
+      }
+
+      /// @brief The least capacity, before normalization, that holds __g elements.
+      static size_type
+      __growth_to_lower_bound_capacity(size_type __g) noexcept
+      {
+        if ( __g == 0 ) return 0;
+        return ( group::width == 8 && __g == 7 ) ? 8 : __g + ( __g - 1 ) / 7;
+      }
+
+      /// @brief The number of slot-sized units holding __capacity slots and their control bytes.
+      static size_type
+      __allocation_units(size_type __capacity) noexcept
+      {
+        return __capacity + ( __capacity + group::width + sizeof(slot_type) - 1 ) / sizeof(slot_type);
+      }
+
+      /// @brief Set the control byte of slot __i, and its clone if it has one.
+      /// @details For __i past the cloned range the second store writes the same byte again,
+      /// which is cheaper than testing for it.
+      void
+      __set_ctrl(size_type __i, hash_table_ctrl __c) noexcept
+      {
+        m_impl.m_ctrl[__i] = __c;
+        m_impl.m_ctrl[( ( __i - __cloned ) & m_impl.m_capacity ) + ( __cloned & m_impl.m_capacity )] = __c;
+      }
+
+      /// @brief Find the slot holding a key equal to __k, whose hash is __h.
+      /// @return The index of the slot, or the capacity if there is none.
+      template <typename _Kt>
+      size_type
+      __find_index(const _Kt& __k, size_type __h) const
+      {
+        hash_table_probe      __seq(__h1(__h), m_impl.m_capacity);
+        const hash_table_ctrl __h2v = __h2(__h);
+
+        while ( true ) {
+          const group __g(m_impl.m_ctrl + __seq.__offset());
+
+          for ( typename group::bitmask __m = __g.__match(__h2v); __m; __m.__clear_lowest() ) {
+            const size_type __i = __seq.__offset(__m.__lowest());
+
+            if ( m_impl.__key_eq()(_KeyOfValue()(slot_policy::__element(m_impl.m_slots + __i)), __k) ) return __i;
+          }
+          if ( __g.__match_empty() ) return m_impl.m_capacity;
+          __seq.__next();
+        }
+      }
+
+      /// @brief Find the first free slot on the probe sequence of __h.
+      size_type
+      __find_first_non_full(size_type __h) const noexcept
+      {
+        hash_table_probe __seq(__h1(__h), m_impl.m_capacity);
+
+        while ( true ) {
+          const typename group::bitmask __m = group(m_impl.m_ctrl + __seq.__offset()).__match_empty_or_deleted();
+
+          if ( __m ) return __seq.__offset(__m.__lowest());
+          __seq.__next();
+        }
+      }
+
+      /// @brief Claim a free slot for a new element of hash __h, growing the table if needed.
+      /// @return The index of the slot, marked full but not constructed.
+      /// @details Reusing a tombstone costs no growth budget; an empty slot does.
+      size_type
+      __prepare_insert(size_type __h)
+      {
+        size_type __i = __find_first_non_full(__h);
+
+        if ( m_impl.m_growthLeft == 0 && !__ctrl_is_deleted(m_impl.m_ctrl[__i]) ) {
+          __rehash_and_grow();
+          __i = __find_first_non_full(__h);
+        }
+        ++m_impl.m_size;
+        m_impl.m_growthLeft -= __ctrl_is_empty(m_impl.m_ctrl[__i]);
+        __set_ctrl(__i, __h2(__h));
+        return __i;
+      }
+
+      /// @brief Construct a value in the claimed slot __i, releasing the slot if that throws.
+      template <typename... _Args>
+      void
+      __construct_at(size_type __i, _Args&&... __args)
+      {
+        _Alloc __a(__slot_allocator());
+
+        try {
+          slot_policy::__construct(__a, m_impl.m_slots + __i, std::forward<_Args>(__args)...);
+        } catch ( ... ) {
+          __erase_meta_only(__i);
+          throw;
+        }
+      }
+
+      /// @brief Free slot __i, whose value is already destroyed.
+      /// @details The slot becomes empty again if no probe can have passed it: that is, if
+      /// the run of full or deleted slots around it is shorter than a group, since every
+      /// lookup loads whole groups and stops at the first one holding an empty slot.
+      void
+      __erase_meta_only(size_type __i) noexcept
+      {
+        const size_type               __before      = ( __i - group::width ) & m_impl.m_capacity;
+        const typename group::bitmask __empty_after  = group(m_impl.m_ctrl + __i).__match_empty();
+        const typename group::bitmask __empty_before = group(m_impl.m_ctrl + __before).__match_empty();
+        const bool                    __never_full   = __empty_before && __empty_after
+          && __empty_after.__trailing_zeros() + __empty_before.__leading_zeros() < group::width;
+
+        --m_impl.m_size;
+        __set_ctrl(__i, __never_full ? hash_table_empty : hash_table_deleted);
+        m_impl.m_growthLeft += __never_full;
+      }
+
+      /// @brief Make room for one more element: drop the tombstones if they take much of
+      /// the table, otherwise double the capacity.
+      void
+      __rehash_and_grow()
+      {
+        if ( m_impl.m_capacity > group::width && m_impl.m_size * 32 <= m_impl.m_capacity * 25 )
+          __resize(m_impl.m_capacity);
+        else
+          __resize(m_impl.m_capacity * 2 + 1);
+      }
+
+      /// @brief Allocate __capacity slots and move every element into them.
+      /// @details Only the new allocation can throw; the elements are moved afterwards and
+      /// the old storage released.
+      void
+      __resize(size_type __capacity)
+      {
+        hash_table_ctrl* const __old_ctrl     = m_impl.m_ctrl;
+        slot_type* const       __old_slots    = m_impl.m_slots;
+        const size_type        __old_capacity = m_impl.m_capacity;
+        _Alloc                 __a(__slot_allocator());
+
+        __initialize(__capacity);
+        for ( size_type __i = 0; __i < __old_capacity; ++__i ) {
+          if ( !__ctrl_is_full(__old_ctrl[__i]) ) continue;
+
+          const size_type __h = __hash(_KeyOfValue()(slot_policy::__element(__old_slots + __i)));
+          const size_type __j = __find_first_non_full(__h);
+          __set_ctrl(__j, __h2(__h));
+          slot_policy::__transfer(__a, m_impl.m_slots + __j, __old_slots + __i);
+        }
+        if ( __old_capacity != 0 )
+          slot_alloc_traits::deallocate(__slot_allocator(), __old_slots, __allocation_units(__old_capacity));
+      }
+
+      /// @brief Allocate storage for __capacity slots, all empty; the size is kept.
+      void
+      __initialize(size_type __capacity)
+      {
+        slot_type* const __slots = slot_alloc_traits::allocate(__slot_allocator(), __allocation_units(__capacity));
+
+        m_impl.m_slots    = __slots;
+        m_impl.m_ctrl     = reinterpret_cast<hash_table_ctrl*>(__slots + __capacity);
+        m_impl.m_capacity = __capacity;
+        __reset_ctrl();
+      }
+
+      /// @brief Mark every slot empty and recompute the growth budget from the size.
+      void
+      __reset_ctrl() noexcept
+      {
+        std::memset(m_impl.m_ctrl, static_cast<unsigned char>(hash_table_empty), m_impl.m_capacity + group::width);
+        m_impl.m_ctrl[m_impl.m_capacity] = hash_table_sentinel;
+        m_impl.m_growthLeft = __capacity_to_growth(m_impl.m_capacity) - m_impl.m_size;
+      }
+
+      /// @brief Destroy the elements, keeping the control bytes as they are.
+      void
+      __destroy_all() noexcept
+      {
+        if ( slot_policy::__trivial_destroy ) return;
+
+        _Alloc __a(__slot_allocator());
+        for ( size_type __i = 0; __i < m_impl.m_capacity; ++__i )
+          if ( __ctrl_is_full(m_impl.m_ctrl[__i]) ) slot_policy::__destroy(__a, m_impl.m_slots + __i);
+      }
+
+      /// @brief Destroy the elements and free the storage, leaving the table empty.
+      void
+      __release() noexcept
+      {
+        if ( m_impl.m_capacity == 0 ) return;
+        __destroy_all();
+        slot_alloc_traits::deallocate(__slot_allocator(), m_impl.m_slots, __allocation_units(m_impl.m_capacity));
+        m_impl.__reset();
+      }
+
+      /// @brief Insert copies of the elements of __x into this (empty) table.
+      /// @details The keys are known to be distinct, so no key is compared.
+      void
+      __copy(const hash_table& __x)
+      {
+        if ( __x.empty() ) return;
+
+        try {
+          reserve(__x.size());
+          for ( const_iterator __i = __x.begin(); __i != __x.end(); ++__i )
+            __construct_at(__prepare_insert(__hash(_KeyOfValue()(*__i))), *__i);
+        } catch ( ... ) {
+          __release();
+          throw;
+        }
+      }
+
+      void
+      __move_assign(hash_table& __x, std::true_type) noexcept
+      {
+        __release();
+        m_impl.m_ctrl       = __x.m_impl.m_ctrl;
+        m_impl.m_slots      = __x.m_impl.m_slots;
+        m_impl.m_size       = __x.m_impl.m_size;
+        m_impl.m_capacity   = __x.m_impl.m_capacity;
+        m_impl.m_growthLeft = __x.m_impl.m_growthLeft;
+        __x.m_impl.__reset();
+        __alloc_on_move(__x, typename slot_alloc_traits::propagate_on_container_move_assignment());
+      }
+
+      void
+      __move_assign(hash_table& __x, std::false_type)
+      {
+        if ( __slot_allocator() == __x.__slot_allocator() ) {
+          __move_assign(__x, std::true_type());
+          return;
+        }
+        __release();
+        reserve(__x.size());
+        for ( iterator __i = __x.begin(); __i != __x.end(); ++__i )
+          __construct_at(__prepare_insert(__hash(_KeyOfValue()(*__i))), std::move(*__i));
+        __x.__release();
+      }
+
+      void
+      __alloc_on_copy(const hash_table& __x, std::true_type) { __slot_allocator() = __x.__slot_allocator(); }
+
+      void
+      __alloc_on_copy(const hash_table&, std::false_type) { }
+
+      void
+      __alloc_on_move(hash_table& __x, std::true_type) { __slot_allocator() = std::move(__x.__slot_allocator()); }
+
+      void
+      __alloc_on_move(hash_table&, std::false_type) { }
+
+      void
+      __alloc_on_swap(hash_table& __x, std::true_type) { std::swap(__slot_allocator(), __x.__slot_allocator()); }
+
+      void
+      __alloc_on_swap(hash_table&, std::false_type) { }
+  };
+
+  /// @brief Whether two tables hold the same elements, in any order.
+  /// @details Each element of __x is looked up in __y, so this is O(n) on average.
+  template <typename _Key, typename _Val, typename _KeyOfValue, typename _Hash, typename _Equal, typename _Alloc, bool _N>
+  inline bool
+  operator==(const hash_table<_Key, _Val, _KeyOfValue, _Hash, _Equal, _Alloc, _N>& __x,
+             const hash_table<_Key, _Val, _KeyOfValue, _Hash, _Equal, _Alloc, _N>& __y)
+  {
+    if ( __x.size() != __y.size() ) return false;
+    for ( auto __i = __x.begin(); __i != __x.end(); ++__i ) {
+      auto __j = __y.find(_KeyOfValue()(*__i));
+
+      if ( __j == __y.end() || !( *__j == *__i ) ) return false;
+    }
+    return true;
+  }
+
+} // namespace ft
+
+#endif // __FT_HASH_TABLE__
@@ -0,0 +1,244 @@
+#ifndef   __FT_HASH_TABLE_GROUP__
+# define  __FT_HASH_TABLE_GROUP__
+
+# include <cstddef> // For std::size_t
+# include <cstdint> // For std::uint32_t, std::uint64_t
+# include <cstring> // For std::memcpy
+
+# if defined(__SSE2__)
+#  include <emmintrin.h> // For __m128i, _mm_loadu_si128, _mm_cmpeq_epi8, _mm_cmpgt_epi8, _mm_movemask_epi8
+# endif
+
+namespace ft {
+
+  /// @brief The control byte of a hash table slot.
+  /// @details A full slot stores the low 7 bits of the hash of its key (its H2), so the
+  /// byte is in [0, 127]. The other states have the high bit set:
+  /// - `hash_table_empty` (0b10000000): never used, or freed where no probe passed through;
+  /// - `hash_table_deleted` (0b11111110): freed while some probe may pass through it;
+  /// - `hash_table_sentinel` (0b11111111): the byte after the last slot, where iteration stops.
+  using hash_table_ctrl = signed char;
+
+  constexpr hash_table_ctrl hash_table_empty    = -128; ///< A free slot that ends probing.
+  constexpr hash_table_ctrl hash_table_deleted  = -2;   ///< A free slot that probing goes past.
+  constexpr hash_table_ctrl hash_table_sentinel = -1;   ///< The end marker after the last slot.
+
+  inline bool __ctrl_is_full(hash_table_ctrl __c) noexcept { return __c >= 0; }
+  inline bool __ctrl_is_empty(hash_table_ctrl __c) noexcept { return __c == hash_table_empty; }
+  inline bool __ctrl_is_deleted(hash_table_ctrl __c) noexcept { return __c == hash_table_deleted; }
+  inline bool __ctrl_is_empty_or_deleted(hash_table_ctrl __c) noexcept { return __c < hash_table_sentinel; }
+
+  /// @brief The control bytes of a table without slots: one sentinel then empty bytes.
+  /// @details Lets an empty table probe and iterate without any allocation or branch on
+  /// its capacity; it is never written to.
+  alignas(16) inline constexpr hash_table_ctrl hash_table_empty_group[16] = {
+    hash_table_sentinel, hash_table_empty, hash_table_empty, hash_table_empty,
+    hash_table_empty,    hash_table_empty, hash_table_empty, hash_table_empty,
+    hash_table_empty,    hash_table_empty, hash_table_empty, hash_table_empty,
+    hash_table_empty,    hash_table_empty, hash_table_empty, hash_table_empty
+  };
+
+  /// @brief Number of trailing zero bits of a non-zero word.
+  inline unsigned int
+  __hash_table_ctz(std::uint64_t __x) noexcept
+  {
+# if defined(__GNUC__)
+    return static_cast<unsigned int>(__builtin_ctzll(__x));
+# else
+    unsigned int __n = 0;
+    for ( ; ( __x & 1 ) == 0; __x >>= 1 ) ++__n;
+    return __n;
+# endif
+  }
+
+  /// @brief Number of leading zero bits of a non-zero word.
+  inline unsigned int
+  __hash_table_clz(std::uint64_t __x) noexcept
+  {
+# if defined(__GNUC__)
+    return static_cast<unsigned int>(__builtin_clzll(__x));
+# else
+    unsigned int __n = 0;
+    for ( ; ( __x & ( std::uint64_t(1) << 63 ) ) == 0; __x <<= 1 ) ++__n;
+    return __n;
+# endif
+  }
+
+  /// @brief The set of slots of a group that matched a query, one bit per slot.
+  /// @details Slot __i of the group is bit `__i << _Shift` of the mask, so a mask from the
+  /// SSE2 group has one bit per slot and a mask from the portable group one byte per slot.
+  /// Iterate with `while ( __m ) { use(__m.__lowest()); __m.__clear_lowest(); }`.
+  /// @tparam _Width The number of slots in a group.
+  /// @tparam _Shift The log2 of the bits per slot.
+  template <std::size_t _Width, unsigned int _Shift>
+  class hash_table_bitmask
+  {
+    public:
+      explicit
+      hash_table_bitmask(std::uint64_t __mask) noexcept : m_mask{ __mask } { }
+
+      explicit
+      operator bool() const noexcept { return m_mask != 0; }
+
+      /// @brief The lowest matching slot. The mask must not be empty.
+      std::size_t
+      __lowest() const noexcept { return __hash_table_ctz(m_mask) >> _Shift; }
+
+      void
+      __clear_lowest() noexcept { m_mask &= m_mask - 1; }
+
+      /// @brief The number of slots before the first match. The mask must not be empty.
+      std::size_t
+      __trailing_zeros() const noexcept { return __hash_table_ctz(m_mask) >> _Shift; }
+
+      /// @brief The number of slots after the last match. The mask must not be empty.
+      std::size_t
+      __leading_zeros() const noexcept
+      {
+        return __hash_table_clz(m_mask << ( 64 - ( _Width << _Shift ) )) >> _Shift;
+      }
+
+    private:
+      std::uint64_t m_mask; ///< The matching slots.
+  };
+
+# if defined(__SSE2__)
+
+  /// @brief A window of 16 control bytes, matched all at once with SSE2.
+  /// @details Each query is one compare and one `movemask`, so a lookup usually settles
+  /// 16 candidate slots with a handful of instructions and then compares one key.
+  class hash_table_group
+  {
+    public:
+      static constexpr std::size_t width = 16; ///< The number of control bytes in a group.
+
+      using bitmask = hash_table_bitmask<width, 0>;
+
+      /// @brief Load the control bytes at __p, which need not be aligned.
+      explicit
+      hash_table_group(const hash_table_ctrl* __p) noexcept
+        : m_ctrl{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(__p)) } { }
+
+      /// @brief The full slots whose H2 is __h2.
+      bitmask
+      __match(hash_table_ctrl __h2) const noexcept
+      {
+        return bitmask(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(__h2), m_ctrl))));
+      }
+
+      /// @brief The empty slots.
+      bitmask
+      __match_empty() const noexcept { return __match(hash_table_empty); }
+
+      /// @brief The empty and deleted slots, the bytes below the sentinel.
+      bitmask
+      __match_empty_or_deleted() const noexcept
+      {
+        const __m128i __special = _mm_set1_epi8(hash_table_sentinel);
+        return bitmask(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(__special, m_ctrl))));
+      }
+
+      /// @brief The number of empty or deleted slots at the start of the group.
+      std::size_t
+      __count_leading_empty_or_deleted() const noexcept
+      {
+        const __m128i __special = _mm_set1_epi8(hash_table_sentinel);
+        // Adding one turns the run of low set bits into zeros and the first clear bit into a one.
+        return __hash_table_ctz(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(__special, m_ctrl))) + 1);
+      }
+
+    private:
+      __m128i m_ctrl; ///< The control bytes.
+  };
+
+# else
+
+  /// @brief A window of 8 control bytes, matched all at once with 64-bit arithmetic.
+  /// @details The fallback where SSE2 is not available. The bytes are read as one
+  /// little-endian word and every query is a few word operations. `__match` may report a
+  /// false positive, but only on a full slot right after a true match, so callers that
+  /// compare the keys anyway need not care.
+  class hash_table_group
+  {
+    public:
+      static constexpr std::size_t width = 8; ///< The number of control bytes in a group.
+
+      using bitmask = hash_table_bitmask<width, 3>;
+
+      /// @brief Load the control bytes at __p, which need not be aligned.
+      explicit
+      hash_table_group(const hash_table_ctrl* __p) noexcept
+        : m_ctrl{ 0 }
+      {
+        unsigned char __b[width];
+
+        std::memcpy(__b, __p, width);
+        for ( std::size_t __i = 0; __i < width; ++__i ) m_ctrl |= std::uint64_t(__b[__i]) << ( 8 * __i );
+      }
+
+      /// @brief The full slots whose H2 is __h2, give or take a false positive.
+      bitmask
+      __match(hash_table_ctrl __h2) const noexcept
+      {
+        const std::uint64_t __x = m_ctrl ^ ( __lsbs * static_cast<unsigned char>(__h2) );
+        return bitmask(( __x - __lsbs ) & ~__x & __msbs);
+      }
+
+      /// @brief The empty slots: high bit set and bit 1 clear.
+      bitmask
+      __match_empty() const noexcept { return bitmask(m_ctrl & ( ~m_ctrl << 6 ) & __msbs); }
+
+      /// @brief The empty and deleted slots: high bit set and bit 0 clear.
+      bitmask
+      __match_empty_or_deleted() const noexcept { return bitmask(m_ctrl & ( ~m_ctrl << 7 ) & __msbs); }
+
+      /// @brief The number of empty or deleted slots at the start of the group.
+      std::size_t
+      __count_leading_empty_or_deleted() const noexcept
+      {
+        const std::uint64_t __gaps = 0x00FEFEFEFEFEFEFEull;
+        return ( __hash_table_ctz(( ( ~m_ctrl & ( m_ctrl >> 7 ) ) | __gaps ) + 1) + 7 ) >> 3;
+      }
+
+    private:
+      static constexpr std::uint64_t __lsbs = 0x0101010101010101ull;
+      static constexpr std::uint64_t __msbs = 0x8080808080808080ull;
+
+      std::uint64_t m_ctrl; ///< The control bytes, the first one in the low byte.
+  };
+
+# endif
+
+  /// @brief The sequence of groups a key probes, starting where its hash points.
+  /// @details Triangular probing over groups: the i-th step moves i groups further. With a
+  /// capacity of 2^k - 1 this visits every group once before repeating.
+  class hash_table_probe
+  {
+    public:
+      hash_table_probe(std::size_t __hash, std::size_t __mask) noexcept
+        : m_mask{ __mask }, m_offset{ __hash & __mask }, m_index{ 0 } { }
+
+      /// @brief The slot where the current group starts.
+      std::size_t
+      __offset() const noexcept { return m_offset; }
+
+      /// @brief The slot __i places into the current group.
+      std::size_t
+      __offset(std::size_t __i) const noexcept { return ( m_offset + __i ) & m_mask; }
+
+      void
+      __next() noexcept
+      {
+        m_index  += hash_table_group::width;
+        m_offset  = ( m_offset + m_index ) & m_mask;
+      }
+
+    private:
+      std::size_t m_mask;   ///< The capacity, 2^k - 1.
+      std::size_t m_offset; ///< The first slot of the current group.
+      std::size_t m_index;  ///< The distance travelled, in slots.
+  };
+
+} // namespace ft
+
+#endif // __FT_HASH_TABLE_GROUP__
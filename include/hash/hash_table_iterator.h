@@ -0,0 +1,167 @@
+#ifndef   __FT_HASH_TABLE_ITERATOR__
+# define  __FT_HASH_TABLE_ITERATOR__
+
+# include <cstddef> // For std::ptrdiff_t
+
+# include "../iterator/iterator_base_types.h" // For forward_iterator_tag
+# include "hash_table_group.h"                // For hash_table_ctrl, hash_table_group, __ctrl_is_empty_or_deleted
+
+namespace ft {
+
+  /// @brief Move a control and slot position forward to the first full slot or the sentinel.
+  /// @details Skips a group's worth of free slots per step.
+  template <typename _Slot>
+  inline void
+  __hash_table_skip_free(const hash_table_ctrl*& __ctrl, _Slot*& __slot) noexcept
+  {
+    while ( __ctrl_is_empty_or_deleted(*__ctrl) ) {
+      const std::size_t __shift = hash_table_group(__ctrl).__count_leading_empty_or_deleted();
+
+      __ctrl += __shift;
+      __slot += __shift;
+    }
+  }
+
+  /// @brief Forward iterator over the values of a hash table.
+  /// @details The iterator holds a control byte and the slot it describes. Incrementing
+  /// skips free slots a group at a time and stops at the sentinel after the last slot,
+  /// which is where `end()` points.
+  ///
+  /// A rehash, which any insertion may cause, invalidates every iterator. Erasure only
+  /// invalidates iterators to the erased element.
+  ///
+  /// @tparam _Policy The slot layout, a `hash_table_slot`.
+  template <typename _Val, typename _Policy>
+  struct hash_table_iterator
+  {
+    using value_type        = _Val;                 ///< The type of the value pointed to by the iterator.
+    using reference         = value_type&;          ///< Reference type to the value.
+    using pointer           = value_type*;          ///< Pointer type to the value.
+    using iterator_category = forward_iterator_tag; ///< The category of the iterator.
+    using difference_type   = std::ptrdiff_t;       ///< The type used for representing the difference between two iterators.
+
+    using self      = hash_table_iterator<_Val, _Policy>;
+    using slot_type = typename _Policy::slot_type;
+
+    const hash_table_ctrl* m_ctrl; ///< The control byte of the slot.
+    slot_type*             m_slot; ///< The slot.
+
+    /// @brief Default constructor.
+    hash_table_iterator() noexcept
+      : m_ctrl{ }, m_slot{ } { }
+
+    /// @brief Constructor from a full slot or the sentinel.
+    hash_table_iterator(const hash_table_ctrl* __ctrl, slot_type* __slot) noexcept
+      : m_ctrl{ __ctrl }, m_slot{ __slot } { }
+
+    /// @brief Dereference operator.
+    /// @return A reference to the value in the slot.
+    reference
+    operator*() const noexcept { return _Policy::__element(m_slot); }
+
+    /// @brief Arrow operator.
+    /// @return A pointer to the value in the slot.
+    pointer
+    operator->() const noexcept { return &_Policy::__element(m_slot); }
+
+    /// @brief Pre-increment operator.
+    self&
+    operator++() noexcept
+    {
+      ++m_ctrl;
+      ++m_slot;
+      __hash_table_skip_free(m_ctrl, m_slot);
+      return *this;
+    }
+
+    /// @brief Post-increment operator.
+    self
+    operator++(int) noexcept
+    {
+      self __tmp = *this;
+      ++*this;
+      return __tmp;
+    }
+
+    friend bool
+    operator==(const self& __x, const self& __y) noexcept { return __x.m_ctrl == __y.m_ctrl; }
+
+    friend bool
+    operator!=(const self& __x, const self& __y) noexcept { return __x.m_ctrl != __y.m_ctrl; }
+  };
+
+  /// @brief Constant forward iterator over the values of a hash table.
+  /// @details Implicitly constructible from the mutable iterator, and comparable with it.
+  template <typename _Val, typename _Policy>
+  struct hash_table_const_iterator
+  {
+    using value_type        = _Val;                 ///< The type of the value pointed to by the iterator.
+    using reference         = const value_type&;    ///< Reference type to the value.
+    using pointer           = const value_type*;    ///< Pointer type to the value.
+    using iterator_category = forward_iterator_tag; ///< The category of the iterator.
+    using difference_type   = std::ptrdiff_t;       ///< The type used for representing the difference between two iterators.
+
+    using iterator  = hash_table_iterator<_Val, _Policy>;
+    using self      = hash_table_const_iterator<_Val, _Policy>;
+    using slot_type = typename _Policy::slot_type;
+
+    const hash_table_ctrl* m_ctrl; ///< The control byte of the slot.
+    slot_type*             m_slot; ///< The slot.
+
+    /// @brief Default constructor.
+    hash_table_const_iterator() noexcept
+      : m_ctrl{ }, m_slot{ } { }
+
+    /// @brief Constructor from a full slot or the sentinel.
+    hash_table_const_iterator(const hash_table_ctrl* __ctrl, slot_type* __slot) noexcept
+      : m_ctrl{ __ctrl }, m_slot{ __slot } { }
+
+    /// @brief Converting constructor from a mutable iterator.
+    /// @param __it The iterator to convert.
+    hash_table_const_iterator(const iterator& __it) noexcept
+      : m_ctrl{ __it.m_ctrl }, m_slot{ __it.m_slot } { }
+
+    /// @brief Get a mutable iterator to the same slot.
+    /// @details Used by the table to implement erase on const iterators.
+    iterator
+    __const_cast() const noexcept { return iterator(m_ctrl, m_slot); }
+
+    /// @brief Dereference operator.
+    /// @return A const reference to the value in the slot.
+    reference
+    operator*() const noexcept { return _Policy::__element(m_slot); }
+
+    /// @brief Arrow operator.
+    /// @return A const pointer to the value in the slot.
+    pointer
+    operator->() const noexcept { return &_Policy::__element(m_slot); }
+
+    /// @brief Pre-increment operator.
+    self&
+    operator++() noexcept
+    {
+      ++m_ctrl;
+      ++m_slot;
+      __hash_table_skip_free(m_ctrl, m_slot);
+      return *this;
+    }
+
+    /// @brief Post-increment operator.
+    self
+    operator++(int) noexcept
+    {
+      self __tmp = *this;
+      ++*this;
+      return __tmp;
+    }
+
+    friend bool
+    operator==(const self& __x, const self& __y) noexcept { return __x.m_ctrl == __y.m_ctrl; }
+
+    friend bool
+    operator!=(const self& __x, const self& __y) noexcept { return __x.m_ctrl != __y.m_ctrl; }
+  };
+
+} // namespace ft
+
+#endif // __FT_HASH_TABLE_ITERATOR__
@@ -0,0 +1,211 @@
+#ifndef   __FT_HASH_TABLE_POLICY__
+# define  __FT_HASH_TABLE_POLICY__
+
+# include <cstddef>     // For std::size_t
+# include <cstdint>     // For std::uint64_t
+# include <memory>      // For std::allocator_traits
+# include <type_traits> // For std::enable_if_t, std::is_empty, std::is_final, std::is_trivially_destructible
+# include <utility>     // For std::move, std::forward
+
+# include "../utility/pair.h"               // For ft::pair
+# include "../tree/rb_tree_key_compare.h"   // For is_transparent_compare
+
+namespace ft {
+
+  /// @brief SFINAE helper, well-formed only if both the hash and the key equality are transparent.
+  /// @details Used to enable the heterogeneous lookup overloads of the hash containers. Both
+  /// must opt in, as a key type other than `key_type` has to hash like the key it stands for.
+  template <typename _Hash, typename _Equal, typename _Kt>
+  using has_transparent_hash_t = std::enable_if_t<is_transparent_compare<_Hash>::value &&
+                                                  is_transparent_compare<_Equal>::value, _Kt>;
+
+  /// @brief Scatter the bits of a hash over the whole word.
+  /// @details Both halves of the hash are used: the high bits choose where probing starts
+  /// and the low 7 bits go into the control byte. `std::hash` of an integer is often the
+  /// identity, so keys that differ only in their high bits would otherwise share control
+  /// bytes and keys that are multiples of a power of two share start groups. One wide
+  /// multiplication folds every input bit into both halves.
+  inline std::size_t
+  __hash_table_mix(std::size_t __h) noexcept
+  {
+# if defined(__SIZEOF_INT128__)
+    const unsigned __int128 __m = static_cast<unsigned __int128>(__h) * 0x9E3779B97F4A7C15ull;
+    return static_cast<std::size_t>(static_cast<std::uint64_t>(__m) ^ static_cast<std::uint64_t>(__m >> 64));
+# else
+    std::uint64_t __x = static_cast<std::uint64_t>(__h);
+    __x ^= __x >> 33;
+    __x *= 0xff51afd7ed558ccdull;
+    __x ^= __x >> 33;
+    return static_cast<std::size_t>(__x);
+# endif
+  }
+
+  /// @brief Holder of the hash function of a table.
+  /// @details Stateless hash functions are held as a base class (see the specialization
+  /// below), so they take no space in the table object, like `rb_tree_key_compare`.
+  template <typename _Hash, bool = std::is_empty<_Hash>::value && !std::is_final<_Hash>::value>
+  struct hash_table_hasher
+  {
+    _Hash m_hash; ///< The hash function.
+
+    hash_table_hasher() : m_hash{ } { }
+
+    hash_table_hasher(const _Hash& __h) : m_hash{ __h } { }
+
+    _Hash&
+    __hasher() noexcept { return m_hash; }
+
+    const _Hash&
+    __hasher() const noexcept { return m_hash; }
+  };
+
+  /// @brief Specialization for empty hash functions, stored through the empty-base optimization.
+  template <typename _Hash>
+  struct hash_table_hasher<_Hash, true> : private _Hash
+  {
+    hash_table_hasher() : _Hash() { }
+
+    hash_table_hasher(const _Hash& __h) : _Hash(__h) { }
+
+    _Hash&
+    __hasher() noexcept { return *this; }
+
+    const _Hash&
+    __hasher() const noexcept { return *this; }
+  };
+
+  /// @brief Holder of the key equality of a table, see `hash_table_hasher`.
+  template <typename _Equal, bool = std::is_empty<_Equal>::value && !std::is_final<_Equal>::value>
+  struct hash_table_key_equal
+  {
+    _Equal m_equal; ///< The key equality.
+
+    hash_table_key_equal() : m_equal{ } { }
+
+    hash_table_key_equal(const _Equal& __e) : m_equal{ __e } { }
+
+    _Equal&
+    __key_eq() noexcept { return m_equal; }
+
+    const _Equal&
+    __key_eq() const noexcept { return m_equal; }
+  };
+
+  /// @brief Specialization for empty key equalities, stored through the empty-base optimization.
+  template <typename _Equal>
+  struct hash_table_key_equal<_Equal, true> : private _Equal
+  {
+    hash_table_key_equal() : _Equal() { }
+
+    hash_table_key_equal(const _Equal& __e) : _Equal(__e) { }
+
+    _Equal&
+    __key_eq() noexcept { return *this; }
+
+    const _Equal&
+    __key_eq() const noexcept { return *this; }
+  };
+
+  /// @brief What a slot of a hash table holds, and how values get in and out of it.
+  /// @details The flat layout stores the values in the slot array itself: lookups read the
+  /// control byte and then the value next to its neighbours, with no pointer to chase, but
+  /// a rehash moves every value and invalidates references to them.
+  ///
+  /// The node-stable layout (specialization below) stores a pointer to a separately
+  /// allocated value, so a value never moves for as long as it is in the table.
+  template <typename _Val, typename _Alloc, bool _NodeStable>
+  struct hash_table_slot
+  {
+    using slot_type          = _Val;                          ///< The contents of a slot.
+    using value_alloc_traits = std::allocator_traits<_Alloc>; ///< The traits of the value allocator.
+
+    static _Val&
+    __element(slot_type* __s) noexcept { return *__s; }
+
+    static const _Val&
+    __element(const slot_type* __s) noexcept { return *__s; }
+
+    template <typename... _Args>
+    static void
+    __construct(_Alloc& __a, slot_type* __s, _Args&&... __args)
+    {
+      value_alloc_traits::construct(__a, __s, std::forward<_Args>(__args)...);
+    }
+
+    static void
+    __destroy(_Alloc& __a, slot_type* __s) noexcept { value_alloc_traits::destroy(__a, __s); }
+
+    /// @brief Move the value of __src into the unconstructed slot __dst and end __src.
+    static void
+    __transfer(_Alloc& __a, slot_type* __dst, slot_type* __src) noexcept
+    {
+      __relocate(__a, __dst, *__src);
+      value_alloc_traits::destroy(__a, __src);
+    }
+
+    /// @brief Whether destroying a value does nothing, so clearing can skip the slots.
+    static constexpr bool __trivial_destroy = std::is_trivially_destructible<_Val>::value;
+
+    private:
+      template <typename _V>
+      static void
+      __relocate(_Alloc& __a, slot_type* __dst, _V& __src) noexcept
+      {
+        value_alloc_traits::construct(__a, __dst, std::move(__src));
+      }
+
+      /// @brief The key of a map element is const, so moving the pair would copy it; the
+      /// source is destroyed right after, so the key can be moved from, as in `node_handle::key()`.
+      template <typename _K, typename _T>
+      static void
+      __relocate(_Alloc& __a, slot_type* __dst, ft::pair<const _K, _T>& __src) noexcept
+      {
+        value_alloc_traits::construct(__a, __dst, std::move(const_cast<_K&>(__src.first)), std::move(__src.second));
+      }
+  };
+
+  /// @brief Specialization for the node-stable layout: a slot points to its value.
+  template <typename _Val, typename _Alloc>
+  struct hash_table_slot<_Val, _Alloc, true>
+  {
+    using slot_type          = _Val*;                         ///< The contents of a slot.
+    using value_alloc_traits = std::allocator_traits<_Alloc>; ///< The traits of the value allocator.
+
+    static _Val&
+    __element(slot_type* __s) noexcept { return **__s; }
+
+    static const _Val&
+    __element(const slot_type* __s) noexcept { return **__s; }
+
+    template <typename... _Args>
+    static void
+    __construct(_Alloc& __a, slot_type* __s, _Args&&... __args)
+    {
+      _Val* __p = value_alloc_traits::allocate(__a, 1);
+
+      try {
+        value_alloc_traits::construct(__a, __p, std::forward<_Args>(__args)...);
+      } catch ( ... ) {
+        value_alloc_traits::deallocate(__a, __p, 1);
+        throw;
+      }
+      *__s = __p;
+    }
+
+    static void
+    __destroy(_Alloc& __a, slot_type* __s) noexcept
+    {
+      value_alloc_traits::destroy(__a, *__s);
+      value_alloc_traits::deallocate(__a, *__s, 1);
+    }
+
+    /// @brief Move the pointer of __src into __dst; the value stays where it is.
+    static void
+    __transfer(_Alloc&, slot_type* __dst, slot_type* __src) noexcept { *__dst = *__src; }
+
+    static constexpr bool __trivial_destroy = false;
+  };
+
+} // namespace ft
+
+#endif // __FT_HASH_TABLE_POLICY__
@@ -2,7 +2,7 @@
 # define  __FT_ITERATOR__
 
 # include "iterator_base_types.h"
-# include "iterator_base_funcs.h"
+# include "iterator_base_functions.h"
 # include "reverse_iterator.h"
 
 #endif // __FT_ITERATOR__
\ No newline at end of file
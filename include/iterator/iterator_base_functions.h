@@ -42,6 +42,15 @@ namespace ft {
     return __last - __first;
   }
 
+  /// @brief A helper function to calculate the distance between two order-statistic iterators.
+  /// @details Delegates to the iterator, which computes it in O(log n).
+  template <typename _Iter>
+  inline difference_type_t<_Iter>
+  __distance(_Iter __first, _Iter __last, order_statistic_iterator_tag)
+  {
+    return _Iter::__order_distance(__first, __last);
+  }
+
   /// @brief A function to calculate the distance between two iterators.
   /// @details This function computes the number of increments needed to go from the first iterator to the second.
   /// It is a generalization of pointer arithmetic.
@@ -50,7 +59,7 @@ namespace ft {
   difference_type_t<_InputIterator>
   distance(_InputIterator __first, _InputIterator __last)
   {
-    return ft::__distance(__first, __last, ft::__iterator_category(__first));
+    return ft::__distance(__first, __last, dispatch_category_t<_InputIterator>());
   }
 
   /// @brief A function to advance an iterator by a specified number of steps.
@@ -85,13 +94,22 @@ namespace ft {
     __i += __n;
   }
 
+  /// @brief A function to advance an order-statistic iterator by a specified number of steps.
+  /// @details Delegates to the iterator, which moves in O(log n) whatever the number of steps.
+  template <typename _Iter, typename _Distance>
+  inline void
+  __advance(_Iter& __i, _Distance __n, order_statistic_iterator_tag)
+  {
+    _Iter::__order_advance(__i, static_cast<difference_type_t<_Iter>>(__n));
+  }
+
   /// @brief A function to advance an iterator by a specified number of steps.
   /// @details This function modifies the iterator by moving it forward or backward by the specified number of steps.
   template <typename _InputIterator, typename _Distance>
   inline constexpr void
   advance(_InputIterator& __i, _Distance __n)
   {
-    ft::__advance(__i, __n, ft::__iterator_category(__i));
+    ft::__advance(__i, __n, dispatch_category_t<_InputIterator>());
   }
 
   /// @brief A function to get the next iterator.
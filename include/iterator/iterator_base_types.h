@@ -1,7 +1,8 @@
 #ifndef   __FT_ITERATOR_BASE_TYPES__
 # define  __FT_ITERATOR_BASE_TYPES__
 
-# include <cstddef> // For std::ptrdiff_t
+# include <cstddef>     // For std::ptrdiff_t
+# include <type_traits> // For std::void_t
 
 namespace ft {
 
@@ -13,6 +14,13 @@ namespace ft {
   struct bidirectional_iterator_tag : public forward_iterator_tag { };
   struct random_access_iterator_tag : public bidirectional_iterator_tag { };
 
+  /// @brief Dispatch tag of iterators that can measure distances and advance in O(log n).
+  /// @details It is not an iterator category: an iterator opts in by naming it as its
+  /// `order_statistic_category` and providing static `__order_distance(first, last)` and
+  /// `__order_advance(it, n)`, which `ft::distance` and `ft::advance` then call instead of
+  /// stepping one position at a time.
+  struct order_statistic_iterator_tag { };
+
   /// @brief iterator class template.
   /// @details This class template provides a common interface for iterators.
   /// It defines the types and operations that all iterators should support.
@@ -92,6 +100,25 @@ namespace ft {
   template <typename _Iter>
   using reference_t = typename iterator_traits<_Iter>::reference;
 
+  /// @brief The tag `ft::distance` and `ft::advance` dispatch on.
+  /// @details The iterator's `order_statistic_category` if it declares one, its iterator
+  /// category otherwise.
+  template <typename _Iter, typename = void>
+  struct dispatch_category
+  {
+    using type = iterator_category_t<_Iter>; ///< The tag to dispatch on.
+  };
+
+  template <typename _Iter>
+  struct dispatch_category<_Iter, std::void_t<typename _Iter::order_statistic_category>>
+  {
+    using type = typename _Iter::order_statistic_category; ///< The tag to dispatch on.
+  };
+
+  /// @brief A type alias for the dispatch tag of an iterator.
+  template <typename _Iter>
+  using dispatch_category_t = typename dispatch_category<_Iter>::type;
+
 } // namespace ft
 
 #endif // __FT_ITERATOR_BASE_TYPES__
\ No newline at end of file
@@ -69,8 +69,15 @@ namespace ft {
 
       /// @brief Arrow operator.
       /// @return A pointer to the value pointed to by the iterator.
+      /// @details Class iterators are asked for their own arrow result, so iterators whose
+      /// reference is a proxy (such as the one of `flat_map`) work too.
       constexpr pointer
-      operator->() const { return &this->operator*(); }
+      operator->() const
+      {
+        iterator_type __tmp = m_current;
+        --__tmp;
+        return __to_pointer(__tmp);
+      }
 
     public:
       /// @brief Pre-increment operator.
@@ -150,6 +157,15 @@ namespace ft {
         return *this;
       }
 
+    private:
+      template <typename _Tp>
+      static constexpr _Tp*
+      __to_pointer(_Tp* __p) { return __p; }
+
+      template <typename _Tp>
+      static constexpr pointer
+      __to_pointer(_Tp __it) { return __it.operator->(); }
+
     private:
       iterator_type m_current; ///< The current position of the reverse iterator.
 
@@ -0,0 +1,486 @@
+#ifndef   __FT_CONCURRENT_MAP__
+# define  __FT_CONCURRENT_MAP__
+
+# include <atomic>      // For std::atomic
+# include <cstddef>     // For std::size_t, std::ptrdiff_t
+# include <functional>  // For std::less
+# include <memory>      // For std::allocator, std::allocator_traits
+# include <mutex>       // For std::mutex, std::lock_guard
+# include <tuple>       // For std::forward_as_tuple
+# include <type_traits> // For std::enable_if_t, std::is_same
+# include <utility>     // For std::move, std::forward, std::in_place
+# include <vector>      // For std::vector
+
+# include "../memory/epoch_domain.h"         // For epoch_domain
+# include "../tree/rb_tree_key_compare.h"    // For rb_tree_key_compare, is_transparent_compare, has_is_transparent_t
+# include "../tree/rb_tree_node.h"           // For rb_tree_node
+# include "../tree/rb_tree_path_copy.h"      // For rb_tree_path, rb_tree_path_insert, rb_tree_path_erase
+# include "../tree/rb_tree_path_iterator.h"  // For rb_tree_path_iterator
+# include "../utility/functional.h"          // For ft::select1st
+# include "../utility/pair.h"                // For ft::pair
+
+namespace ft {
+
+  /// @brief Ordered map of unique keys that many threads can read while one thread writes.
+  /// @details The map is a red-black tree of `rb_tree_node`s that is never modified in
+  /// place. An update copies the O(log n) nodes on its path (see `rb_tree_path_copy.h`),
+  /// links the copies into a new version sharing every other node with the current one,
+  /// and publishes it with a single atomic store of the root. Readers therefore see either
+  /// the old version or the new one, complete and balanced, without taking any lock:
+  /// a lookup is one atomic load of the root, a descent, and the two counter updates of
+  /// pinning an `epoch_domain`.
+  ///
+  /// The nodes replaced by an update are retired rather than freed; once
+  /// `reclaim_threshold` of them have accumulated the writer waits for a grace period of
+  /// the epoch domain and frees them. `reclaim()` does so on demand.
+  ///
+  /// Writers are serialized by an internal mutex, so the map is safe with any number of
+  /// them, but it is designed for one: updates cost O(log n) allocations and copies of
+  /// values, and a writer may wait on long read sections when it reclaims.
+  ///
+  /// Reading:
+  /// - `contains`, `count` and `visit` look up one key inside their own read section.
+  /// - `view()` returns a `read_view` pinning the current version: its iterators and
+  ///   lookups stay valid, and the version unchanged, until the view is destroyed. A view
+  ///   must not be held by the writing thread while it updates the map.
+  template <
+    typename Key,
+    typename T,
+    typename Compare = std::less<Key>,
+    typename Alloc   = std::allocator<ft::pair<const Key, T>>
+  > class concurrent_map
+  {
+    public:
+      using key_type        = Key;                                   ///< The type of the keys.
+      using mapped_type     = T;                                     ///< The type of the mapped values.
+      using value_type      = ft::pair<const Key, T>;                ///< The type of the stored elements.
+      using key_compare     = Compare;                               ///< The key comparison function type.
+      using allocator_type  = Alloc;                                 ///< The allocator type.
+      using size_type       = std::size_t;                           ///< Unsigned integer type for sizes.
+      using difference_type = std::ptrdiff_t;                        ///< Signed integer type for distances.
+      using const_reference = const value_type&;                     ///< Const reference type to the element.
+      using const_iterator  = rb_tree_path_iterator<value_type, select1st<value_type>, Compare>; ///< Constant bidirectional iterator.
+
+      /// @brief The number of retired nodes that triggers a reclamation.
+      static constexpr size_type reclaim_threshold = 1024;
+
+    private:
+      using node_allocator    = typename std::allocator_traits<Alloc>::template rebind_alloc<rb_tree_node<value_type>>;
+      using node_alloc_traits = std::allocator_traits<node_allocator>;
+      using base_ptr          = rb_tree_node_base*;
+      using const_base_ptr    = const rb_tree_node_base*;
+      using link_type         = rb_tree_node<value_type>*;
+      using const_link_type   = const rb_tree_node<value_type>*;
+
+      template <typename _Kt>
+      using __lookup_t = std::enable_if_t<std::is_same<_Kt, key_type>::value ||
+                                          is_transparent_compare<Compare>::value>;
+
+    public:
+      /// @brief A pinned version of the map, readable for as long as the view lives.
+      class read_view
+      {
+        friend class concurrent_map;
+
+        public:
+          read_view(read_view&&) = default;
+
+          const_iterator
+          begin() const noexcept { return const_iterator(m_root); }
+
+          const_iterator
+          end() const noexcept { return const_iterator(m_root, nullptr, m_comp); }
+
+          bool
+          empty() const noexcept { return m_root == nullptr; }
+
+          /// @brief Find the element with a key equivalent to __k, or end().
+          template <typename _Kt, typename = __lookup_t<_Kt>>
+          const_iterator
+          find(const _Kt& __k) const
+          {
+            const_iterator __i = const_iterator::__lower_bound(m_root, __k, *m_comp);
+
+            return ( __i == end() || (*m_comp)(__k, __key(__i.m_node)) ) ? end() : __i;
+          }
+
+          const_iterator
+          find(const key_type& __k) const { return find<key_type>(__k); }
+
+          template <typename _Kt, typename = __lookup_t<_Kt>>
+          bool
+          contains(const _Kt& __k) const { return __contains(m_root, __k, *m_comp); }
+
+          bool
+          contains(const key_type& __k) const { return __contains(m_root, __k, *m_comp); }
+
+          /// @brief Get the first element whose key is not less than __k.
+          template <typename _Kt, typename = __lookup_t<_Kt>>
+          const_iterator
+          lower_bound(const _Kt& __k) const { return const_iterator::__lower_bound(m_root, __k, *m_comp); }
+
+          const_iterator
+          lower_bound(const key_type& __k) const { return lower_bound<key_type>(__k); }
+
+          /// @brief Get the first element whose key is greater than __k.
+          template <typename _Kt, typename = __lookup_t<_Kt>>
+          const_iterator
+          upper_bound(const _Kt& __k) const { return const_iterator::__upper_bound(m_root, __k, *m_comp); }
+
+          const_iterator
+          upper_bound(const key_type& __k) const { return upper_bound<key_type>(__k); }
+
+        private:
+          read_view(epoch_domain::guard&& __g, const_base_ptr __root, const Compare* __comp) noexcept
+            : m_guard{ std::move(__g) }, m_root{ __root }, m_comp{ __comp } { }
+
+          epoch_domain::guard m_guard; ///< Keeps the nodes of the version from being freed.
+          const_base_ptr      m_root;  ///< The root of the pinned version.
+          const Compare*      m_comp;  ///< The key comparison function of the map.
+      };
+
+    public:
+      /// @brief Default constructor.
+      concurrent_map() = default;
+
+      /// @brief Constructor with a comparator and an allocator.
+      explicit
+      concurrent_map(const Compare& __comp, const allocator_type& __a = allocator_type())
+        : m_impl{ __comp, node_allocator(__a) } { }
+
+      concurrent_map(const concurrent_map&) = delete;
+      concurrent_map& operator=(const concurrent_map&) = delete;
+
+      /// @brief Destructor. No thread may be reading or writing the map any more.
+      ~concurrent_map()
+      {
+        __erase_subtree(m_root.load(std::memory_order_relaxed));
+        __free_retired();
+      }
+
+      allocator_type
+      get_allocator() const noexcept { return allocator_type(m_impl); }
+
+      key_compare
+      key_comp() const { return m_impl.__key_compare(); }
+
+    public:
+      /// @brief The number of elements of the latest published version.
+      size_type
+      size() const noexcept { return m_size.load(std::memory_order_relaxed); }
+
+      bool
+      empty() const noexcept { return size() == 0; }
+
+      /// @brief Pin the current version for reading.
+      read_view
+      view() const noexcept
+      {
+        epoch_domain::guard __g    = m_epoch.pin();
+        const_base_ptr      __root = m_root.load(std::memory_order_seq_cst);
+
+        return read_view(std::move(__g), __root, &m_impl.__key_compare());
+      }
+
+      /// @brief Whether an element with a key equivalent to __k is present.
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      bool
+      contains(const _Kt& __k) const { return view().contains(__k); }
+
+      bool
+      contains(const key_type& __k) const { return view().contains(__k); }
+
+      size_type
+      count(const key_type& __k) const { return contains(__k) ? 1 : 0; }
+
+      /// @brief Call __f with the element of key __k, if there is one, while it is pinned.
+      /// @return Whether the key was found.
+      /// @details __f receives a `const value_type&` valid only during the call.
+      template <typename _Kt, typename _Fn, typename = __lookup_t<_Kt>>
+      bool
+      visit(const _Kt& __k, _Fn&& __f) const
+      {
+        read_view            __v = view();
+        const_iterator       __i = __v.find(__k);
+
+        if ( __i == __v.end() ) return false;
+        std::forward<_Fn>(__f)(*__i);
+        return true;
+      }
+
+      template <typename _Fn>
+      bool
+      visit(const key_type& __k, _Fn&& __f) const { return visit<key_type>(__k, std::forward<_Fn>(__f)); }
+
+    public:
+      /// @brief Insert an element if its key is not present yet.
+      /// @return Whether insertion took place.
+      bool
+      insert(const value_type& __x) { return __try_emplace(__x.first, __x); }
+
+      bool
+      insert(value_type&& __x) { return __try_emplace(__x.first, std::move(__x)); }
+
+      /// @brief Construct a mapped value in place if the key is not present yet.
+      /// @return Whether insertion took place.
+      template <typename... _Args>
+      bool
+      try_emplace(const key_type& __k, _Args&&... __args)
+      {
+        return __try_emplace(__k, piecewise_construct, std::forward_as_tuple(__k),
+                             std::forward_as_tuple(std::forward<_Args>(__args)...));
+      }
+
+      /// @brief Insert an element, or assign to the mapped value if the key is present.
+      /// @return Whether insertion took place.
+      /// @details An assignment also publishes a new version: the element is copied with
+      /// the rest of its path, then the copy is assigned.
+      template <typename _Obj>
+      bool
+      insert_or_assign(const key_type& __k, _Obj&& __obj)
+      {
+        std::lock_guard<std::mutex> __lock(m_writer);
+        base_ptr                    __root = m_root.load(std::memory_order_relaxed);
+        rb_tree_path                __path;
+
+        if ( !__find_path(__root, __k, __path) ) {
+          link_type __z = __create_node(__k, std::forward<_Obj>(__obj));
+
+          __update(__root, [&](__cow_ops& __ops) { rb_tree_path_insert(__root, __path, __z, __ops); }, __z);
+          m_size.store(size() + 1, std::memory_order_relaxed);
+          return true;
+        }
+        __update(__root, [&](__cow_ops& __ops) {
+          rb_tree_path_copy(__root, __path, __ops);
+          static_cast<link_type>(__path.m_nodes[__path.m_depth - 1])->__valptr()->second = std::forward<_Obj>(__obj);
+        }, nullptr);
+        return false;
+      }
+
+      /// @brief Erase the element with key __k, if there is one.
+      /// @return The number of elements erased.
+      size_type
+      erase(const key_type& __k)
+      {
+        std::lock_guard<std::mutex> __lock(m_writer);
+        base_ptr                    __root = m_root.load(std::memory_order_relaxed);
+        rb_tree_path                __path;
+        base_ptr                    __removed = nullptr;
+
+        if ( !__find_path(__root, __k, __path) ) return 0;
+        __update(__root, [&](__cow_ops& __ops) { __removed = rb_tree_path_erase(__root, __path, __ops); }, nullptr);
+        // The copy of the erased node was never published.
+        __drop_node(static_cast<link_type>(__removed));
+        m_size.store(size() - 1, std::memory_order_relaxed);
+        return 1;
+      }
+
+      /// @brief Erase every element.
+      /// @details Waits for a grace period, then frees the whole old version.
+      void
+      clear()
+      {
+        std::lock_guard<std::mutex> __lock(m_writer);
+        base_ptr                    __old = m_root.exchange(nullptr, std::memory_order_seq_cst);
+
+        m_size.store(0, std::memory_order_relaxed);
+        m_epoch.synchronize();
+        __erase_subtree(__old);
+        __free_retired();
+      }
+
+      /// @brief Free the nodes retired by past updates, once no reader can see them.
+      /// @details Waits for every read section entered before the call to end.
+      void
+      reclaim()
+      {
+        std::lock_guard<std::mutex> __lock(m_writer);
+
+        m_epoch.synchronize();
+        __free_retired();
+      }
+
+    private:
+      /// @brief The hooks of the path-copying functions: copies are fresh nodes, and the
+      /// nodes they replace are retired once the new version is published.
+      /// @details Both lists are kept until the update succeeds, so that an exception
+      /// thrown while copying can free the copies and leave the current version untouched.
+      struct __cow_ops
+      {
+        concurrent_map& m_map;
+        std::vector<base_ptr>& m_fresh;
+        std::vector<base_ptr>& m_released;
+
+        base_ptr
+        __clone(base_ptr __x)
+        {
+          m_fresh.reserve(m_fresh.size() + 1);
+          link_type __c = m_map.__create_node(*static_cast<const_link_type>(__x)->__valptr());
+
+          __c->__set_color(__x->__color());
+          __c->m_left  = __x->m_left;
+          __c->m_right = __x->m_right;
+          m_fresh.push_back(__c);
+          return __c;
+        }
+
+        void
+        __release(base_ptr __x) { m_released.push_back(__x); }
+      };
+
+      /// @brief Build a new version with __fn and publish it as the root.
+      /// @param __z A fresh node __fn links in, freed too if __fn throws.
+      template <typename _Fn>
+      void
+      __update(base_ptr& __root, _Fn __fn, link_type __z)
+      {
+        m_fresh.clear();
+        m_released.clear();
+        try {
+          __cow_ops __ops{ *this, m_fresh, m_released };
+
+          __fn(__ops);
+          m_retired.reserve(m_retired.size() + m_released.size());
+        } catch ( ... ) {
+          for ( base_ptr __c : m_fresh ) __drop_node(static_cast<link_type>(__c));
+          if ( __z != nullptr ) __drop_node(__z);
+          throw;
+        }
+        m_root.store(__root, std::memory_order_seq_cst);
+        m_retired.insert(m_retired.end(), m_released.begin(), m_released.end());
+        if ( m_retired.size() >= reclaim_threshold ) {
+          m_epoch.synchronize();
+          __free_retired();
+        }
+      }
+
+      /// @brief Insert an element built from __args if __k is not present yet.
+      template <typename... _Args>
+      bool
+      __try_emplace(const key_type& __k, _Args&&... __args)
+      {
+        std::lock_guard<std::mutex> __lock(m_writer);
+        base_ptr                    __root = m_root.load(std::memory_order_relaxed);
+        rb_tree_path                __path;
+
+        if ( __find_path(__root, __k, __path) ) return false;
+        link_type __z = __create_node(std::forward<_Args>(__args)...);
+
+        __update(__root, [&](__cow_ops& __ops) { rb_tree_path_insert(__root, __path, __z, __ops); }, __z);
+        m_size.store(size() + 1, std::memory_order_relaxed);
+        return true;
+      }
+
+      /// @brief Record the path to the node of key __k, or to the free slot it would go to.
+      /// @return Whether the key was found; it is then the last node of __path.
+      bool
+      __find_path(base_ptr __x, const key_type& __k, rb_tree_path& __path) const
+      {
+        const Compare& __comp = m_impl.__key_compare();
+
+        while ( __x != nullptr ) {
+          if ( __comp(__k, __key(__x)) ) {
+            __path.__push(__x, false);
+            __x = __x->m_left;
+          } else if ( __comp(__key(__x), __k) ) {
+            __path.__push(__x, true);
+            __x = __x->m_right;
+          } else {
+            __path.__push(__x, false);
+            return true;
+          }
+        }
+        return false;
+      }
+
+      /// @brief Whether the version at __x has a key equivalent to __k: one lower bound
+      /// descent, with a single comparison per level, and no iterator built.
+      template <typename _Kt>
+      static bool
+      __contains(const_base_ptr __x, const _Kt& __k, const Compare& __comp)
+      {
+        const_base_ptr __y = nullptr;
+
+        while ( __x != nullptr ) {
+          if ( !__comp(__key(__x), __k) ) {
+            __y = __x;
+            __x = __x->m_left;
+          } else {
+            __x = __x->m_right;
+          }
+        }
+        return __y != nullptr && !__comp(__k, __key(__y));
+      }
+
+      static const key_type&
+      __key(const_base_ptr __x) { return static_cast<const_link_type>(__x)->__valptr()->first; }
+
+      node_allocator&
+      __get_node_allocator() noexcept { return m_impl; }
+
+      template <typename... _Args>
+      link_type
+      __create_node(_Args&&... __args)
+      {
+        link_type __p = node_alloc_traits::allocate(__get_node_allocator(), 1);
+
+        try {
+          node_alloc_traits::construct(__get_node_allocator(), __p, std::in_place, std::forward<_Args>(__args)...);
+        } catch ( ... ) {
+          node_alloc_traits::deallocate(__get_node_allocator(), __p, 1);
+          throw;
+        }
+        return __p;
+      }
+
+      void
+      __drop_node(link_type __p) noexcept
+      {
+        node_alloc_traits::destroy(__get_node_allocator(), __p);
+        node_alloc_traits::deallocate(__get_node_allocator(), __p, 1);
+      }
+
+      /// @brief Free every node of a subtree that no reader can reach any more.
+      void
+      __erase_subtree(base_ptr __x) noexcept
+      {
+        while ( __x != nullptr ) {
+          __erase_subtree(__x->m_right);
+          base_ptr __l = __x->m_left;
+          __drop_node(static_cast<link_type>(__x));
+          __x = __l;
+        }
+      }
+
+      void
+      __free_retired() noexcept
+      {
+        for ( base_ptr __x : m_retired ) __drop_node(static_cast<link_type>(__x));
+        m_retired.clear();
+      }
+
+    private:
+      /// @brief The node allocator and the comparator, both usually empty.
+      struct concurrent_map_impl
+        : public node_allocator,
+          public rb_tree_key_compare<Compare>
+      {
+        concurrent_map_impl() = default;
+
+        concurrent_map_impl(const Compare& __comp, const node_allocator& __a)
+          : node_allocator(__a), rb_tree_key_compare<Compare>(__comp) { }
+      };
+
+      concurrent_map_impl    m_impl;                ///< The allocator and the comparator.
+      std::atomic<base_ptr>  m_root{ nullptr };     ///< The root of the published version.
+      std::atomic<size_type> m_size{ 0 };           ///< The size of the published version.
+      mutable epoch_domain   m_epoch;               ///< Tracks the readers of past versions.
+      std::mutex             m_writer;              ///< Serializes the writers.
+      std::vector<base_ptr>  m_retired;             ///< Replaced nodes waiting for a grace period.
+      std::vector<base_ptr>  m_fresh;               ///< Copies made by the update in progress.
+      std::vector<base_ptr>  m_released;            ///< Nodes replaced by the update in progress.
+  };
+
+} // namespace ft
+
+#endif // __FT_CONCURRENT_MAP__
@@ -0,0 +1,732 @@
+#ifndef   __FT_FLAT_MAP__
+# define  __FT_FLAT_MAP__
+
+# include <algorithm>   // For std::stable_sort
+# include <cstddef>     // For std::size_t, std::ptrdiff_t
+# include <functional>  // For std::less
+# include <iterator>    // For std::make_move_iterator, std::forward_iterator_tag, std::random_access_iterator_tag
+# include <stdexcept>   // For std::out_of_range, std::invalid_argument
+# include <type_traits> // For std::enable_if_t, std::conditional_t, std::is_constructible, std::is_nothrow_swappable
+# include <utility>     // For std::move, std::forward
+# include <vector>      // For std::vector
+
+# include "flat_map_iterator.h"               // For flat_map_iterator
+# include "../algorithm/algorithm.h"          // For ft::lexicographical_compare
+# include "../algorithm/sorted_search.h"      // For sorted_lower_bound, sorted_upper_bound, sorted_unique_t
+# include "../iterator/iterator_base_types.h" // For iterator_category_t, iterator tags
+# include "../iterator/reverse_iterator.h"    // For ft::reverse_iterator
+# include "../tree/rb_tree_key_compare.h"     // For rb_tree_key_compare, has_is_transparent_t
+# include "../utility/pair.h"                 // For ft::pair
+
+namespace ft {
+
+  /// @brief Ordered associative container of unique keys mapped to values, kept in two
+  /// sorted contiguous arrays.
+  /// @details The keys and the mapped values are stored in separate containers
+  /// (struct-of-arrays), at the same index: a lookup only walks the dense key array, and
+  /// iteration is a linear scan of both. For maps that are read far more often than they
+  /// are modified this takes much less memory and cache than `ft::map`, at the cost of O(n)
+  /// single-element insertion and erasure. Bulk loads should go through the range
+  /// constructors or `insert_sorted_range`, which merge in linear time.
+  ///
+  /// Lookups use `sorted_lower_bound`, which is branchless and vectorized for arithmetic
+  /// keys compared with `std::less`.
+  ///
+  /// Any insertion or erasure invalidates all iterators and references.
+  ///
+  /// @tparam KeyContainer A contiguous sequence container of `Key`, such as `std::vector<Key>`.
+  /// @tparam MappedContainer A contiguous sequence container of `T`.
+  template <
+    typename Key,
+    typename T,
+    typename Compare         = std::less<Key>,
+    typename KeyContainer    = std::vector<Key>,
+    typename MappedContainer = std::vector<T>
+  > class flat_map
+  {
+    public:
+      using key_type               = Key;                                   ///< The type of the keys.
+      using mapped_type            = T;                                     ///< The type of the mapped values.
+      using value_type             = ft::pair<Key, T>;                      ///< The type of the elements, by value.
+      using key_compare            = Compare;                               ///< The key comparison function type.
+      using reference              = ft::pair<const Key&, T&>;              ///< Pair of references to a key and its mapped value.
+      using const_reference        = ft::pair<const Key&, const T&>;        ///< Pair of const references to a key and its mapped value.
+      using size_type              = std::size_t;                           ///< Unsigned integer type for sizes.
+      using difference_type        = std::ptrdiff_t;                        ///< Signed integer type for distances.
+      using iterator               = flat_map_iterator<Key, T>;             ///< Random-access iterator.
+      using const_iterator         = flat_map_iterator<Key, const T>;       ///< Constant random-access iterator.
+      using reverse_iterator       = ft::reverse_iterator<iterator>;        ///< Reverse iterator.
+      using const_reverse_iterator = ft::reverse_iterator<const_iterator>;  ///< Constant reverse iterator.
+      using key_container_type     = KeyContainer;                          ///< The container of the keys.
+      using mapped_container_type  = MappedContainer;                       ///< The container of the mapped values.
+
+      /// @brief Function object comparing elements by their keys.
+      class value_compare
+      {
+        friend class flat_map;
+
+        protected:
+          Compare comp; ///< The key comparison function.
+
+          value_compare(Compare __c) : comp{ __c } { }
+
+        public:
+          bool
+          operator()(const_reference __x, const_reference __y) const { return comp(__x.first, __y.first); }
+      };
+
+      /// @brief The two underlying containers, as returned by `extract`.
+      struct containers
+      {
+        key_container_type    keys;   ///< The sorted keys.
+        mapped_container_type values; ///< The mapped values, at the index of their key.
+      };
+
+    private:
+      /// @brief The comparator (empty-base optimized) and the containers.
+      struct flat_map_impl : public rb_tree_key_compare<key_compare>
+      {
+        containers m_c;
+
+        flat_map_impl() = default;
+
+        flat_map_impl(const key_compare& __comp)
+          : rb_tree_key_compare<key_compare>{ __comp }, m_c{ } { }
+
+        flat_map_impl(const key_compare& __comp, key_container_type&& __keys, mapped_container_type&& __values)
+          : rb_tree_key_compare<key_compare>{ __comp }, m_c{ std::move(__keys), std::move(__values) } { }
+      };
+
+      flat_map_impl m_impl; ///< The comparator and the containers.
+
+    public:
+      /// @brief Default constructor.
+      flat_map() = default;
+
+      /// @brief Constructor with a comparator.
+      /// @param __comp The key comparison function.
+      explicit
+      flat_map(const Compare& __comp)
+        : m_impl{ __comp } { }
+
+      /// @brief Constructor adopting two containers of keys and mapped values.
+      /// @param __keys The keys, in any order.
+      /// @param __values The mapped values, at the index of their key.
+      /// @details The elements are sorted by key and, of equal keys, the first is kept.
+      /// @throws std::invalid_argument if the containers differ in size.
+      flat_map(key_container_type __keys, mapped_container_type __values, const Compare& __comp = Compare())
+        : m_impl{ __comp }
+      {
+        if ( __keys.size() != __values.size() ) throw std::invalid_argument("ft::flat_map: size mismatch");
+
+        std::vector<value_type> __buf;
+
+        __buf.reserve(__keys.size());
+        for ( size_type __i = 0; __i < __keys.size(); ++__i )
+          __buf.emplace_back(std::move(__keys[__i]), std::move(__values[__i]));
+        __sort_and_merge(__buf);
+      }
+
+      /// @brief Constructor adopting two containers that are already sorted and unique.
+      /// @param __keys The keys, sorted by __comp and without duplicates.
+      /// @param __values The mapped values, at the index of their key.
+      /// @details The containers are moved in as is, in O(1).
+      flat_map(sorted_unique_t, key_container_type __keys, mapped_container_type __values, const Compare& __comp = Compare())
+        : m_impl{ __comp, std::move(__keys), std::move(__values) }
+      {
+        if ( m_impl.m_c.keys.size() != m_impl.m_c.values.size() ) throw std::invalid_argument("ft::flat_map: size mismatch");
+      }
+
+      /// @brief Range constructor.
+      /// @param __first The beginning of the range to insert.
+      /// @param __last The end of the range to insert.
+      /// @details The range is sorted once and stored in O(n log n), rather than inserted
+      /// element by element.
+      template <typename _InputIterator>
+      flat_map(_InputIterator __first, _InputIterator __last, const Compare& __comp = Compare())
+        : m_impl{ __comp }
+      {
+        insert(__first, __last);
+      }
+
+      /// @brief Range constructor for a range that is already sorted and unique.
+      template <typename _InputIterator>
+      flat_map(sorted_unique_t, _InputIterator __first, _InputIterator __last, const Compare& __comp = Compare())
+        : m_impl{ __comp }
+      {
+        insert_sorted_range(__first, __last);
+      }
+
+      flat_map(const flat_map&) = default;
+      flat_map(flat_map&&) = default;
+      ~flat_map() = default;
+
+      flat_map&
+      operator=(const flat_map& __x)
+      {
+        if ( this != &__x ) {
+          m_impl.__key_compare() = __x.m_impl.__key_compare();
+          m_impl.m_c.keys        = __x.m_impl.m_c.keys;
+          m_impl.m_c.values      = __x.m_impl.m_c.values;
+        }
+        return *this;
+      }
+
+      flat_map&
+      operator=(flat_map&& __x)
+      {
+        m_impl.__key_compare() = std::move(__x.m_impl.__key_compare());
+        m_impl.m_c.keys        = std::move(__x.m_impl.m_c.keys);
+        m_impl.m_c.values      = std::move(__x.m_impl.m_c.values);
+        return *this;
+      }
+
+    public:
+      iterator               begin()         noexcept { return __make_iterator(0); }
+      const_iterator         begin()   const noexcept { return __make_iterator(0); }
+      iterator               end()           noexcept { return __make_iterator(size()); }
+      const_iterator         end()     const noexcept { return __make_iterator(size()); }
+      reverse_iterator       rbegin()        noexcept { return reverse_iterator(end()); }
+      const_reverse_iterator rbegin()  const noexcept { return const_reverse_iterator(end()); }
+      reverse_iterator       rend()          noexcept { return reverse_iterator(begin()); }
+      const_reverse_iterator rend()    const noexcept { return const_reverse_iterator(begin()); }
+
+    public:
+      bool      empty()    const noexcept { return m_impl.m_c.keys.empty(); }
+      size_type size()     const noexcept { return m_impl.m_c.keys.size(); }
+      size_type max_size() const noexcept { return m_impl.m_c.keys.max_size(); }
+
+      /// @brief Reserve room for __n elements in both containers.
+      void
+      reserve(size_type __n)
+      {
+        m_impl.m_c.keys.reserve(__n);
+        m_impl.m_c.values.reserve(__n);
+      }
+
+    public:
+      /// @brief Access the value mapped to a key, inserting a default one if needed.
+      /// @param __k The key to look up.
+      /// @return A reference to the mapped value.
+      mapped_type&
+      operator[](const key_type& __k) { return try_emplace(__k).first->second; }
+
+      mapped_type&
+      operator[](key_type&& __k) { return try_emplace(std::move(__k)).first->second; }
+
+      /// @brief Access the value mapped to a key, with bounds checking.
+      /// @throws std::out_of_range if the key is not present.
+      mapped_type&
+      at(const key_type& __k)
+      {
+        iterator __i = find(__k);
+
+        if ( __i == end() ) throw std::out_of_range("ft::flat_map::at");
+        return __i->second;
+      }
+
+      const mapped_type&
+      at(const key_type& __k) const
+      {
+        const_iterator __i = find(__k);
+
+        if ( __i == end() ) throw std::out_of_range("ft::flat_map::at");
+        return __i->second;
+      }
+
+    public:
+      /// @brief Insert an element if its key is not present yet.
+      /// @return An iterator to the element with that key, and whether insertion took place.
+      pair<iterator, bool>
+      insert(const value_type& __x) { return try_emplace(__x.first, __x.second); }
+
+      pair<iterator, bool>
+      insert(value_type&& __x) { return try_emplace(std::move(__x.first), std::move(__x.second)); }
+
+      /// @brief Insert an element constructed from __x if its key is not present yet.
+      template <typename _Pair, typename = std::enable_if_t<std::is_constructible<value_type, _Pair&&>::value>>
+      pair<iterator, bool>
+      insert(_Pair&& __x) { return insert(value_type(std::forward<_Pair>(__x))); }
+
+      /// @brief Insert a copy of __x, using __pos as a hint for where it goes.
+      /// @return An iterator to the element with the key of __x.
+      /// @details The search is skipped when __x belongs right before __pos, e.g. when
+      /// appending sorted input with `end()` as the hint; the elements after it still move.
+      iterator
+      insert(const_iterator __pos, const value_type& __x) { return try_emplace(__pos, __x.first, __x.second); }
+
+      iterator
+      insert(const_iterator __pos, value_type&& __x) { return try_emplace(__pos, std::move(__x.first), std::move(__x.second)); }
+
+      template <typename _Pair, typename = std::enable_if_t<std::is_constructible<value_type, _Pair&&>::value>>
+      iterator
+      insert(const_iterator __pos, _Pair&& __x) { return insert(__pos, value_type(std::forward<_Pair>(__x))); }
+
+      /// @brief Insert every element of a range whose key is not present yet.
+      /// @details The range is buffered, stably sorted and merged in, so the whole call costs
+      /// O(m log m + n + m) instead of O(m * n) for m inserts one at a time.
+      template <typename _InputIterator>
+      void
+      insert(_InputIterator __first, _InputIterator __last)
+      {
+        std::vector<value_type> __buf;
+
+        for ( ; __first != __last; ++__first )
+          __buf.emplace_back(*__first);
+        __sort_and_merge(__buf);
+      }
+
+      /// @brief Merge a range sorted by key into the map in O(n + m).
+      /// @param __first The beginning of the range, whose elements have `first` and `second`.
+      /// @param __last The end of the range.
+      /// @details Elements whose key is already present, or repeats an earlier key of the
+      /// range, are skipped. The new elements are gathered aside first, then merged with the
+      /// current ones into new containers that are swapped in. The current elements are only
+      /// moved when nothing after that can throw, and copied otherwise, so the map is left
+      /// unchanged if an exception is thrown, unless its elements can neither be copied nor
+      /// moved without throwing.
+      template <typename _InputIterator>
+      void
+      insert_sorted_range(_InputIterator __first, _InputIterator __last)
+      {
+        containers&     __c    = m_impl.m_c;
+        containers      __add;
+        const size_type __hint = __size_hint(__first, __last);
+        size_type       __i    = 0;
+
+        __add.keys.reserve(__hint);
+        __add.values.reserve(__hint);
+        for ( ; __first != __last; ++__first ) {
+          auto&& __x = *__first;
+
+          while ( __i < __c.keys.size() && __key_comp()(__c.keys[__i], __x.first) ) ++__i;
+          if ( __i < __c.keys.size() && !__key_comp()(__x.first, __c.keys[__i]) ) continue;
+          if ( !__add.keys.empty() && !__key_comp()(__add.keys.back(), __x.first) ) continue;
+          __add.keys.push_back(std::forward<decltype(__x)>(__x).first);
+          __add.values.push_back(std::forward<decltype(__x)>(__x).second);
+        }
+        if ( __add.keys.empty() ) return;
+
+        containers __out;
+        size_type  __j = 0;
+
+        __out.keys.reserve(__c.keys.size() + __add.keys.size());
+        __out.values.reserve(__c.keys.size() + __add.keys.size());
+        for ( __i = 0; __i < __c.keys.size() || __j < __add.keys.size(); ) {
+          if ( __j == __add.keys.size() || ( __i < __c.keys.size() && __key_comp()(__c.keys[__i], __add.keys[__j]) ) ) {
+            __out.keys.push_back(__take_current(__c.keys[__i]));
+            __out.values.push_back(__take_current(__c.values[__i]));
+            ++__i;
+          } else {
+            __out.keys.push_back(std::move(__add.keys[__j]));
+            __out.values.push_back(std::move(__add.values[__j]));
+            ++__j;
+          }
+        }
+        __c.keys.swap(__out.keys);
+        __c.values.swap(__out.values);
+      }
+
+      /// @brief Construct an element in place if its key is not present yet.
+      /// @param __args The arguments forwarded to the constructor of `value_type`.
+      /// @return An iterator to the element with that key, and whether insertion took place.
+      template <typename... _Args>
+      pair<iterator, bool>
+      emplace(_Args&&... __args) { return insert(value_type(std::forward<_Args>(__args)...)); }
+
+      /// @brief Construct an element in place near a hint if its key is not present yet.
+      template <typename... _Args>
+      iterator
+      emplace_hint(const_iterator __pos, _Args&&... __args)
+      {
+        return insert(__pos, value_type(std::forward<_Args>(__args)...));
+      }
+
+      /// @brief Construct a mapped value in place if the key is not present yet.
+      /// @param __k The key.
+      /// @param __args The arguments forwarded to the constructor of `mapped_type`.
+      /// @return An iterator to the element with that key, and whether insertion took place.
+      /// @details Nothing is constructed or moved from when the key exists.
+      template <typename... _Args>
+      pair<iterator, bool>
+      try_emplace(const key_type& __k, _Args&&... __args)
+      {
+        const size_type __i = __lower_index(__k);
+
+        if ( __matches(__i, __k) )
+          return pair<iterator, bool>(__make_iterator(__i), false);
+        return pair<iterator, bool>(__emplace_at(__i, __k, std::forward<_Args>(__args)...), true);
+      }
+
+      template <typename... _Args>
+      pair<iterator, bool>
+      try_emplace(key_type&& __k, _Args&&... __args)
+      {
+        const size_type __i = __lower_index(__k);
+
+        if ( __matches(__i, __k) )
+          return pair<iterator, bool>(__make_iterator(__i), false);
+        return pair<iterator, bool>(__emplace_at(__i, std::move(__k), std::forward<_Args>(__args)...), true);
+      }
+
+      /// @brief Construct a mapped value in place near a hint if the key is not present yet.
+      /// @param __pos A hint for the position of the element.
+      /// @return An iterator to the element with that key.
+      template <typename... _Args>
+      iterator
+      try_emplace(const_iterator __pos, const key_type& __k, _Args&&... __args)
+      {
+        const size_type __i = __hint_index(__pos, __k);
+
+        if ( __matches(__i, __k) ) return __make_iterator(__i);
+        return __emplace_at(__i, __k, std::forward<_Args>(__args)...);
+      }
+
+      template <typename... _Args>
+      iterator
+      try_emplace(const_iterator __pos, key_type&& __k, _Args&&... __args)
+      {
+        const size_type __i = __hint_index(__pos, __k);
+
+        if ( __matches(__i, __k) ) return __make_iterator(__i);
+        return __emplace_at(__i, std::move(__k), std::forward<_Args>(__args)...);
+      }
+
+      iterator
+      erase(const_iterator __position) { return erase(__position, __position + 1); }
+
+      iterator
+      erase(iterator __position) { return erase(const_iterator(__position), const_iterator(__position) + 1); }
+
+      size_type
+      erase(const key_type& __k)
+      {
+        const_iterator __i = find(__k);
+
+        if ( __i == end() ) return 0;
+        erase(__i);
+        return 1;
+      }
+
+      iterator
+      erase(const_iterator __first, const_iterator __last)
+      {
+        const difference_type __f = __first - begin();
+        const difference_type __l = __last - begin();
+
+        m_impl.m_c.keys.erase(m_impl.m_c.keys.begin() + __f, m_impl.m_c.keys.begin() + __l);
+        m_impl.m_c.values.erase(m_impl.m_c.values.begin() + __f, m_impl.m_c.values.begin() + __l);
+        return __make_iterator(static_cast<size_type>(__f));
+      }
+
+      void
+      swap(flat_map& __x) noexcept(std::is_nothrow_swappable<Compare>::value)
+      {
+        std::swap(m_impl.__key_compare(), __x.m_impl.__key_compare());
+        m_impl.m_c.keys.swap(__x.m_impl.m_c.keys);
+        m_impl.m_c.values.swap(__x.m_impl.m_c.values);
+      }
+
+      void
+      clear() noexcept
+      {
+        m_impl.m_c.keys.clear();
+        m_impl.m_c.values.clear();
+      }
+
+      /// @brief Move the underlying containers out, leaving the map empty.
+      containers
+      extract() &&
+      {
+        containers __c = std::move(m_impl.m_c);
+
+        clear();
+        return __c;
+      }
+
+      /// @brief Replace the underlying containers.
+      /// @param __keys The keys, sorted by `key_comp()` and without duplicates.
+      /// @param __values The mapped values, at the index of their key.
+      void
+      replace(key_container_type&& __keys, mapped_container_type&& __values)
+      {
+        if ( __keys.size() != __values.size() ) throw std::invalid_argument("ft::flat_map::replace: size mismatch");
+        m_impl.m_c.keys   = std::move(__keys);
+        m_impl.m_c.values = std::move(__values);
+      }
+
+      /// @brief The sorted keys.
+      const key_container_type&
+      keys() const noexcept { return m_impl.m_c.keys; }
+
+      /// @brief The mapped values, in the order of their keys.
+      const mapped_container_type&
+      values() const noexcept { return m_impl.m_c.values; }
+
+    public:
+      key_compare
+      key_comp() const { return m_impl.__key_compare(); }
+
+      value_compare
+      value_comp() const { return value_compare(m_impl.__key_compare()); }
+
+    public:
+      iterator       find(const key_type& __k)       { return __make_iterator(__find_index(__k)); }
+      const_iterator find(const key_type& __k) const { return __make_iterator(__find_index(__k)); }
+
+      size_type
+      count(const key_type& __k) const { return __find_index(__k) != size() ? 1 : 0; }
+
+      iterator       lower_bound(const key_type& __k)       { return __make_iterator(__lower_index(__k)); }
+      const_iterator lower_bound(const key_type& __k) const { return __make_iterator(__lower_index(__k)); }
+      iterator       upper_bound(const key_type& __k)       { return __make_iterator(__upper_index(__k)); }
+      const_iterator upper_bound(const key_type& __k) const { return __make_iterator(__upper_index(__k)); }
+
+      pair<iterator, iterator>
+      equal_range(const key_type& __k)
+      {
+        const size_type __i = __lower_index(__k);
+
+        return pair<iterator, iterator>(__make_iterator(__i), __make_iterator(__i + __matches(__i, __k)));
+      }
+
+      pair<const_iterator, const_iterator>
+      equal_range(const key_type& __k) const
+      {
+        const size_type __i = __lower_index(__k);
+
+        return pair<const_iterator, const_iterator>(__make_iterator(__i), __make_iterator(__i + __matches(__i, __k)));
+      }
+
+    public:
+      /// @brief Heterogeneous lookup, available when the comparator is transparent.
+      /// @details These overloads compare __x against the keys directly, so looking up a
+      /// `std::string` key by `const char*` or `std::string_view` allocates nothing.
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      iterator
+      find(const _Kt& __x) { return __make_iterator(__find_index(__x)); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      const_iterator
+      find(const _Kt& __x) const { return __make_iterator(__find_index(__x)); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      size_type
+      count(const _Kt& __x) const { return __upper_index(__x) - __lower_index(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      iterator
+      lower_bound(const _Kt& __x) { return __make_iterator(__lower_index(__x)); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      const_iterator
+      lower_bound(const _Kt& __x) const { return __make_iterator(__lower_index(__x)); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      iterator
+      upper_bound(const _Kt& __x) { return __make_iterator(__upper_index(__x)); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      const_iterator
+      upper_bound(const _Kt& __x) const { return __make_iterator(__upper_index(__x)); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      pair<iterator, iterator>
+      equal_range(const _Kt& __x) { return pair<iterator, iterator>(lower_bound(__x), upper_bound(__x)); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      pair<const_iterator, const_iterator>
+      equal_range(const _Kt& __x) const { return pair<const_iterator, const_iterator>(lower_bound(__x), upper_bound(__x)); }
+
+    private:
+      const key_compare&
+      __key_comp() const noexcept { return m_impl.__key_compare(); }
+
+      iterator
+      __make_iterator(size_type __i) noexcept
+      {
+        return iterator(m_impl.m_c.keys.data() + __i, m_impl.m_c.values.data() + __i);
+      }
+
+      const_iterator
+      __make_iterator(size_type __i) const noexcept
+      {
+        return const_iterator(m_impl.m_c.keys.data() + __i, m_impl.m_c.values.data() + __i);
+      }
+
+      template <typename _Kt>
+      size_type
+      __lower_index(const _Kt& __k) const { return sorted_lower_bound(m_impl.m_c.keys.data(), size(), __k, __key_comp()); }
+
+      template <typename _Kt>
+      size_type
+      __upper_index(const _Kt& __k) const { return sorted_upper_bound(m_impl.m_c.keys.data(), size(), __k, __key_comp()); }
+
+      /// @brief Whether the element at __i, the lower bound of __k, has key __k.
+      template <typename _Kt>
+      bool
+      __matches(size_type __i, const _Kt& __k) const
+      {
+        return __i != size() && !__key_comp()(__k, m_impl.m_c.keys[__i]);
+      }
+
+      /// @brief Index of the element with key __k, or `size()`.
+      template <typename _Kt>
+      size_type
+      __find_index(const _Kt& __k) const
+      {
+        const size_type __i = __lower_index(__k);
+
+        return __matches(__i, __k) ? __i : size();
+      }
+
+      /// @brief The lower bound of __k, found without a search if __k fits right before __pos.
+      size_type
+      __hint_index(const_iterator __pos, const key_type& __k) const
+      {
+        const size_type   __i    = static_cast<size_type>(__pos - begin());
+        const key_type*   __keys = m_impl.m_c.keys.data();
+
+        if ( ( __i == 0 || __key_comp()(__keys[__i - 1], __k) ) && ( __i == size() || !__key_comp()(__keys[__i], __k) ) )
+          return __i;
+        return __lower_index(__k);
+      }
+
+      /// @brief Insert a key and a mapped value built from __args at index __i.
+      /// @details If constructing the mapped value throws, the key is removed again so both
+      /// containers keep the same size.
+      template <typename _Kt, typename... _Args>
+      iterator
+      __emplace_at(size_type __i, _Kt&& __k, _Args&&... __args)
+      {
+        containers& __c = m_impl.m_c;
+
+        __c.keys.insert(__c.keys.begin() + static_cast<difference_type>(__i), std::forward<_Kt>(__k));
+        try {
+          __c.values.emplace(__c.values.begin() + static_cast<difference_type>(__i), std::forward<_Args>(__args)...);
+        }
+        catch ( ... ) {
+          __c.keys.erase(__c.keys.begin() + static_cast<difference_type>(__i));
+          throw;
+        }
+        return __make_iterator(__i);
+      }
+
+      /// @brief Stably sort a buffer of new elements and merge it in with `insert_sorted_range`.
+      /// @details The sort is stable so that of equal keys the first one is kept, as with
+      /// repeated `insert`.
+      void
+      __sort_and_merge(std::vector<value_type>& __buf)
+      {
+        const key_compare& __comp = __key_comp();
+
+        std::stable_sort(__buf.begin(), __buf.end(),
+                         [&__comp](const value_type& __x, const value_type& __y) { return __comp(__x.first, __y.first); });
+        insert_sorted_range(std::make_move_iterator(__buf.begin()), std::make_move_iterator(__buf.end()));
+      }
+
+      /// @brief Whether a merge may move the current elements: moving them cannot throw, or
+      /// they cannot be copied anyway.
+      static constexpr bool __move_current =
+        ( std::is_nothrow_move_constructible<key_type>::value && std::is_nothrow_move_constructible<mapped_type>::value ) ||
+        !( std::is_copy_constructible<key_type>::value && std::is_copy_constructible<mapped_type>::value );
+
+      /// @brief A current element to merge, as an rvalue if `__move_current`, as a const lvalue otherwise.
+      template <typename _Tp>
+      static std::conditional_t<__move_current, _Tp&&, const _Tp&>
+      __take_current(_Tp& __x) noexcept { return std::move(__x); }
+
+      /// @brief The length of a multi-pass range, or 0 for a single-pass one, to reserve for.
+      template <typename _Iter>
+      static size_type
+      __size_hint(_Iter __first, _Iter __last)
+      {
+        using _Cat = iterator_category_t<_Iter>;
+
+        return __size_hint(__first, __last,
+                           std::integral_constant<bool, std::is_convertible<_Cat, random_access_iterator_tag>::value ||
+                                                        std::is_convertible<_Cat, std::random_access_iterator_tag>::value>(),
+                           std::integral_constant<bool, std::is_convertible<_Cat, forward_iterator_tag>::value ||
+                                                        std::is_convertible<_Cat, std::forward_iterator_tag>::value>());
+      }
+
+      template <typename _Iter>
+      static size_type
+      __size_hint(_Iter __first, _Iter __last, std::true_type, std::true_type) { return static_cast<size_type>(__last - __first); }
+
+      template <typename _Iter>
+      static size_type
+      __size_hint(_Iter __first, _Iter __last, std::false_type, std::true_type)
+      {
+        size_type __n = 0;
+
+        for ( ; __first != __last; ++__first ) ++__n;
+        return __n;
+      }
+
+      template <typename _Iter>
+      static size_type
+      __size_hint(_Iter, _Iter, std::false_type, std::false_type) { return 0; }
+
+    public:
+      template <typename K1, typename T1, typename C1, typename KC1, typename MC1>
+      friend bool operator==(const flat_map<K1, T1, C1, KC1, MC1>&, const flat_map<K1, T1, C1, KC1, MC1>&);
+
+      template <typename K1, typename T1, typename C1, typename KC1, typename MC1>
+      friend bool operator<(const flat_map<K1, T1, C1, KC1, MC1>&, const flat_map<K1, T1, C1, KC1, MC1>&);
+  };
+
+  template <typename Key, typename T, typename Compare, typename KC, typename MC>
+  inline bool
+  operator==(const flat_map<Key, T, Compare, KC, MC>& __x, const flat_map<Key, T, Compare, KC, MC>& __y)
+  {
+    return __x.m_impl.m_c.keys == __y.m_impl.m_c.keys && __x.m_impl.m_c.values == __y.m_impl.m_c.values;
+  }
+
+  template <typename Key, typename T, typename Compare, typename KC, typename MC>
+  inline bool
+  operator<(const flat_map<Key, T, Compare, KC, MC>& __x, const flat_map<Key, T, Compare, KC, MC>& __y)
+  {
+    return ft::lexicographical_compare(__x.begin(), __x.end(), __y.begin(), __y.end());
+  }
+
+  template <typename Key, typename T, typename Compare, typename KC, typename MC>
+  inline bool
+  operator!=(const flat_map<Key, T, Compare, KC, MC>& __x, const flat_map<Key, T, Compare, KC, MC>& __y)
+  {
+    return !(__x == __y);
+  }
+
+  template <typename Key, typename T, typename Compare, typename KC, typename MC>
+  inline bool
+  operator>(const flat_map<Key, T, Compare, KC, MC>& __x, const flat_map<Key, T, Compare, KC, MC>& __y)
+  {
+    return __y < __x;
+  }
+
+  template <typename Key, typename T, typename Compare, typename KC, typename MC>
+  inline bool
+  operator<=(const flat_map<Key, T, Compare, KC, MC>& __x, const flat_map<Key, T, Compare, KC, MC>& __y)
+  {
+    return !(__y < __x);
+  }
+
+  template <typename Key, typename T, typename Compare, typename KC, typename MC>
+  inline bool
+  operator>=(const flat_map<Key, T, Compare, KC, MC>& __x, const flat_map<Key, T, Compare, KC, MC>& __y)
+  {
+    return !(__x < __y);
+  }
+
+  /// @brief Swap the contents of two flat maps.
+  template <typename Key, typename T, typename Compare, typename KC, typename MC>
+  inline void
+  swap(flat_map<Key, T, Compare, KC, MC>& __x, flat_map<Key, T, Compare, KC, MC>& __y)
+    noexcept(noexcept(__x.swap(__y)))
+  {
+    __x.swap(__y);
+  }
+
+} // namespace ft
+
+#endif // __FT_FLAT_MAP__
@@ -0,0 +1,154 @@
+#ifndef   __FT_FLAT_MAP_ITERATOR__
+# define  __FT_FLAT_MAP_ITERATOR__
+
+# include <cstddef>     // For std::ptrdiff_t
+# include <type_traits> // For std::remove_const_t, std::enable_if_t, std::is_const
+
+# include "../iterator/iterator_base_types.h" // For random_access_iterator_tag
+# include "../utility/pair.h"                 // For ft::pair
+
+namespace ft {
+
+  /// @brief Random-access iterator over the parallel key and mapped arrays of a `flat_map`.
+  /// @details The keys and the mapped values live in separate arrays, so there is no
+  /// `value_type` object to point at: dereferencing yields a pair of references, and the
+  /// arrow operator returns a small proxy holding that pair. The iterator is a pair of
+  /// pointers moved in lockstep, so every operation is pointer arithmetic.
+  ///
+  /// @tparam _Key The key type.
+  /// @tparam _Mapped The mapped type, `const`-qualified for the constant iterator.
+  template <typename _Key, typename _Mapped>
+  struct flat_map_iterator
+  {
+    using value_type        = ft::pair<_Key, std::remove_const_t<_Mapped>>; ///< The type of the elements, by value.
+    using reference         = ft::pair<const _Key&, _Mapped&>;              ///< Pair of references to the key and the mapped value.
+    using iterator_category = random_access_iterator_tag;                   ///< The category of the iterator.
+    using difference_type   = std::ptrdiff_t;                               ///< The type used for representing the difference between two iterators.
+
+    /// @brief Proxy returned by the arrow operator, holding the pair of references.
+    struct pointer
+    {
+      reference m_ref; ///< The referenced element.
+
+      reference*
+      operator->() noexcept { return &m_ref; }
+    };
+
+    using self = flat_map_iterator<_Key, _Mapped>;
+
+    const _Key* m_key;    ///< The current key.
+    _Mapped*    m_mapped; ///< The current mapped value.
+
+    /// @brief Default constructor.
+    flat_map_iterator() noexcept
+      : m_key{ }, m_mapped{ } { }
+
+    /// @brief Constructor from a key and a mapped value pointer of the same position.
+    flat_map_iterator(const _Key* __k, _Mapped* __m) noexcept
+      : m_key{ __k }, m_mapped{ __m } { }
+
+    /// @brief Converting constructor from the mutable iterator to the constant one.
+    /// @param __it The iterator to convert.
+    template <typename _M2, typename = std::enable_if_t<
+      std::is_const<_Mapped>::value && std::is_same<const _M2, _Mapped>::value>>
+    flat_map_iterator(const flat_map_iterator<_Key, _M2>& __it) noexcept
+      : m_key{ __it.m_key }, m_mapped{ __it.m_mapped } { }
+
+    /// @brief Dereference operator.
+    /// @return References to the current key and mapped value.
+    reference
+    operator*() const noexcept { return reference(*m_key, *m_mapped); }
+
+    /// @brief Arrow operator.
+    /// @return A proxy through which `first` and `second` are reached.
+    pointer
+    operator->() const noexcept { return pointer{ **this }; }
+
+    /// @brief Subscript operator.
+    /// @return References to the element __n positions away.
+    reference
+    operator[](difference_type __n) const noexcept { return reference(m_key[__n], m_mapped[__n]); }
+
+    /// @brief Pre-increment operator.
+    self&
+    operator++() noexcept
+    {
+      ++m_key;
+      ++m_mapped;
+      return *this;
+    }
+
+    /// @brief Post-increment operator.
+    self
+    operator++(int) noexcept
+    {
+      self __tmp = *this;
+      ++*this;
+      return __tmp;
+    }
+
+    /// @brief Pre-decrement operator.
+    self&
+    operator--() noexcept
+    {
+      --m_key;
+      --m_mapped;
+      return *this;
+    }
+
+    /// @brief Post-decrement operator.
+    self
+    operator--(int) noexcept
+    {
+      self __tmp = *this;
+      --*this;
+      return __tmp;
+    }
+
+    /// @brief Advance the iterator by __n positions.
+    self&
+    operator+=(difference_type __n) noexcept
+    {
+      m_key    += __n;
+      m_mapped += __n;
+      return *this;
+    }
+
+    /// @brief Move the iterator back by __n positions.
+    self&
+    operator-=(difference_type __n) noexcept { return *this += -__n; }
+
+    friend self
+    operator+(self __x, difference_type __n) noexcept { return __x += __n; }
+
+    friend self
+    operator+(difference_type __n, self __x) noexcept { return __x += __n; }
+
+    friend self
+    operator-(self __x, difference_type __n) noexcept { return __x -= __n; }
+
+    friend difference_type
+    operator-(const self& __x, const self& __y) noexcept { return __x.m_key - __y.m_key; }
+
+    friend bool
+    operator==(const self& __x, const self& __y) noexcept { return __x.m_key == __y.m_key; }
+
+    friend bool
+    operator!=(const self& __x, const self& __y) noexcept { return __x.m_key != __y.m_key; }
+
+    friend bool
+    operator<(const self& __x, const self& __y) noexcept { return __x.m_key < __y.m_key; }
+
+    friend bool
+    operator>(const self& __x, const self& __y) noexcept { return __y < __x; }
+
+    friend bool
+    operator<=(const self& __x, const self& __y) noexcept { return !( __y < __x ); }
+
+    friend bool
+    operator>=(const self& __x, const self& __y) noexcept { return !( __x < __y ); }
+  };
+
+} // namespace ft
+
+#endif // __FT_FLAT_MAP_ITERATOR__
@@ -0,0 +1,559 @@
+#ifndef   __FT_MAP__
+# define  __FT_MAP__
+
+# include <functional>  // For std::less
+# include <memory>      // For std::allocator
+# include <stdexcept>   // For std::out_of_range
+# include <tuple>       // For std::forward_as_tuple
+# include <type_traits> // For std::enable_if_t, std::is_constructible
+# include <utility>     // For std::move, std::forward
+
+# include "../tree/rb_tree.h"           // For rb_tree
+# include "../utility/pair.h"           // For ft::pair
+# include "../utility/functional.h"     // For ft::select1st
+# include "../memory/memory_resource.h" // For polymorphic_allocator
+
+namespace ft {
+
+  template <typename, typename, typename, typename> class multimap;
+
+  /// @brief Ordered associative container of unique keys mapped to values.
+  /// @details Elements are `ft::pair<const Key, T>` kept sorted by key in a red-black tree,
+  /// so lookup, insertion and erasure are O(log n) and iteration visits keys in order.
+  template <
+    typename Key,
+    typename T,
+    typename Compare = std::less<Key>,
+    typename Alloc   = std::allocator<ft::pair<const Key, T>>
+  > class map
+  {
+    public:
+      using key_type        = Key;                      ///< The type of the keys.
+      using mapped_type     = T;                        ///< The type of the mapped values.
+      using value_type      = ft::pair<const Key, T>;   ///< The type of the stored elements.
+      using key_compare     = Compare;                  ///< The key comparison function type.
+      using allocator_type  = Alloc;                    ///< The allocator type.
+
+      /// @brief Function object comparing elements by their keys.
+      class value_compare
+      {
+        friend class map;
+
+        protected:
+          Compare comp; ///< The key comparison function.
+
+          value_compare(Compare __c) : comp{ __c } { }
+
+        public:
+          bool
+          operator()(const value_type& __x, const value_type& __y) const { return comp(__x.first, __y.first); }
+      };
+
+    private:
+      using rep_type = rb_tree<key_type, value_type, select1st<value_type>, key_compare, allocator_type>;
+
+      rep_type m_tree; ///< The red-black tree holding the elements.
+
+      template <typename, typename, typename, typename>
+      friend class map;
+      template <typename, typename, typename, typename>
+      friend class multimap;
+
+    public:
+      using pointer                = typename rep_type::pointer;                ///< Pointer type to the element.
+      using const_pointer          = typename rep_type::const_pointer;          ///< Const pointer type to the element.
+      using reference              = typename rep_type::reference;              ///< Reference type to the element.
+      using const_reference        = typename rep_type::const_reference;        ///< Const reference type to the element.
+      using iterator               = typename rep_type::iterator;               ///< Bidirectional iterator.
+      using const_iterator         = typename rep_type::const_iterator;         ///< Constant bidirectional iterator.
+      using reverse_iterator       = typename rep_type::reverse_iterator;       ///< Reverse iterator.
+      using const_reverse_iterator = typename rep_type::const_reverse_iterator; ///< Constant reverse iterator.
+      using size_type              = typename rep_type::size_type;              ///< Unsigned integer type for sizes.
+      using difference_type        = typename rep_type::difference_type;        ///< Signed integer type for distances.
+      using node_type              = typename rep_type::node_type;              ///< Owner of an extracted node.
+      using insert_return_type     = typename rep_type::insert_return_type;     ///< Result of inserting a node_type.
+
+    public:
+      /// @brief Default constructor.
+      map() = default;
+
+      /// @brief Constructor with a comparator and an allocator.
+      /// @param __comp The key comparison function.
+      /// @param __a The allocator.
+      explicit
+      map(const Compare& __comp, const allocator_type& __a = allocator_type())
+        : m_tree{ __comp, __a } { }
+
+      /// @brief Constructor with an allocator, such as a `polymorphic_allocator` on a resource.
+      /// @param __a The allocator.
+      explicit
+      map(const allocator_type& __a)
+        : m_tree{ Compare(), __a } { }
+
+      /// @brief Range constructor.
+      /// @param __first The beginning of the range to insert.
+      /// @param __last The end of the range to insert.
+      /// @details A sorted forward range is built in linear time, see `rb_tree::assign_sorted`.
+      template <typename _InputIterator>
+      map(_InputIterator __first, _InputIterator __last,
+          const Compare& __comp = Compare(), const allocator_type& __a = allocator_type())
+        : m_tree{ __comp, __a }
+      {
+        m_tree.__assign_range_unique(__first, __last);
+      }
+
+      /// @brief Range constructor building the tree on the threads of __pool.
+      /// @param __first The beginning of the range to insert.
+      /// @param __last The end of the range to insert.
+      /// @param __pool The pool the subtrees of a sorted random access range are built on;
+      /// the allocator must be safe to use from several threads. Other ranges are inserted
+      /// as by the sequential constructor.
+      /// @details Needs "tree/rb_tree_parallel.h".
+      template <typename _InputIterator>
+      map(_InputIterator __first, _InputIterator __last, work_stealing_pool& __pool,
+         const Compare& __comp = Compare(), const allocator_type& __a = allocator_type())
+        : m_tree{ __comp, __a }
+      {
+        rb_tree_parallel<rep_type>::__assign_range_unique(m_tree, __first, __last, __pool);
+      }
+
+      map(const map&) = default;
+      map(map&&) = default;
+      ~map() = default;
+
+      map& operator=(const map&) = default;
+      map& operator=(map&&) = default;
+
+      allocator_type
+      get_allocator() const noexcept { return m_tree.get_allocator(); }
+
+    public:
+      iterator               begin()         noexcept { return m_tree.begin(); }
+      const_iterator         begin()   const noexcept { return m_tree.begin(); }
+      iterator               end()           noexcept { return m_tree.end(); }
+      const_iterator         end()     const noexcept { return m_tree.end(); }
+      reverse_iterator       rbegin()        noexcept { return m_tree.rbegin(); }
+      const_reverse_iterator rbegin()  const noexcept { return m_tree.rbegin(); }
+      reverse_iterator       rend()          noexcept { return m_tree.rend(); }
+      const_reverse_iterator rend()    const noexcept { return m_tree.rend(); }
+
+    public:
+      /// @brief Call __f on every element, concurrently on the threads of __pool.
+      /// @param __f Called once per element, in no particular order and from several threads
+      /// at a time; it may modify the mapped values, but not the container.
+      /// @details Subtrees below the top levels of the tree are walked in order, one per task.
+      /// If __f throws, the exception is rethrown once every started walk has finished.
+      /// Without __pool, `default_work_stealing_pool()` is used. Needs "tree/rb_tree_parallel.h".
+      template <typename _Function>
+      void
+      parallel_for_each(_Function __f, work_stealing_pool& __pool)
+      {
+        rb_tree_parallel<rep_type>::__parallel_for_each(m_tree, __f, __pool);
+      }
+
+      template <typename _Function>
+      void
+      parallel_for_each(_Function __f)
+      {
+        rb_tree_parallel<rep_type>::__parallel_for_each(m_tree, __f);
+      }
+
+      template <typename _Function>
+      void
+      parallel_for_each(_Function __f, work_stealing_pool& __pool) const
+      {
+        rb_tree_parallel<rep_type>::__parallel_for_each(m_tree, __f, __pool);
+      }
+
+      template <typename _Function>
+      void
+      parallel_for_each(_Function __f) const
+      {
+        rb_tree_parallel<rep_type>::__parallel_for_each(m_tree, __f);
+      }
+
+    public:
+      bool      empty()    const noexcept { return m_tree.empty(); }
+      size_type size()     const noexcept { return m_tree.size(); }
+      size_type max_size() const noexcept { return m_tree.max_size(); }
+
+    public:
+      /// @brief Access the value mapped to a key, inserting a default one if needed.
+      /// @param __k The key to look up.
+      /// @return A reference to the mapped value.
+      mapped_type&
+      operator[](const key_type& __k) { return try_emplace(__k).first->second; }
+
+      mapped_type&
+      operator[](key_type&& __k) { return try_emplace(std::move(__k)).first->second; }
+
+      /// @brief Access the value mapped to a key, with bounds checking.
+      /// @throws std::out_of_range if the key is not present.
+      mapped_type&
+      at(const key_type& __k)
+      {
+        iterator __i = find(__k);
+
+        if ( __i == end() ) throw std::out_of_range("ft::map::at");
+        return __i->second;
+      }
+
+      const mapped_type&
+      at(const key_type& __k) const
+      {
+        const_iterator __i = find(__k);
+
+        if ( __i == end() ) throw std::out_of_range("ft::map::at");
+        return __i->second;
+      }
+
+    public:
+      /// @brief Insert an element if its key is not present yet.
+      /// @return An iterator to the element with that key, and whether insertion took place.
+      pair<iterator, bool>
+      insert(const value_type& __x) { return m_tree.__insert_unique(__x); }
+
+      pair<iterator, bool>
+      insert(value_type&& __x) { return m_tree.__insert_unique(std::move(__x)); }
+
+      /// @brief Insert an element constructed from __x if its key is not present yet.
+      /// @details __x is forwarded into the node, so e.g. an rvalue `ft::pair<Key, T>` is moved.
+      template <typename _Pair, typename = std::enable_if_t<std::is_constructible<value_type, _Pair&&>::value>>
+      pair<iterator, bool>
+      insert(_Pair&& __x) { return m_tree.__emplace_unique(std::forward<_Pair>(__x)); }
+
+      /// @brief Insert a copy of __x, using __pos as a hint for where it goes.
+      /// @return An iterator to the element with the key of __x.
+      /// @details O(1) amortized when __x belongs right before or right after __pos, e.g.
+      /// when feeding sorted input with `end()` as the hint.
+      iterator
+      insert(const_iterator __pos, const value_type& __x) { return m_tree.__insert_unique(__pos, __x); }
+
+      iterator
+      insert(const_iterator __pos, value_type&& __x) { return m_tree.__insert_unique(__pos, std::move(__x)); }
+
+      template <typename _Pair, typename = std::enable_if_t<std::is_constructible<value_type, _Pair&&>::value>>
+      iterator
+      insert(const_iterator __pos, _Pair&& __x) { return m_tree.__emplace_hint_unique(__pos, std::forward<_Pair>(__x)); }
+
+      /// @brief Insert every element of a range whose key is not present yet.
+      template <typename _InputIterator>
+      void
+      insert(_InputIterator __first, _InputIterator __last) { m_tree.__insert_range_unique(__first, __last); }
+
+      /// @brief Construct an element in place if its key is not present yet.
+      /// @param __args The arguments forwarded to the constructor of `value_type`.
+      /// @return An iterator to the element with that key, and whether insertion took place.
+      template <typename... _Args>
+      pair<iterator, bool>
+      emplace(_Args&&... __args) { return m_tree.__emplace_unique(std::forward<_Args>(__args)...); }
+
+      /// @brief Construct an element in place near a hint if its key is not present yet.
+      /// @return An iterator to the element with that key.
+      template <typename... _Args>
+      iterator
+      emplace_hint(const_iterator __pos, _Args&&... __args)
+      {
+        return m_tree.__emplace_hint_unique(__pos, std::forward<_Args>(__args)...);
+      }
+
+      /// @brief Construct a mapped value in place if the key is not present yet.
+      /// @param __k The key.
+      /// @param __args The arguments forwarded to the constructor of `mapped_type`.
+      /// @return An iterator to the element with that key, and whether insertion took place.
+      /// @details Unlike `emplace`, nothing is constructed or moved from when the key exists.
+      template <typename... _Args>
+      pair<iterator, bool>
+      try_emplace(const key_type& __k, _Args&&... __args)
+      {
+        return m_tree.__try_emplace_unique(__k, piecewise_construct, std::forward_as_tuple(__k),
+                                           std::forward_as_tuple(std::forward<_Args>(__args)...));
+      }
+
+      template <typename... _Args>
+      pair<iterator, bool>
+      try_emplace(key_type&& __k, _Args&&... __args)
+      {
+        return m_tree.__try_emplace_unique(__k, piecewise_construct, std::forward_as_tuple(std::move(__k)),
+                                           std::forward_as_tuple(std::forward<_Args>(__args)...));
+      }
+
+      /// @brief Construct a mapped value in place near a hint if the key is not present yet.
+      /// @param __pos A hint for the position of the element.
+      /// @return An iterator to the element with that key.
+      template <typename... _Args>
+      iterator
+      try_emplace(const_iterator __pos, const key_type& __k, _Args&&... __args)
+      {
+        return m_tree.__try_emplace_hint_unique(__pos, __k, piecewise_construct, std::forward_as_tuple(__k),
+                                                std::forward_as_tuple(std::forward<_Args>(__args)...));
+      }
+
+      template <typename... _Args>
+      iterator
+      try_emplace(const_iterator __pos, key_type&& __k, _Args&&... __args)
+      {
+        return m_tree.__try_emplace_hint_unique(__pos, __k, piecewise_construct, std::forward_as_tuple(std::move(__k)),
+                                                std::forward_as_tuple(std::forward<_Args>(__args)...));
+      }
+
+      iterator
+      erase(const_iterator __position) { return m_tree.erase(__position); }
+
+      iterator
+      erase(iterator __position) { return m_tree.erase(__position); }
+
+      size_type
+      erase(const key_type& __k) { return m_tree.erase(__k); }
+
+      iterator
+      erase(const_iterator __first, const_iterator __last) { return m_tree.erase(__first, __last); }
+
+      void
+      swap(map& __x) noexcept(noexcept(m_tree.swap(__x.m_tree))) { m_tree.swap(__x.m_tree); }
+
+      void
+      clear() noexcept { m_tree.clear(); }
+
+    public:
+      /// @brief Unlink the element at __pos and return its node.
+      /// @details The value is neither copied nor moved, and no memory is released.
+      node_type
+      extract(const_iterator __pos) { return m_tree.__extract(__pos); }
+
+      /// @brief Unlink the first element with key __k and return its node, if any.
+      node_type
+      extract(const key_type& __k) { return m_tree.__extract(__k); }
+
+      /// @brief Insert the node held by __nh if its key is not present yet.
+      /// @return Where the key is, whether the node was inserted, and the node if it was not.
+      insert_return_type
+      insert(node_type&& __nh) { return m_tree.__reinsert_node_unique(std::move(__nh)); }
+
+      /// @brief Insert the node held by __nh, using __pos as a hint for where it goes.
+      iterator
+      insert(const_iterator __pos, node_type&& __nh) { return m_tree.__reinsert_node_hint_unique(__pos, std::move(__nh)); }
+
+      /// @brief Move the elements of __src whose keys are not present here into this container.
+      /// @details Nodes are relinked, not copied, when the allocators compare equal; elements
+      /// whose keys are already present stay in __src.
+      template <typename _Compare2>
+      void
+      merge(map<Key, T, _Compare2, Alloc>& __src) { m_tree.__merge_unique(__src.m_tree); }
+
+      template <typename _Compare2>
+      void
+      merge(map<Key, T, _Compare2, Alloc>&& __src) { merge(__src); }
+
+      template <typename _Compare2>
+      void
+      merge(multimap<Key, T, _Compare2, Alloc>& __src) { m_tree.__merge_unique(__src.m_tree); }
+
+      template <typename _Compare2>
+      void
+      merge(multimap<Key, T, _Compare2, Alloc>&& __src) { merge(__src); }
+
+    public:
+      key_compare
+      key_comp() const { return m_tree.key_comp(); }
+
+      value_compare
+      value_comp() const { return value_compare(m_tree.key_comp()); }
+
+    public:
+      iterator       find(const key_type& __k)       { return m_tree.find(__k); }
+      const_iterator find(const key_type& __k) const { return m_tree.find(__k); }
+
+      size_type
+      count(const key_type& __k) const { return m_tree.find(__k) == m_tree.end() ? 0 : 1; }
+
+      iterator       lower_bound(const key_type& __k)       { return m_tree.lower_bound(__k); }
+      const_iterator lower_bound(const key_type& __k) const { return m_tree.lower_bound(__k); }
+      iterator       upper_bound(const key_type& __k)       { return m_tree.upper_bound(__k); }
+      const_iterator upper_bound(const key_type& __k) const { return m_tree.upper_bound(__k); }
+
+      pair<iterator, iterator>
+      equal_range(const key_type& __k) { return m_tree.equal_range(__k); }
+
+      pair<const_iterator, const_iterator>
+      equal_range(const key_type& __k) const { return m_tree.equal_range(__k); }
+
+    public:
+      /// @brief Heterogeneous lookup, available when the comparator is transparent.
+      /// @details These overloads compare __x against the keys directly, so looking up a
+      /// `std::string` key by `const char*` or `std::string_view` allocates nothing.
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      iterator
+      find(const _Kt& __x) { return m_tree.find(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      const_iterator
+      find(const _Kt& __x) const { return m_tree.find(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      size_type
+      count(const _Kt& __x) const { return m_tree.count(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      iterator
+      lower_bound(const _Kt& __x) { return m_tree.lower_bound(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      const_iterator
+      lower_bound(const _Kt& __x) const { return m_tree.lower_bound(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      iterator
+      upper_bound(const _Kt& __x) { return m_tree.upper_bound(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      const_iterator
+      upper_bound(const _Kt& __x) const { return m_tree.upper_bound(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      pair<iterator, iterator>
+      equal_range(const _Kt& __x) { return m_tree.equal_range(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      pair<const_iterator, const_iterator>
+      equal_range(const _Kt& __x) const { return m_tree.equal_range(__x); }
+
+    public:
+      /// @brief Batched lookup: write `find(__k)` for each key of [__first, __last) to __out.
+      /// @details The descents of several keys are interleaved so that their cache misses
+      /// overlap, which pays off for large maps; see `rb_tree::find_many`.
+      template <typename _ForwardIterator, typename _OutputIterator>
+      _OutputIterator
+      find_many(_ForwardIterator __first, _ForwardIterator __last, _OutputIterator __out)
+      {
+        return m_tree.find_many(__first, __last, __out);
+      }
+
+      template <typename _ForwardIterator, typename _OutputIterator>
+      _OutputIterator
+      find_many(_ForwardIterator __first, _ForwardIterator __last, _OutputIterator __out) const
+      {
+        return m_tree.find_many(__first, __last, __out);
+      }
+
+      /// @brief Batched lookup: write `lower_bound(__k)` for each key of [__first, __last) to __out.
+      template <typename _ForwardIterator, typename _OutputIterator>
+      _OutputIterator
+      lower_bound_many(_ForwardIterator __first, _ForwardIterator __last, _OutputIterator __out)
+      {
+        return m_tree.lower_bound_many(__first, __last, __out);
+      }
+
+      template <typename _ForwardIterator, typename _OutputIterator>
+      _OutputIterator
+      lower_bound_many(_ForwardIterator __first, _ForwardIterator __last, _OutputIterator __out) const
+      {
+        return m_tree.lower_bound_many(__first, __last, __out);
+      }
+
+# if defined(FT_RB_TREE_ORDER_STATISTICS)
+    public:
+      /// @brief Get the number of elements before __pos, in O(log n).
+      size_type
+      rank(const_iterator __pos) const noexcept { return m_tree.rank(__pos); }
+
+      /// @brief Get the element at position __k in key order, or end(), in O(log n).
+      iterator
+      select(size_type __k) noexcept { return m_tree.select(__k); }
+
+      const_iterator
+      select(size_type __k) const noexcept { return m_tree.select(__k); }
+
+      /// @brief Count the elements whose keys lie in [__a, __b), in O(log n).
+      size_type
+      count_range(const key_type& __a, const key_type& __b) const { return m_tree.count_range(__a, __b); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      size_type
+      count_range(const _Kt& __a, const _Kt& __b) const { return m_tree.count_range(__a, __b); }
+# endif
+
+    public:
+      /// @brief Measure the height, black height, size and depth histogram of the tree, in O(n).
+      rb_tree_stats
+      stats() const { return m_tree.stats(); }
+
+# if defined(FT_INSTRUMENT)
+      /// @brief Get the comparisons, rotations, recolorings, allocations and node visits so far.
+      rb_tree_counters
+      counters() const noexcept { return m_tree.counters(); }
+
+      void
+      reset_counters() noexcept { m_tree.reset_counters(); }
+# endif
+
+    public:
+      template <typename K1, typename T1, typename C1, typename A1>
+      friend bool operator==(const map<K1, T1, C1, A1>&, const map<K1, T1, C1, A1>&);
+
+      template <typename K1, typename T1, typename C1, typename A1>
+      friend bool operator<(const map<K1, T1, C1, A1>&, const map<K1, T1, C1, A1>&);
+  };
+
+  template <typename Key, typename T, typename Compare, typename Alloc>
+  inline bool
+  operator==(const map<Key, T, Compare, Alloc>& __x, const map<Key, T, Compare, Alloc>& __y)
+  {
+    return __x.m_tree == __y.m_tree;
+  }
+
+  template <typename Key, typename T, typename Compare, typename Alloc>
+  inline bool
+  operator<(const map<Key, T, Compare, Alloc>& __x, const map<Key, T, Compare, Alloc>& __y)
+  {
+    return __x.m_tree < __y.m_tree;
+  }
+
+  template <typename Key, typename T, typename Compare, typename Alloc>
+  inline bool
+  operator!=(const map<Key, T, Compare, Alloc>& __x, const map<Key, T, Compare, Alloc>& __y)
+  {
+    return !(__x == __y);
+  }
+
+  template <typename Key, typename T, typename Compare, typename Alloc>
+  inline bool
+  operator>(const map<Key, T, Compare, Alloc>& __x, const map<Key, T, Compare, Alloc>& __y)
+  {
+    return __y < __x;
+  }
+
+  template <typename Key, typename T, typename Compare, typename Alloc>
+  inline bool
+  operator<=(const map<Key, T, Compare, Alloc>& __x, const map<Key, T, Compare, Alloc>& __y)
+  {
+    return !(__y < __x);
+  }
+
+  template <typename Key, typename T, typename Compare, typename Alloc>
+  inline bool
+  operator>=(const map<Key, T, Compare, Alloc>& __x, const map<Key, T, Compare, Alloc>& __y)
+  {
+    return !(__x < __y);
+  }
+
+  /// @brief Swap the contents of two maps.
+  template <typename Key, typename T, typename Compare, typename Alloc>
+  inline void
+  swap(map<Key, T, Compare, Alloc>& __x, map<Key, T, Compare, Alloc>& __y)
+    noexcept(noexcept(__x.swap(__y)))
+  {
+    __x.swap(__y);
+  }
+
+  namespace pmr {
+
+    /// @brief `map` drawing its nodes from a `memory_resource`.
+    template <typename Key, typename T, typename Compare = std::less<Key>>
+    using map = ft::map<Key, T, Compare, polymorphic_allocator<ft::pair<const Key, T>>>;
+
+  } // namespace pmr
+
+} // namespace ft
+
+#endif // __FT_MAP__
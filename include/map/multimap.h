@@ -0,0 +1,485 @@
+#ifndef   __FT_MULTIMAP__
+# define  __FT_MULTIMAP__
+
+# include <functional>  // For std::less
+# include <memory>      // For std::allocator
+# include <type_traits> // For std::enable_if_t, std::is_constructible
+# include <utility>     // For std::move, std::forward
+
+# include "../tree/rb_tree.h"           // For rb_tree
+# include "../utility/pair.h"           // For ft::pair
+# include "../utility/functional.h"     // For ft::select1st
+# include "../memory/memory_resource.h" // For polymorphic_allocator
+
+namespace ft {
+
+  template <typename, typename, typename, typename> class map;
+
+  /// @brief Ordered associative container of keys mapped to values, allowing duplicate keys.
+  /// @details Elements are `ft::pair<const Key, T>` kept sorted by key in a red-black tree.
+  /// Elements with equivalent keys are kept in insertion order.
+  template <
+    typename Key,
+    typename T,
+    typename Compare = std::less<Key>,
+    typename Alloc   = std::allocator<ft::pair<const Key, T>>
+  > class multimap
+  {
+    public:
+      using key_type        = Key;                      ///< The type of the keys.
+      using mapped_type     = T;                        ///< The type of the mapped values.
+      using value_type      = ft::pair<const Key, T>;   ///< The type of the stored elements.
+      using key_compare     = Compare;                  ///< The key comparison function type.
+      using allocator_type  = Alloc;                    ///< The allocator type.
+
+      /// @brief Function object comparing elements by their keys.
+      class value_compare
+      {
+        friend class multimap;
+
+        protected:
+          Compare comp; ///< The key comparison function.
+
+          value_compare(Compare __c) : comp{ __c } { }
+
+        public:
+          bool
+          operator()(const value_type& __x, const value_type& __y) const { return comp(__x.first, __y.first); }
+      };
+
+    private:
+      using rep_type = rb_tree<key_type, value_type, select1st<value_type>, key_compare, allocator_type>;
+
+      rep_type m_tree; ///< The red-black tree holding the elements.
+
+      template <typename, typename, typename, typename>
+      friend class multimap;
+      template <typename, typename, typename, typename>
+      friend class map;
+
+    public:
+      using pointer                = typename rep_type::pointer;                ///< Pointer type to the element.
+      using const_pointer          = typename rep_type::const_pointer;          ///< Const pointer type to the element.
+      using reference              = typename rep_type::reference;              ///< Reference type to the element.
+      using const_reference        = typename rep_type::const_reference;        ///< Const reference type to the element.
+      using iterator               = typename rep_type::iterator;               ///< Bidirectional iterator.
+      using const_iterator         = typename rep_type::const_iterator;         ///< Constant bidirectional iterator.
+      using reverse_iterator       = typename rep_type::reverse_iterator;       ///< Reverse iterator.
+      using const_reverse_iterator = typename rep_type::const_reverse_iterator; ///< Constant reverse iterator.
+      using size_type              = typename rep_type::size_type;              ///< Unsigned integer type for sizes.
+      using difference_type        = typename rep_type::difference_type;        ///< Signed integer type for distances.
+      using node_type              = typename rep_type::node_type;              ///< Owner of an extracted node.
+
+    public:
+      /// @brief Default constructor.
+      multimap() = default;
+
+      /// @brief Constructor with a comparator and an allocator.
+      /// @param __comp The key comparison function.
+      /// @param __a The allocator.
+      explicit
+      multimap(const Compare& __comp, const allocator_type& __a = allocator_type())
+        : m_tree{ __comp, __a } { }
+
+      /// @brief Constructor with an allocator, such as a `polymorphic_allocator` on a resource.
+      /// @param __a The allocator.
+      explicit
+      multimap(const allocator_type& __a)
+        : m_tree{ Compare(), __a } { }
+
+      /// @brief Range constructor.
+      /// @param __first The beginning of the range to insert.
+      /// @param __last The end of the range to insert.
+      /// @details A sorted forward range is built in linear time, see `rb_tree::assign_sorted`.
+      template <typename _InputIterator>
+      multimap(_InputIterator __first, _InputIterator __last,
+          const Compare& __comp = Compare(), const allocator_type& __a = allocator_type())
+        : m_tree{ __comp, __a }
+      {
+        m_tree.__assign_range_equal(__first, __last);
+      }
+
+      /// @brief Range constructor building the tree on the threads of __pool.
+      /// @param __first The beginning of the range to insert.
+      /// @param __last The end of the range to insert.
+      /// @param __pool The pool the subtrees of a sorted random access range are built on;
+      /// the allocator must be safe to use from several threads. Other ranges are inserted
+      /// as by the sequential constructor.
+      /// @details Needs "tree/rb_tree_parallel.h".
+      template <typename _InputIterator>
+      multimap(_InputIterator __first, _InputIterator __last, work_stealing_pool& __pool,
+              const Compare& __comp = Compare(), const allocator_type& __a = allocator_type())
+        : m_tree{ __comp, __a }
+      {
+        rb_tree_parallel<rep_type>::__assign_range_equal(m_tree, __first, __last, __pool);
+      }
+
+      multimap(const multimap&) = default;
+      multimap(multimap&&) = default;
+      ~multimap() = default;
+
+      multimap& operator=(const multimap&) = default;
+      multimap& operator=(multimap&&) = default;
+
+      allocator_type
+      get_allocator() const noexcept { return m_tree.get_allocator(); }
+
+    public:
+      iterator               begin()         noexcept { return m_tree.begin(); }
+      const_iterator         begin()   const noexcept { return m_tree.begin(); }
+      iterator               end()           noexcept { return m_tree.end(); }
+      const_iterator         end()     const noexcept { return m_tree.end(); }
+      reverse_iterator       rbegin()        noexcept { return m_tree.rbegin(); }
+      const_reverse_iterator rbegin()  const noexcept { return m_tree.rbegin(); }
+      reverse_iterator       rend()          noexcept { return m_tree.rend(); }
+      const_reverse_iterator rend()    const noexcept { return m_tree.rend(); }
+
+    public:
+      /// @brief Call __f on every element, concurrently on the threads of __pool.
+      /// @param __f Called once per element, in no particular order and from several threads
+      /// at a time; it may modify the mapped values, but not the container.
+      /// @details Subtrees below the top levels of the tree are walked in order, one per task.
+      /// If __f throws, the exception is rethrown once every started walk has finished.
+      /// Without __pool, `default_work_stealing_pool()` is used. Needs "tree/rb_tree_parallel.h".
+      template <typename _Function>
+      void
+      parallel_for_each(_Function __f, work_stealing_pool& __pool)
+      {
+        rb_tree_parallel<rep_type>::__parallel_for_each(m_tree, __f, __pool);
+      }
+
+      template <typename _Function>
+      void
+      parallel_for_each(_Function __f)
+      {
+        rb_tree_parallel<rep_type>::__parallel_for_each(m_tree, __f);
+      }
+
+      template <typename _Function>
+      void
+      parallel_for_each(_Function __f, work_stealing_pool& __pool) const
+      {
+        rb_tree_parallel<rep_type>::__parallel_for_each(m_tree, __f, __pool);
+      }
+
+      template <typename _Function>
+      void
+      parallel_for_each(_Function __f) const
+      {
+        rb_tree_parallel<rep_type>::__parallel_for_each(m_tree, __f);
+      }
+
+    public:
+      bool      empty()    const noexcept { return m_tree.empty(); }
+      size_type size()     const noexcept { return m_tree.size(); }
+      size_type max_size() const noexcept { return m_tree.max_size(); }
+
+    public:
+      /// @brief Insert an element after any elements with an equivalent key.
+      /// @return An iterator to the new element.
+      iterator
+      insert(const value_type& __x) { return m_tree.__insert_equal(__x); }
+
+      iterator
+      insert(value_type&& __x) { return m_tree.__insert_equal(std::move(__x)); }
+
+      /// @brief Insert an element constructed from __x after any elements with an equivalent key.
+      /// @details __x is forwarded into the node, so e.g. an rvalue `ft::pair<Key, T>` is moved.
+      template <typename _Pair, typename = std::enable_if_t<std::is_constructible<value_type, _Pair&&>::value>>
+      iterator
+      insert(_Pair&& __x) { return m_tree.__emplace_equal(std::forward<_Pair>(__x)); }
+
+      /// @brief Insert a copy of __x, using __pos as a hint for where it goes.
+      /// @return An iterator to the element with the key of __x.
+      /// @details O(1) amortized when __x belongs right before or right after __pos, e.g.
+      /// when feeding sorted input with `end()` as the hint.
+      iterator
+      insert(const_iterator __pos, const value_type& __x) { return m_tree.__insert_equal(__pos, __x); }
+
+      iterator
+      insert(const_iterator __pos, value_type&& __x) { return m_tree.__insert_equal(__pos, std::move(__x)); }
+
+      template <typename _Pair, typename = std::enable_if_t<std::is_constructible<value_type, _Pair&&>::value>>
+      iterator
+      insert(const_iterator __pos, _Pair&& __x) { return m_tree.__emplace_hint_equal(__pos, std::forward<_Pair>(__x)); }
+
+      /// @brief Insert every element of a range.
+      template <typename _InputIterator>
+      void
+      insert(_InputIterator __first, _InputIterator __last) { m_tree.__insert_range_equal(__first, __last); }
+
+      /// @brief Construct an element in place after any elements with an equivalent key.
+      /// @param __args The arguments forwarded to the constructor of `value_type`.
+      /// @return An iterator to the new element.
+      template <typename... _Args>
+      iterator
+      emplace(_Args&&... __args) { return m_tree.__emplace_equal(std::forward<_Args>(__args)...); }
+
+      /// @brief Construct an element in place near a hint.
+      /// @return An iterator to the new element.
+      template <typename... _Args>
+      iterator
+      emplace_hint(const_iterator __pos, _Args&&... __args)
+      {
+        return m_tree.__emplace_hint_equal(__pos, std::forward<_Args>(__args)...);
+      }
+
+      iterator
+      erase(const_iterator __position) { return m_tree.erase(__position); }
+
+      iterator
+      erase(iterator __position) { return m_tree.erase(__position); }
+
+      size_type
+      erase(const key_type& __k) { return m_tree.erase(__k); }
+
+      iterator
+      erase(const_iterator __first, const_iterator __last) { return m_tree.erase(__first, __last); }
+
+      void
+      swap(multimap& __x) noexcept(noexcept(m_tree.swap(__x.m_tree))) { m_tree.swap(__x.m_tree); }
+
+      void
+      clear() noexcept { m_tree.clear(); }
+
+    public:
+      /// @brief Unlink the element at __pos and return its node.
+      /// @details The value is neither copied nor moved, and no memory is released.
+      node_type
+      extract(const_iterator __pos) { return m_tree.__extract(__pos); }
+
+      /// @brief Unlink the first element with key __k and return its node, if any.
+      node_type
+      extract(const key_type& __k) { return m_tree.__extract(__k); }
+
+      /// @brief Insert the node held by __nh after any elements with an equivalent key.
+      /// @return An iterator to the inserted element, or end() if __nh was empty.
+      iterator
+      insert(node_type&& __nh) { return m_tree.__reinsert_node_equal(std::move(__nh)); }
+
+      /// @brief Insert the node held by __nh, using __pos as a hint for where it goes.
+      iterator
+      insert(const_iterator __pos, node_type&& __nh) { return m_tree.__reinsert_node_hint_equal(__pos, std::move(__nh)); }
+
+      /// @brief Move every element of __src into this container.
+      /// @details Nodes are relinked, not copied, when the allocators compare equal.
+      template <typename _Compare2>
+      void
+      merge(multimap<Key, T, _Compare2, Alloc>& __src) { m_tree.__merge_equal(__src.m_tree); }
+
+      template <typename _Compare2>
+      void
+      merge(multimap<Key, T, _Compare2, Alloc>&& __src) { merge(__src); }
+
+      template <typename _Compare2>
+      void
+      merge(map<Key, T, _Compare2, Alloc>& __src) { m_tree.__merge_equal(__src.m_tree); }
+
+      template <typename _Compare2>
+      void
+      merge(map<Key, T, _Compare2, Alloc>&& __src) { merge(__src); }
+
+    public:
+      key_compare
+      key_comp() const { return m_tree.key_comp(); }
+
+      value_compare
+      value_comp() const { return value_compare(m_tree.key_comp()); }
+
+    public:
+      iterator       find(const key_type& __k)       { return m_tree.find(__k); }
+      const_iterator find(const key_type& __k) const { return m_tree.find(__k); }
+
+      size_type
+      count(const key_type& __k) const { return m_tree.count(__k); }
+
+      iterator       lower_bound(const key_type& __k)       { return m_tree.lower_bound(__k); }
+      const_iterator lower_bound(const key_type& __k) const { return m_tree.lower_bound(__k); }
+      iterator       upper_bound(const key_type& __k)       { return m_tree.upper_bound(__k); }
+      const_iterator upper_bound(const key_type& __k) const { return m_tree.upper_bound(__k); }
+
+      pair<iterator, iterator>
+      equal_range(const key_type& __k) { return m_tree.equal_range(__k); }
+
+      pair<const_iterator, const_iterator>
+      equal_range(const key_type& __k) const { return m_tree.equal_range(__k); }
+
+    public:
+      /// @brief Heterogeneous lookup, available when the comparator is transparent.
+      /// @details These overloads compare __x against the keys directly, so looking up a
+      /// `std::string` key by `const char*` or `std::string_view` allocates nothing.
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      iterator
+      find(const _Kt& __x) { return m_tree.find(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      const_iterator
+      find(const _Kt& __x) const { return m_tree.find(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      size_type
+      count(const _Kt& __x) const { return m_tree.count(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      iterator
+      lower_bound(const _Kt& __x) { return m_tree.lower_bound(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      const_iterator
+      lower_bound(const _Kt& __x) const { return m_tree.lower_bound(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      iterator
+      upper_bound(const _Kt& __x) { return m_tree.upper_bound(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      const_iterator
+      upper_bound(const _Kt& __x) const { return m_tree.upper_bound(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      pair<iterator, iterator>
+      equal_range(const _Kt& __x) { return m_tree.equal_range(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      pair<const_iterator, const_iterator>
+      equal_range(const _Kt& __x) const { return m_tree.equal_range(__x); }
+
+    public:
+      /// @brief Batched lookup: write `find(__k)` for each key of [__first, __last) to __out.
+      /// @details The descents of several keys are interleaved so that their cache misses
+      /// overlap, which pays off for large maps; see `rb_tree::find_many`.
+      template <typename _ForwardIterator, typename _OutputIterator>
+      _OutputIterator
+      find_many(_ForwardIterator __first, _ForwardIterator __last, _OutputIterator __out)
+      {
+        return m_tree.find_many(__first, __last, __out);
+      }
+
+      template <typename _ForwardIterator, typename _OutputIterator>
+      _OutputIterator
+      find_many(_ForwardIterator __first, _ForwardIterator __last, _OutputIterator __out) const
+      {
+        return m_tree.find_many(__first, __last, __out);
+      }
+
+      /// @brief Batched lookup: write `lower_bound(__k)` for each key of [__first, __last) to __out.
+      template <typename _ForwardIterator, typename _OutputIterator>
+      _OutputIterator
+      lower_bound_many(_ForwardIterator __first, _ForwardIterator __last, _OutputIterator __out)
+      {
+        return m_tree.lower_bound_many(__first, __last, __out);
+      }
+
+      template <typename _ForwardIterator, typename _OutputIterator>
+      _OutputIterator
+      lower_bound_many(_ForwardIterator __first, _ForwardIterator __last, _OutputIterator __out) const
+      {
+        return m_tree.lower_bound_many(__first, __last, __out);
+      }
+
+# if defined(FT_RB_TREE_ORDER_STATISTICS)
+    public:
+      /// @brief Get the number of elements before __pos, in O(log n).
+      size_type
+      rank(const_iterator __pos) const noexcept { return m_tree.rank(__pos); }
+
+      /// @brief Get the element at position __k in key order, or end(), in O(log n).
+      iterator
+      select(size_type __k) noexcept { return m_tree.select(__k); }
+
+      const_iterator
+      select(size_type __k) const noexcept { return m_tree.select(__k); }
+
+      /// @brief Count the elements whose keys lie in [__a, __b), in O(log n).
+      size_type
+      count_range(const key_type& __a, const key_type& __b) const { return m_tree.count_range(__a, __b); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      size_type
+      count_range(const _Kt& __a, const _Kt& __b) const { return m_tree.count_range(__a, __b); }
+# endif
+
+    public:
+      /// @brief Measure the height, black height, size and depth histogram of the tree, in O(n).
+      rb_tree_stats
+      stats() const { return m_tree.stats(); }
+
+# if defined(FT_INSTRUMENT)
+      /// @brief Get the comparisons, rotations, recolorings, allocations and node visits so far.
+      rb_tree_counters
+      counters() const noexcept { return m_tree.counters(); }
+
+      void
+      reset_counters() noexcept { m_tree.reset_counters(); }
+# endif
+
+    public:
+      template <typename K1, typename T1, typename C1, typename A1>
+      friend bool operator==(const multimap<K1, T1, C1, A1>&, const multimap<K1, T1, C1, A1>&);
+
+      template <typename K1, typename T1, typename C1, typename A1>
+      friend bool operator<(const multimap<K1, T1, C1, A1>&, const multimap<K1, T1, C1, A1>&);
+  };
+
+  template <typename Key, typename T, typename Compare, typename Alloc>
+  inline bool
+  operator==(const multimap<Key, T, Compare, Alloc>& __x, const multimap<Key, T, Compare, Alloc>& __y)
+  {
+    return __x.m_tree == __y.m_tree;
+  }
+
+  template <typename Key, typename T, typename Compare, typename Alloc>
+  inline bool
+  operator<(const multimap<Key, T, Compare, Alloc>& __x, const multimap<Key, T, Compare, Alloc>& __y)
+  {
+    return __x.m_tree < __y.m_tree;
+  }
+
+  template <typename Key, typename T, typename Compare, typename Alloc>
+  inline bool
+  operator!=(const multimap<Key, T, Compare, Alloc>& __x, const multimap<Key, T, Compare, Alloc>& __y)
+  {
+    return !(__x == __y);
+  }
+
+  template <typename Key, typename T, typename Compare, typename Alloc>
+  inline bool
+  operator>(const multimap<Key, T, Compare, Alloc>& __x, const multimap<Key, T, Compare, Alloc>& __y)
+  {
+    return __y < __x;
+  }
+
+  template <typename Key, typename T, typename Compare, typename Alloc>
+  inline bool
+  operator<=(const multimap<Key, T, Compare, Alloc>& __x, const multimap<Key, T, Compare, Alloc>& __y)
+  {
+    return !(__y < __x);
+  }
+
+  template <typename Key, typename T, typename Compare, typename Alloc>
+  inline bool
+  operator>=(const multimap<Key, T, Compare, Alloc>& __x, const multimap<Key, T, Compare, Alloc>& __y)
+  {
+    return !(__x < __y);
+  }
+
+  /// @brief Swap the contents of two multimaps.
+  template <typename Key, typename T, typename Compare, typename Alloc>
+  inline void
+  swap(multimap<Key, T, Compare, Alloc>& __x, multimap<Key, T, Compare, Alloc>& __y)
+    noexcept(noexcept(__x.swap(__y)))
+  {
+    __x.swap(__y);
+  }
+
+  namespace pmr {
+
+    /// @brief `multimap` drawing its nodes from a `memory_resource`.
+    template <typename Key, typename T, typename Compare = std::less<Key>>
+    using multimap = ft::multimap<Key, T, Compare, polymorphic_allocator<ft::pair<const Key, T>>>;
+
+  } // namespace pmr
+
+} // namespace ft
+
+#endif // __FT_MULTIMAP__
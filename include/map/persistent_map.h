@@ -0,0 +1,321 @@
+#ifndef   __FT_PERSISTENT_MAP__
+# define  __FT_PERSISTENT_MAP__
+
+# include <functional>  // For std::less
+# include <memory>      // For std::allocator
+# include <stdexcept>   // For std::out_of_range
+# include <tuple>       // For std::forward_as_tuple
+# include <type_traits> // For std::enable_if_t, std::is_constructible
+# include <utility>     // For std::move, std::forward
+
+# include "../tree/persistent_rb_tree.h" // For persistent_rb_tree
+# include "../utility/pair.h"            // For ft::pair
+# include "../utility/functional.h"      // For ft::select1st
+
+namespace ft {
+
+  /// @brief Ordered map of unique keys with O(1) copies and snapshots.
+  /// @details The elements live in a `persistent_rb_tree`: copying the map, or taking a
+  /// `snapshot()`, shares every node with it, and each later update of either copies only
+  /// the O(log n) nodes it changes. A snapshot is therefore a consistent view that can be
+  /// checkpointed or scanned at leisure, from another thread if need be, while the map
+  /// keeps changing.
+  ///
+  /// Elements may be shared between versions, so they are only reachable through constant
+  /// iterators; `insert_or_assign` and `modify` change a mapped value in a private copy.
+  /// Every update invalidates the iterators of the map it is applied to, never those of
+  /// other versions.
+  template <
+    typename Key,
+    typename T,
+    typename Compare = std::less<Key>,
+    typename Alloc   = std::allocator<ft::pair<const Key, T>>
+  > class persistent_map
+  {
+    public:
+      using key_type        = Key;                      ///< The type of the keys.
+      using mapped_type     = T;                        ///< The type of the mapped values.
+      using value_type      = ft::pair<const Key, T>;   ///< The type of the stored elements.
+      using key_compare     = Compare;                  ///< The key comparison function type.
+      using allocator_type  = Alloc;                    ///< The allocator type.
+
+      /// @brief Function object comparing elements by their keys.
+      class value_compare
+      {
+        friend class persistent_map;
+
+        protected:
+          Compare comp; ///< The key comparison function.
+
+          value_compare(Compare __c) : comp{ __c } { }
+
+        public:
+          bool
+          operator()(const value_type& __x, const value_type& __y) const { return comp(__x.first, __y.first); }
+      };
+
+    private:
+      using rep_type = persistent_rb_tree<key_type, value_type, select1st<value_type>, key_compare, allocator_type>;
+
+      rep_type m_tree; ///< The persistent tree holding the elements.
+
+    public:
+      using pointer                = typename rep_type::pointer;                ///< Pointer type to the element.
+      using const_pointer          = typename rep_type::const_pointer;          ///< Const pointer type to the element.
+      using reference              = typename rep_type::reference;              ///< Reference type to the element.
+      using const_reference        = typename rep_type::const_reference;        ///< Const reference type to the element.
+      using iterator               = typename rep_type::iterator;               ///< Constant bidirectional iterator.
+      using const_iterator         = typename rep_type::const_iterator;         ///< Constant bidirectional iterator.
+      using reverse_iterator       = typename rep_type::reverse_iterator;       ///< Constant reverse iterator.
+      using const_reverse_iterator = typename rep_type::const_reverse_iterator; ///< Constant reverse iterator.
+      using size_type              = typename rep_type::size_type;              ///< Unsigned integer type for sizes.
+      using difference_type        = typename rep_type::difference_type;        ///< Signed integer type for distances.
+
+    public:
+      /// @brief Default constructor.
+      persistent_map() = default;
+
+      /// @brief Constructor with a comparator and an allocator.
+      /// @param __comp The key comparison function.
+      /// @param __a The allocator.
+      explicit
+      persistent_map(const Compare& __comp, const allocator_type& __a = allocator_type())
+        : m_tree{ __comp, __a } { }
+
+      /// @brief Range constructor.
+      /// @param __first The beginning of the range to insert.
+      /// @param __last The end of the range to insert.
+      template <typename _InputIterator>
+      persistent_map(_InputIterator __first, _InputIterator __last,
+                     const Compare& __comp = Compare(), const allocator_type& __a = allocator_type())
+        : m_tree{ __comp, __a }
+      {
+        m_tree.__insert_range_unique(__first, __last);
+      }
+
+      /// @brief Copy constructor. O(1): the copy shares every node with __x.
+      persistent_map(const persistent_map&) = default;
+      persistent_map(persistent_map&&) = default;
+      ~persistent_map() = default;
+
+      persistent_map& operator=(const persistent_map&) = default;
+      persistent_map& operator=(persistent_map&&) = default;
+
+      /// @brief Take a snapshot of the map, in O(1).
+      /// @return A map that later updates of this one leave unchanged, and vice versa.
+      persistent_map
+      snapshot() const { return *this; }
+
+      allocator_type
+      get_allocator() const noexcept { return m_tree.get_allocator(); }
+
+    public:
+      const_iterator         begin()   const noexcept { return m_tree.begin(); }
+      const_iterator         end()     const noexcept { return m_tree.end(); }
+      const_reverse_iterator rbegin()  const noexcept { return m_tree.rbegin(); }
+      const_reverse_iterator rend()    const noexcept { return m_tree.rend(); }
+
+    public:
+      bool      empty()    const noexcept { return m_tree.empty(); }
+      size_type size()     const noexcept { return m_tree.size(); }
+      size_type max_size() const noexcept { return m_tree.max_size(); }
+
+    public:
+      /// @brief Access the value mapped to a key, with bounds checking.
+      /// @throws std::out_of_range if the key is not present.
+      const mapped_type&
+      at(const key_type& __k) const
+      {
+        const_iterator __i = find(__k);
+
+        if ( __i == end() ) throw std::out_of_range("ft::persistent_map::at");
+        return __i->second;
+      }
+
+    public:
+      /// @brief Insert an element if its key is not present yet.
+      /// @return An iterator to the element with that key, and whether insertion took place.
+      pair<iterator, bool>
+      insert(const value_type& __x) { return m_tree.__insert_unique(__x); }
+
+      pair<iterator, bool>
+      insert(value_type&& __x) { return m_tree.__insert_unique(std::move(__x)); }
+
+      /// @brief Insert an element constructed from __x if its key is not present yet.
+      template <typename _Pair, typename = std::enable_if_t<std::is_constructible<value_type, _Pair&&>::value>>
+      pair<iterator, bool>
+      insert(_Pair&& __x) { return m_tree.__emplace_unique(std::forward<_Pair>(__x)); }
+
+      /// @brief Insert every element of a range whose key is not present yet.
+      template <typename _InputIterator>
+      void
+      insert(_InputIterator __first, _InputIterator __last) { m_tree.__insert_range_unique(__first, __last); }
+
+      /// @brief Construct an element in place if its key is not present yet.
+      /// @return An iterator to the element with that key, and whether insertion took place.
+      template <typename... _Args>
+      pair<iterator, bool>
+      emplace(_Args&&... __args) { return m_tree.__emplace_unique(std::forward<_Args>(__args)...); }
+
+      /// @brief Construct a mapped value in place if the key is not present yet.
+      /// @return An iterator to the element with that key, and whether insertion took place.
+      /// @details Unlike `emplace`, nothing is constructed or moved from when the key exists.
+      template <typename... _Args>
+      pair<iterator, bool>
+      try_emplace(const key_type& __k, _Args&&... __args)
+      {
+        return m_tree.__try_emplace_unique(__k, piecewise_construct, std::forward_as_tuple(__k),
+                                           std::forward_as_tuple(std::forward<_Args>(__args)...));
+      }
+
+      template <typename... _Args>
+      pair<iterator, bool>
+      try_emplace(key_type&& __k, _Args&&... __args)
+      {
+        return m_tree.__try_emplace_unique(__k, piecewise_construct, std::forward_as_tuple(std::move(__k)),
+                                           std::forward_as_tuple(std::forward<_Args>(__args)...));
+      }
+
+      /// @brief Insert an element, or assign to the mapped value if the key is present.
+      /// @return An iterator to the element with that key, and whether insertion took place.
+      template <typename _Obj>
+      pair<iterator, bool>
+      insert_or_assign(const key_type& __k, _Obj&& __obj)
+      {
+        iterator __i = m_tree.__modify_unique(__k, [&](value_type& __v) { __v.second = std::forward<_Obj>(__obj); });
+
+        if ( __i != end() ) return pair<iterator, bool>(__i, false);
+        return try_emplace(__k, std::forward<_Obj>(__obj));
+      }
+
+      /// @brief Apply __fn to the mapped value of key __k, if present.
+      /// @param __fn Called with a `mapped_type&` private to this map.
+      /// @return An iterator to the element, or end() if there is none.
+      template <typename _Fn>
+      iterator
+      modify(const key_type& __k, _Fn&& __fn)
+      {
+        return m_tree.__modify_unique(__k, [&](value_type& __v) { std::forward<_Fn>(__fn)(__v.second); });
+      }
+
+      /// @brief Erase the element at a position.
+      /// @return An iterator to the element following the erased one.
+      iterator
+      erase(const_iterator __position) { return m_tree.erase(__position); }
+
+      size_type
+      erase(const key_type& __k) { return m_tree.erase(__k); }
+
+      void
+      swap(persistent_map& __x) noexcept(noexcept(m_tree.swap(__x.m_tree))) { m_tree.swap(__x.m_tree); }
+
+      void
+      clear() noexcept { m_tree.clear(); }
+
+    public:
+      key_compare
+      key_comp() const { return m_tree.key_comp(); }
+
+      value_compare
+      value_comp() const { return value_compare(m_tree.key_comp()); }
+
+    public:
+      const_iterator
+      find(const key_type& __k) const { return m_tree.find(__k); }
+
+      size_type
+      count(const key_type& __k) const { return m_tree.count(__k); }
+
+      const_iterator
+      lower_bound(const key_type& __k) const { return m_tree.lower_bound(__k); }
+
+      const_iterator
+      upper_bound(const key_type& __k) const { return m_tree.upper_bound(__k); }
+
+      pair<const_iterator, const_iterator>
+      equal_range(const key_type& __k) const { return m_tree.equal_range(__k); }
+
+    public:
+      /// @brief Heterogeneous lookup, available when the comparator is transparent.
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      const_iterator
+      find(const _Kt& __x) const { return m_tree.find(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      size_type
+      count(const _Kt& __x) const { return m_tree.count(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      const_iterator
+      lower_bound(const _Kt& __x) const { return m_tree.lower_bound(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      const_iterator
+      upper_bound(const _Kt& __x) const { return m_tree.upper_bound(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      pair<const_iterator, const_iterator>
+      equal_range(const _Kt& __x) const { return m_tree.equal_range(__x); }
+
+    public:
+      template <typename K1, typename T1, typename C1, typename A1>
+      friend bool operator==(const persistent_map<K1, T1, C1, A1>&, const persistent_map<K1, T1, C1, A1>&);
+
+      template <typename K1, typename T1, typename C1, typename A1>
+      friend bool operator<(const persistent_map<K1, T1, C1, A1>&, const persistent_map<K1, T1, C1, A1>&);
+  };
+
+  template <typename Key, typename T, typename Compare, typename Alloc>
+  inline bool
+  operator==(const persistent_map<Key, T, Compare, Alloc>& __x, const persistent_map<Key, T, Compare, Alloc>& __y)
+  {
+    return __x.m_tree == __y.m_tree;
+  }
+
+  template <typename Key, typename T, typename Compare, typename Alloc>
+  inline bool
+  operator<(const persistent_map<Key, T, Compare, Alloc>& __x, const persistent_map<Key, T, Compare, Alloc>& __y)
+  {
+    return __x.m_tree < __y.m_tree;
+  }
+
+  template <typename Key, typename T, typename Compare, typename Alloc>
+  inline bool
+  operator!=(const persistent_map<Key, T, Compare, Alloc>& __x, const persistent_map<Key, T, Compare, Alloc>& __y)
+  {
+    return !(__x == __y);
+  }
+
+  template <typename Key, typename T, typename Compare, typename Alloc>
+  inline bool
+  operator>(const persistent_map<Key, T, Compare, Alloc>& __x, const persistent_map<Key, T, Compare, Alloc>& __y)
+  {
+    return __y < __x;
+  }
+
+  template <typename Key, typename T, typename Compare, typename Alloc>
+  inline bool
+  operator<=(const persistent_map<Key, T, Compare, Alloc>& __x, const persistent_map<Key, T, Compare, Alloc>& __y)
+  {
+    return !(__y < __x);
+  }
+
+  template <typename Key, typename T, typename Compare, typename Alloc>
+  inline bool
+  operator>=(const persistent_map<Key, T, Compare, Alloc>& __x, const persistent_map<Key, T, Compare, Alloc>& __y)
+  {
+    return !(__x < __y);
+  }
+
+  /// @brief Swap the contents of two persistent maps.
+  template <typename Key, typename T, typename Compare, typename Alloc>
+  inline void
+  swap(persistent_map<Key, T, Compare, Alloc>& __x, persistent_map<Key, T, Compare, Alloc>& __y)
+    noexcept(noexcept(__x.swap(__y)))
+  {
+    __x.swap(__y);
+  }
+
+} // namespace ft
+
+#endif // __FT_PERSISTENT_MAP__
@@ -0,0 +1,249 @@
+#ifndef   __FT_STATIC_MAP__
+# define  __FT_STATIC_MAP__
+
+# include <cstddef>     // For std::size_t, std::ptrdiff_t
+# include <functional>  // For std::less
+# include <stdexcept>   // For std::out_of_range, std::invalid_argument
+# include <utility>     // For std::move, std::index_sequence, std::make_index_sequence
+
+# include "../iterator/reverse_iterator.h" // For ft::reverse_iterator
+# include "../tree/rb_tree_key_compare.h"  // For has_is_transparent_t
+# include "../utility/pair.h"              // For ft::pair
+
+namespace ft {
+
+  /// @brief Immutable ordered map of N entries, built and checked at compile time.
+  /// @details The entries are given in any order; the constructor sorts them and rejects
+  /// duplicate keys by throwing `std::invalid_argument`, which in a constant expression is
+  /// a compile error. Declared `constexpr`, a table therefore costs nothing at startup and
+  /// lives in read-only data, with no heap use:
+  /// ```cpp
+  /// constexpr auto codes = ft::make_static_map<std::string_view, int>({
+  ///   { "not_found", 404 }, { "ok", 200 }, { "teapot", 418 } });
+  /// static_assert(codes.at("ok") == 200);
+  /// ```
+  /// Lookups are a binary search whose every step selects the next half with a
+  /// conditional move rather than a branch, so they do not mispredict; the number of steps
+  /// depends only on N, so the compiler can unroll it completely. Every member is
+  /// `constexpr`, so lookups can also run at compile time. Iterators are pointers to the
+  /// sorted entries.
+  ///
+  /// @tparam Key The key type; it and `T` must be literal types to build the table at
+  /// compile time.
+  /// @tparam T The mapped type.
+  /// @tparam N The number of entries, at least one.
+  /// @tparam Compare The key comparison function type.
+  template <
+    typename Key,
+    typename T,
+    std::size_t N,
+    typename Compare = std::less<Key>
+  > class static_map
+  {
+    static_assert(N > 0, "ft::static_map: a table needs at least one entry");
+
+    public:
+      using key_type               = Key;                                    ///< The type of the keys.
+      using mapped_type            = T;                                      ///< The type of the mapped values.
+      using value_type             = ft::pair<Key, T>;                       ///< The type of the entries.
+      using key_compare            = Compare;                                ///< The key comparison function type.
+      using size_type              = std::size_t;                            ///< Unsigned integer type for sizes.
+      using difference_type        = std::ptrdiff_t;                         ///< Signed integer type for distances.
+      using reference              = const value_type&;                      ///< Reference type to the entries.
+      using const_reference        = const value_type&;                      ///< Reference type to the entries.
+      using pointer                = const value_type*;                      ///< Pointer type to the entries.
+      using const_pointer          = const value_type*;                      ///< Pointer type to the entries.
+      using iterator               = const value_type*;                      ///< Random access iterator over the sorted entries.
+      using const_iterator         = const value_type*;                      ///< Random access iterator over the sorted entries.
+      using reverse_iterator       = ft::reverse_iterator<const_iterator>;   ///< Reverse iterator.
+      using const_reverse_iterator = ft::reverse_iterator<const_iterator>;   ///< Reverse iterator.
+
+    public:
+      /// @brief Build the table from its entries, in any order.
+      /// @param __init The entries.
+      /// @param __comp The key comparison function.
+      /// @throws std::invalid_argument if two keys are equivalent; a compile error in a
+      /// constant expression.
+      constexpr explicit
+      static_map(const value_type (&__init)[N], const Compare& __comp = Compare())
+        : static_map(__init, __comp, std::make_index_sequence<N>()) { }
+
+    public:
+      constexpr const_iterator         begin()   const noexcept { return m_data; }
+      constexpr const_iterator         end()     const noexcept { return m_data + N; }
+      constexpr const_reverse_iterator rbegin()  const noexcept { return const_reverse_iterator(end()); }
+      constexpr const_reverse_iterator rend()    const noexcept { return const_reverse_iterator(begin()); }
+
+    public:
+      constexpr bool      empty()    const noexcept { return false; }
+      constexpr size_type size()     const noexcept { return N; }
+      constexpr size_type max_size() const noexcept { return N; }
+
+      constexpr key_compare
+      key_comp() const { return m_comp; }
+
+    public:
+      /// @brief Access the value mapped to a key.
+      /// @throws std::out_of_range if the key is not present; a compile error in a constant
+      /// expression.
+      constexpr const mapped_type&
+      at(const key_type& __k) const
+      {
+        const_iterator __i = find(__k);
+
+        if ( __i == end() ) throw std::out_of_range("ft::static_map::at");
+        return __i->second;
+      }
+
+      constexpr const_iterator
+      find(const key_type& __k) const { return __find(__k); }
+
+      constexpr size_type
+      count(const key_type& __k) const { return __find(__k) != end(); }
+
+      constexpr const_iterator
+      lower_bound(const key_type& __k) const { return __lower_bound(__k); }
+
+      constexpr const_iterator
+      upper_bound(const key_type& __k) const { return __upper_bound(__k); }
+
+      constexpr pair<const_iterator, const_iterator>
+      equal_range(const key_type& __k) const
+      {
+        const_iterator __i = __lower_bound(__k);
+        const_iterator __j = ( __i != end() && !m_comp(__k, __i->first) ) ? __i + 1 : __i;
+
+        return pair<const_iterator, const_iterator>(__i, __j);
+      }
+
+    public:
+      /// @brief Heterogeneous lookup, available when the comparator is transparent.
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      constexpr const mapped_type&
+      at(const _Kt& __x) const
+      {
+        const_iterator __i = __find(__x);
+
+        if ( __i == end() ) throw std::out_of_range("ft::static_map::at");
+        return __i->second;
+      }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      constexpr const_iterator
+      find(const _Kt& __x) const { return __find(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      constexpr size_type
+      count(const _Kt& __x) const { return __find(__x) != end(); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      constexpr const_iterator
+      lower_bound(const _Kt& __x) const { return __lower_bound(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      constexpr const_iterator
+      upper_bound(const _Kt& __x) const { return __upper_bound(__x); }
+
+    private:
+      template <std::size_t... _Is>
+      constexpr
+      static_map(const value_type (&__init)[N], const Compare& __comp, std::index_sequence<_Is...>)
+        : m_data{ __init[_Is]... }, m_comp(__comp)
+      {
+        __sort();
+        for ( size_type __i = 1; __i < N; ++__i )
+          if ( !m_comp(m_data[__i - 1].first, m_data[__i].first) )
+            throw std::invalid_argument("ft::static_map: duplicate key");
+      }
+
+      /// @brief Heapsort the entries by key: O(N log N) steps and no recursion, which keeps
+      /// large tables within the compiler's constant evaluation limits.
+      constexpr void
+      __sort()
+      {
+        for ( size_type __i = N / 2; __i > 0; --__i )
+          __sift_down(__i - 1, N);
+        for ( size_type __end = N - 1; __end > 0; --__end ) {
+          __swap(m_data[0], m_data[__end]);
+          __sift_down(0, __end);
+        }
+      }
+
+      constexpr void
+      __sift_down(size_type __i, size_type __n)
+      {
+        for ( size_type __c = 2 * __i + 1; __c < __n; __i = __c, __c = 2 * __i + 1 ) {
+          if ( __c + 1 < __n && m_comp(m_data[__c].first, m_data[__c + 1].first) ) ++__c;
+          if ( !m_comp(m_data[__i].first, m_data[__c].first) ) return;
+          __swap(m_data[__i], m_data[__c]);
+        }
+      }
+
+      static constexpr void
+      __swap(value_type& __a, value_type& __b)
+      {
+        value_type __t = std::move(__a);
+        __a = std::move(__b);
+        __b = std::move(__t);
+      }
+
+      /// @brief Branchless lower bound: each step keeps the upper half when its first probe
+      /// is less than __k, with a select the compiler turns into a conditional move.
+      template <typename _Kt>
+      constexpr const_iterator
+      __lower_bound(const _Kt& __k) const
+      {
+        const value_type* __base = m_data;
+
+        for ( size_type __n = N; __n > 1; ) {
+          const size_type __half = __n / 2;
+          __base = m_comp(__base[__half - 1].first, __k) ? __base + __half : __base;
+          __n -= __half;
+        }
+        return __base + m_comp(__base->first, __k);
+      }
+
+      template <typename _Kt>
+      constexpr const_iterator
+      __upper_bound(const _Kt& __k) const
+      {
+        const value_type* __base = m_data;
+
+        for ( size_type __n = N; __n > 1; ) {
+          const size_type __half = __n / 2;
+          __base = !m_comp(__k, __base[__half - 1].first) ? __base + __half : __base;
+          __n -= __half;
+        }
+        return __base + !m_comp(__k, __base->first);
+      }
+
+      template <typename _Kt>
+      constexpr const_iterator
+      __find(const _Kt& __k) const
+      {
+        const_iterator __i = __lower_bound(__k);
+
+        return ( __i != end() && !m_comp(__k, __i->first) ) ? __i : end();
+      }
+
+    private:
+      value_type m_data[N]; ///< The entries, sorted by key.
+      Compare    m_comp;    ///< The key comparison function.
+  };
+
+  /// @brief Build a `static_map`, deducing the number of entries.
+  /// @param __init The entries, in any order.
+  /// @param __comp The key comparison function.
+  /// ```cpp
+  /// constexpr auto opcodes = ft::make_static_map<int, handler_fn>({ { 0x01, &nop }, { 0x02, &load } });
+  /// ```
+  template <typename Key, typename T, typename Compare = std::less<Key>, std::size_t N>
+  constexpr static_map<Key, T, N, Compare>
+  make_static_map(const ft::pair<Key, T> (&__init)[N], const Compare& __comp = Compare())
+  {
+    return static_map<Key, T, N, Compare>(__init, __comp);
+  }
+
+} // namespace ft
+
+#endif // __FT_STATIC_MAP__
@@ -0,0 +1,377 @@
+#ifndef   __FT_UNORDERED_MAP__
+# define  __FT_UNORDERED_MAP__
+
+# include <cstddef>     // For std::size_t
+# include <functional>  // For std::hash, std::equal_to
+# include <memory>      // For std::allocator
+# include <stdexcept>   // For std::out_of_range
+# include <tuple>       // For std::forward_as_tuple
+# include <type_traits> // For std::enable_if_t, std::is_constructible, std::is_assignable
+# include <utility>     // For std::move, std::forward
+
+# include "../hash/hash_table.h"        // For hash_table, has_transparent_hash_t
+# include "../utility/pair.h"           // For ft::pair
+# include "../utility/functional.h"     // For ft::select1st
+# include "../memory/memory_resource.h" // For polymorphic_allocator
+
+namespace ft {
+
+  /// @brief Unordered associative container of unique keys mapped to values, in a Swiss table.
+  /// @details The elements are `ft::pair<const Key, T>` in no particular order. Lookups,
+  /// insertions and erasures take O(1) on average and usually touch two cache lines: the
+  /// control bytes of one group and the element. See `hash_table` for the layout.
+  ///
+  /// The elements live in one flat array, so any insertion may move all of them and
+  /// invalidate every iterator, pointer and reference. Erasure only invalidates those to
+  /// the erased element. Callers that need stable addresses use `node_unordered_map`.
+  ///
+  /// @tparam NodeStable Whether every element is allocated on its own and never moves.
+  template <
+    typename Key,
+    typename T,
+    typename Hash     = std::hash<Key>,
+    typename KeyEqual = std::equal_to<Key>,
+    typename Alloc    = std::allocator<ft::pair<const Key, T>>,
+    bool NodeStable   = false
+  > class unordered_map
+  {
+    public:
+      using key_type       = Key;                    ///< The type of the keys.
+      using mapped_type    = T;                      ///< The type of the mapped values.
+      using value_type     = ft::pair<const Key, T>; ///< The type of the stored elements.
+      using hasher         = Hash;                   ///< The hash function type.
+      using key_equal      = KeyEqual;               ///< The key equality type.
+      using allocator_type = Alloc;                  ///< The allocator type.
+
+    private:
+      using rep_type = hash_table<key_type, value_type, select1st<value_type>, hasher, key_equal, allocator_type, NodeStable>;
+
+      rep_type m_table; ///< The hash table holding the elements.
+
+    public:
+      using pointer         = typename rep_type::pointer;         ///< Pointer type to the element.
+      using const_pointer   = typename rep_type::const_pointer;   ///< Const pointer type to the element.
+      using reference       = typename rep_type::reference;       ///< Reference type to the element.
+      using const_reference = typename rep_type::const_reference; ///< Const reference type to the element.
+      using iterator        = typename rep_type::iterator;        ///< Forward iterator.
+      using const_iterator  = typename rep_type::const_iterator;  ///< Constant forward iterator.
+      using size_type       = typename rep_type::size_type;       ///< Unsigned integer type for sizes.
+      using difference_type = typename rep_type::difference_type; ///< Signed integer type for distances.
+
+    public:
+      /// @brief Default constructor. Allocates nothing.
+      unordered_map() = default;
+
+      /// @brief Constructor with an initial bucket count, the function objects and an allocator.
+      /// @param __n The number of slots to allocate at once.
+      explicit
+      unordered_map(size_type __n, const Hash& __h = Hash(), const KeyEqual& __e = KeyEqual(),
+                    const allocator_type& __a = allocator_type())
+        : m_table{ __n, __h, __e, __a } { }
+
+      /// @brief Constructor with an allocator, such as a `polymorphic_allocator` on a resource.
+      /// @param __a The allocator.
+      explicit
+      unordered_map(const allocator_type& __a)
+        : m_table{ 0, Hash(), KeyEqual(), __a } { }
+
+      /// @brief Range constructor.
+      /// @param __first The beginning of the range to insert.
+      /// @param __last The end of the range to insert.
+      template <typename _InputIterator>
+      unordered_map(_InputIterator __first, _InputIterator __last, size_type __n = 0,
+                    const Hash& __h = Hash(), const KeyEqual& __e = KeyEqual(),
+                    const allocator_type& __a = allocator_type())
+        : m_table{ __n, __h, __e, __a }
+      {
+        m_table.__insert_range_unique(__first, __last);
+      }
+
+      unordered_map(const unordered_map&) = default;
+      unordered_map(unordered_map&&) = default;
+      ~unordered_map() = default;
+
+      unordered_map& operator=(const unordered_map&) = default;
+      unordered_map& operator=(unordered_map&&) = default;
+
+      allocator_type
+      get_allocator() const noexcept { return m_table.get_allocator(); }
+
+    public:
+      iterator       begin()       noexcept { return m_table.begin(); }
+      const_iterator begin() const noexcept { return m_table.begin(); }
+      iterator       end()         noexcept { return m_table.end(); }
+      const_iterator end()   const noexcept { return m_table.end(); }
+
+    public:
+      bool      empty()    const noexcept { return m_table.empty(); }
+      size_type size()     const noexcept { return m_table.size(); }
+      size_type max_size() const noexcept { return m_table.max_size(); }
+
+    public:
+      /// @brief Access the value mapped to a key, inserting a default one if needed.
+      /// @param __k The key to look up.
+      /// @return A reference to the mapped value.
+      mapped_type&
+      operator[](const key_type& __k) { return try_emplace(__k).first->second; }
+
+      mapped_type&
+      operator[](key_type&& __k) { return try_emplace(std::move(__k)).first->second; }
+
+      /// @brief Access the value mapped to a key, with bounds checking.
+      /// @throws std::out_of_range if the key is not present.
+      mapped_type&
+      at(const key_type& __k)
+      {
+        iterator __i = find(__k);
+
+        if ( __i == end() ) throw std::out_of_range("ft::unordered_map::at");
+        return __i->second;
+      }
+
+      const mapped_type&
+      at(const key_type& __k) const
+      {
+        const_iterator __i = find(__k);
+
+        if ( __i == end() ) throw std::out_of_range("ft::unordered_map::at");
+        return __i->second;
+      }
+
+    public:
+      /// @brief Insert an element if its key is not present yet.
+      /// @return An iterator to the element with that key, and whether insertion took place.
+      pair<iterator, bool>
+      insert(const value_type& __x) { return m_table.__insert_unique(__x); }
+
+      pair<iterator, bool>
+      insert(value_type&& __x) { return m_table.__insert_unique(std::move(__x)); }
+
+      /// @brief Insert an element constructed from __x if its key is not present yet.
+      /// @details __x is forwarded to the constructor, so e.g. an rvalue `ft::pair<Key, T>` is moved.
+      template <typename _Pair, typename = std::enable_if_t<std::is_constructible<value_type, _Pair&&>::value>>
+      pair<iterator, bool>
+      insert(_Pair&& __x) { return m_table.__emplace_unique(std::forward<_Pair>(__x)); }
+
+      /// @brief Insert an element; the hint is accepted for interface compatibility and unused.
+      /// @return An iterator to the element with the key of __x.
+      iterator
+      insert(const_iterator, const value_type& __x) { return insert(__x).first; }
+
+      iterator
+      insert(const_iterator, value_type&& __x) { return insert(std::move(__x)).first; }
+
+      /// @brief Insert every element of a range whose key is not present yet.
+      template <typename _InputIterator>
+      void
+      insert(_InputIterator __first, _InputIterator __last) { m_table.__insert_range_unique(__first, __last); }
+
+      /// @brief Construct an element in place if its key is not present yet.
+      /// @param __args The arguments forwarded to the constructor of `value_type`.
+      /// @return An iterator to the element with that key, and whether insertion took place.
+      template <typename... _Args>
+      pair<iterator, bool>
+      emplace(_Args&&... __args) { return m_table.__emplace_unique(std::forward<_Args>(__args)...); }
+
+      /// @brief Like `emplace`; the hint is unused.
+      template <typename... _Args>
+      iterator
+      emplace_hint(const_iterator, _Args&&... __args) { return emplace(std::forward<_Args>(__args)...).first; }
+
+      /// @brief Construct a mapped value in place if the key is not present yet.
+      /// @param __k The key.
+      /// @param __args The arguments forwarded to the constructor of `mapped_type`.
+      /// @return An iterator to the element with that key, and whether insertion took place.
+      /// @details Unlike `emplace`, nothing is constructed or moved from when the key exists.
+      template <typename... _Args>
+      pair<iterator, bool>
+      try_emplace(const key_type& __k, _Args&&... __args)
+      {
+        return m_table.__try_emplace_unique(__k, piecewise_construct, std::forward_as_tuple(__k),
+                                            std::forward_as_tuple(std::forward<_Args>(__args)...));
+      }
+
+      template <typename... _Args>
+      pair<iterator, bool>
+      try_emplace(key_type&& __k, _Args&&... __args)
+      {
+        return m_table.__try_emplace_unique(__k, piecewise_construct, std::forward_as_tuple(std::move(__k)),
+                                            std::forward_as_tuple(std::forward<_Args>(__args)...));
+      }
+
+      /// @brief Like `try_emplace`; the hint is unused.
+      template <typename... _Args>
+      iterator
+      try_emplace(const_iterator, const key_type& __k, _Args&&... __args)
+      {
+        return try_emplace(__k, std::forward<_Args>(__args)...).first;
+      }
+
+      template <typename... _Args>
+      iterator
+      try_emplace(const_iterator, key_type&& __k, _Args&&... __args)
+      {
+        return try_emplace(std::move(__k), std::forward<_Args>(__args)...).first;
+      }
+
+      /// @brief Assign __obj to the value mapped to __k, inserting the key if needed.
+      /// @return An iterator to the element with that key, and whether insertion took place.
+      template <typename _Obj, typename = std::enable_if_t<std::is_assignable<mapped_type&, _Obj&&>::value>>
+      pair<iterator, bool>
+      insert_or_assign(const key_type& __k, _Obj&& __obj)
+      {
+        pair<iterator, bool> __r = try_emplace(__k, std::forward<_Obj>(__obj));
+
+        if ( !__r.second ) __r.first->second = std::forward<_Obj>(__obj);
+        return __r;
+      }
+
+      template <typename _Obj, typename = std::enable_if_t<std::is_assignable<mapped_type&, _Obj&&>::value>>
+      pair<iterator, bool>
+      insert_or_assign(key_type&& __k, _Obj&& __obj)
+      {
+        pair<iterator, bool> __r = try_emplace(std::move(__k), std::forward<_Obj>(__obj));
+
+        if ( !__r.second ) __r.first->second = std::forward<_Obj>(__obj);
+        return __r;
+      }
+
+      iterator
+      erase(const_iterator __position) { return m_table.erase(__position); }
+
+      iterator
+      erase(iterator __position) { return m_table.erase(__position); }
+
+      size_type
+      erase(const key_type& __k) { return m_table.erase(__k); }
+
+      iterator
+      erase(const_iterator __first, const_iterator __last) { return m_table.erase(__first, __last); }
+
+      void
+      swap(unordered_map& __x) noexcept(noexcept(m_table.swap(__x.m_table))) { m_table.swap(__x.m_table); }
+
+      void
+      clear() noexcept { m_table.clear(); }
+
+    public:
+      hasher
+      hash_function() const { return m_table.hash_function(); }
+
+      key_equal
+      key_eq() const { return m_table.key_eq(); }
+
+    public:
+      iterator       find(const key_type& __k)       { return m_table.find(__k); }
+      const_iterator find(const key_type& __k) const { return m_table.find(__k); }
+
+      size_type
+      count(const key_type& __k) const { return m_table.count(__k); }
+
+      pair<iterator, iterator>
+      equal_range(const key_type& __k) { return m_table.equal_range(__k); }
+
+      pair<const_iterator, const_iterator>
+      equal_range(const key_type& __k) const { return m_table.equal_range(__k); }
+
+    public:
+      /// @brief Heterogeneous lookup, available when the hash and the key equality are transparent.
+      /// @details These overloads hash and compare __x directly, so looking up a
+      /// `std::string` key by `const char*` or `std::string_view` allocates nothing.
+      template <typename _Kt, typename = has_transparent_hash_t<Hash, KeyEqual, _Kt>>
+      iterator
+      find(const _Kt& __x) { return m_table.find(__x); }
+
+      template <typename _Kt, typename = has_transparent_hash_t<Hash, KeyEqual, _Kt>>
+      const_iterator
+      find(const _Kt& __x) const { return m_table.find(__x); }
+
+      template <typename _Kt, typename = has_transparent_hash_t<Hash, KeyEqual, _Kt>>
+      size_type
+      count(const _Kt& __x) const { return m_table.count(__x); }
+
+      template <typename _Kt, typename = has_transparent_hash_t<Hash, KeyEqual, _Kt>>
+      pair<iterator, iterator>
+      equal_range(const _Kt& __x) { return m_table.equal_range(__x); }
+
+      template <typename _Kt, typename = has_transparent_hash_t<Hash, KeyEqual, _Kt>>
+      pair<const_iterator, const_iterator>
+      equal_range(const _Kt& __x) const { return m_table.equal_range(__x); }
+
+    public:
+      /// @brief Get the number of slots.
+      size_type
+      bucket_count() const noexcept { return m_table.bucket_count(); }
+
+      float
+      load_factor() const noexcept { return m_table.load_factor(); }
+
+      /// @brief Get the load factor at which the table grows, fixed at 7/8.
+      float
+      max_load_factor() const noexcept { return m_table.max_load_factor(); }
+
+      /// @brief Make room for __n elements, so that inserting them does not rehash.
+      void
+      reserve(size_type __n) { m_table.reserve(__n); }
+
+      /// @brief Rebuild the table with at least __n slots; `rehash(0)` shrinks it to fit.
+      void
+      rehash(size_type __n) { m_table.rehash(__n); }
+
+    public:
+      template <typename K1, typename T1, typename H1, typename E1, typename A1, bool N1>
+      friend bool operator==(const unordered_map<K1, T1, H1, E1, A1, N1>&, const unordered_map<K1, T1, H1, E1, A1, N1>&);
+  };
+
+  template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc, bool N>
+  inline bool
+  operator==(const unordered_map<Key, T, Hash, KeyEqual, Alloc, N>& __x,
+             const unordered_map<Key, T, Hash, KeyEqual, Alloc, N>& __y)
+  {
+    return __x.m_table == __y.m_table;
+  }
+
+  template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc, bool N>
+  inline bool
+  operator!=(const unordered_map<Key, T, Hash, KeyEqual, Alloc, N>& __x,
+             const unordered_map<Key, T, Hash, KeyEqual, Alloc, N>& __y)
+  {
+    return !(__x == __y);
+  }
+
+  /// @brief Swap the contents of two unordered maps.
+  template <typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc, bool N>
+  inline void
+  swap(unordered_map<Key, T, Hash, KeyEqual, Alloc, N>& __x, unordered_map<Key, T, Hash, KeyEqual, Alloc, N>& __y)
+    noexcept(noexcept(__x.swap(__y)))
+  {
+    __x.swap(__y);
+  }
+
+  /// @brief `unordered_map` whose elements are allocated one by one and never move.
+  /// @details Pointers and references to an element stay valid until it is erased, as with
+  /// `std::unordered_map`. A rehash moves only the pointers in the slots, at the price of
+  /// one allocation per element and one more indirection per lookup.
+  template <
+    typename Key,
+    typename T,
+    typename Hash     = std::hash<Key>,
+    typename KeyEqual = std::equal_to<Key>,
+    typename Alloc    = std::allocator<ft::pair<const Key, T>>
+  > using node_unordered_map = unordered_map<Key, T, Hash, KeyEqual, Alloc, true>;
+
+  namespace pmr {
+
+    /// @brief `unordered_map` drawing its slots from a `memory_resource`.
+    template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+    using unordered_map = ft::unordered_map<Key, T, Hash, KeyEqual, polymorphic_allocator<ft::pair<const Key, T>>>;
+
+    /// @brief `node_unordered_map` drawing its slots and elements from a `memory_resource`.
+    template <typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+    using node_unordered_map = ft::node_unordered_map<Key, T, Hash, KeyEqual, polymorphic_allocator<ft::pair<const Key, T>>>;
+
+  } // namespace pmr
+
+} // namespace ft
+
+#endif // __FT_UNORDERED_MAP__
@@ -0,0 +1,49 @@
+#ifndef   __FT_BULK_RELEASE_TRAITS__
+# define  __FT_BULK_RELEASE_TRAITS__
+
+# include <type_traits> // For std::false_type, std::true_type, std::void_t
+# include <utility>     // For std::declval
+
+namespace ft {
+
+  /// @brief Traits describing whether an allocator can drop all its memory at once.
+  /// @details Containers normally return every node to the allocator one by one when they
+  /// are cleared or destroyed. Allocators that carve nodes out of larger blocks can expose
+  /// `__can_release()` and `__release()` so the container skips the per-node deallocation
+  /// and lets the allocator free whole blocks instead.
+  ///
+  /// `__can_release()` must only return true when every block of the allocator belongs to
+  /// the calling container, since `__release()` invalidates all of them. An allocator whose
+  /// deallocation does nothing, such as a `polymorphic_allocator` on a monotonic arena, can
+  /// always return true and release nothing: its memory is reclaimed with the arena.
+  template <typename _Alloc, typename = void>
+  struct bulk_release_traits
+  {
+    static constexpr bool value = false; ///< Whether the allocator supports bulk release at all.
+
+    static bool
+    can_release(const _Alloc&) noexcept { return false; }
+
+    static void
+    release(_Alloc&) noexcept { }
+  };
+
+  /// @brief Specialization for allocators providing `__can_release()` and `__release()`.
+  template <typename _Alloc>
+  struct bulk_release_traits<_Alloc, std::void_t<
+    decltype(std::declval<const _Alloc&>().__can_release()),
+    decltype(std::declval<_Alloc&>().__release())
+  >>
+  {
+    static constexpr bool value = true; ///< Whether the allocator supports bulk release at all.
+
+    static bool
+    can_release(const _Alloc& __a) noexcept { return __a.__can_release(); }
+
+    static void
+    release(_Alloc& __a) noexcept { __a.__release(); }
+  };
+
+} // namespace ft
+
+#endif // __FT_BULK_RELEASE_TRAITS__
@@ -0,0 +1,121 @@
+#ifndef   __FT_EPOCH_DOMAIN__
+# define  __FT_EPOCH_DOMAIN__
+
+# include <atomic>  // For std::atomic
+# include <cstddef> // For std::size_t
+# include <thread>  // For std::this_thread::yield
+
+namespace ft {
+
+  /// @brief Epoch-based grace periods for data read without locks.
+  /// @details Readers bracket each access with a `guard` returned by `pin()`; a writer
+  /// that has unlinked some memory calls `synchronize()`, which returns once every reader
+  /// that might still see that memory has left, after which it can be freed.
+  ///
+  /// Pinning increments a counter picked by the reading thread and tagged with the parity
+  /// of the current epoch; unpinning decrements it. Both are single atomic operations, so
+  /// readers are wait-free and never touch what the writer waits on, and spreading them
+  /// over `stripes` cache lines keeps many readers from contending on one. `synchronize()`
+  /// flips the epoch and waits for the readers of the old parity to drain, twice, so that
+  /// readers who read the epoch just before a flip are waited for too.
+  ///
+  /// A long read section delays the writer's reclamation, never the other readers.
+  class epoch_domain
+  {
+    public:
+      static constexpr std::size_t stripes = 64; ///< The number of reader counters per parity.
+
+      /// @brief A pinned read section; leaving it unpins the reader.
+      class guard
+      {
+        friend class epoch_domain;
+
+        public:
+          guard(guard&& __x) noexcept
+            : m_counter{ __x.m_counter } { __x.m_counter = nullptr; }
+
+          guard(const guard&) = delete;
+          guard& operator=(const guard&) = delete;
+          guard& operator=(guard&&) = delete;
+
+          ~guard()
+          {
+            if ( m_counter != nullptr ) m_counter->fetch_sub(1, std::memory_order_release);
+          }
+
+        private:
+          explicit
+          guard(std::atomic<long>* __c) noexcept
+            : m_counter{ __c } { }
+
+          std::atomic<long>* m_counter; ///< The counter incremented by `pin()`.
+      };
+
+    public:
+      epoch_domain() = default;
+
+      epoch_domain(const epoch_domain&) = delete;
+      epoch_domain& operator=(const epoch_domain&) = delete;
+
+      /// @brief Enter a read section.
+      /// @details Loads made while the guard lives observe memory that `synchronize()`
+      /// will not return before the guard is destroyed.
+      guard
+      pin() const noexcept
+      {
+        const unsigned     __parity = m_epoch.load(std::memory_order_relaxed) & 1;
+        std::atomic<long>& __c      = m_readers[__parity][__stripe()].m_count;
+
+        __c.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return guard(&__c);
+      }
+
+      /// @brief Wait until every read section entered before the call has ended.
+      /// @details Must not be called from inside a read section of the same domain.
+      void
+      synchronize() noexcept
+      {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        for ( int __flip = 0; __flip < 2; ++__flip ) {
+          const unsigned __old = m_epoch.fetch_add(1, std::memory_order_seq_cst) & 1;
+
+          while ( __readers(__old) != 0 ) std::this_thread::yield();
+        }
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+      }
+
+    private:
+      struct alignas(64) __counter
+      {
+        std::atomic<long> m_count{ 0 };
+      };
+
+      /// @brief The number of readers pinned under the given parity.
+      long
+      __readers(unsigned __parity) const noexcept
+      {
+        long __n = 0;
+
+        for ( std::size_t __i = 0; __i < stripes; ++__i )
+          __n += m_readers[__parity][__i].m_count.load(std::memory_order_seq_cst);
+        return __n;
+      }
+
+      /// @brief The counter stripe of the calling thread, assigned round-robin on first use.
+      static std::size_t
+      __stripe() noexcept
+      {
+        static std::atomic<std::size_t> __next{ 0 };
+        thread_local const std::size_t  __mine = __next.fetch_add(1, std::memory_order_relaxed) % stripes;
+
+        return __mine;
+      }
+
+      std::atomic<unsigned> m_epoch{ 0 };           ///< The current epoch; only its parity matters.
+      mutable __counter     m_readers[2][stripes];  ///< The reader counters, per parity and stripe.
+  };
+
+} // namespace ft
+
+#endif // __FT_EPOCH_DOMAIN__
@@ -0,0 +1,224 @@
+#ifndef   __FT_MEMORY_RESOURCE__
+# define  __FT_MEMORY_RESOURCE__
+
+# include <atomic>      // For std::atomic
+# include <cstddef>     // For std::size_t, std::ptrdiff_t, std::max_align_t
+# include <limits>      // For std::numeric_limits
+# include <new>         // For ::operator new, ::operator delete, std::align_val_t, std::bad_alloc, std::bad_array_new_length
+
+namespace ft {
+
+  /// @brief Abstract source of memory, modelled on `std::pmr::memory_resource`.
+  /// @details Containers reach a resource through `polymorphic_allocator`, so containers
+  /// of the same type can draw from different resources: an arena per request batch, a
+  /// pool per thread, the global heap.
+  ///
+  /// A resource may also report that its deallocation is a no-op, as a monotonic arena
+  /// does. Containers then skip returning their nodes one by one when they are destroyed
+  /// or cleared, see `bulk_release_traits`.
+  class memory_resource
+  {
+    public:
+      static constexpr std::size_t max_align = alignof(std::max_align_t); ///< The default alignment.
+
+    public:
+      virtual ~memory_resource() = default;
+
+      /// @brief Get __bytes of memory aligned to __alignment, a power of two.
+      /// @throws Whatever the resource throws when it runs out of memory, usually std::bad_alloc.
+      void*
+      allocate(std::size_t __bytes, std::size_t __alignment = max_align)
+      {
+        return do_allocate(__bytes, __alignment);
+      }
+
+      /// @brief Return memory obtained from `allocate` with the same size and alignment.
+      void
+      deallocate(void* __p, std::size_t __bytes, std::size_t __alignment = max_align)
+      {
+        do_deallocate(__p, __bytes, __alignment);
+      }
+
+      /// @brief Whether memory allocated from this resource can be deallocated by __other.
+      bool
+      is_equal(const memory_resource& __other) const noexcept { return do_is_equal(__other); }
+
+      /// @brief Whether `deallocate` does nothing, so it need not be called at all.
+      bool
+      __skips_deallocate() const noexcept { return do_skips_deallocate(); }
+
+    private:
+      virtual void* do_allocate(std::size_t __bytes, std::size_t __alignment) = 0;
+      virtual void  do_deallocate(void* __p, std::size_t __bytes, std::size_t __alignment) = 0;
+      virtual bool  do_is_equal(const memory_resource& __other) const noexcept = 0;
+
+      virtual bool
+      do_skips_deallocate() const noexcept { return false; }
+  };
+
+  inline bool
+  operator==(const memory_resource& __x, const memory_resource& __y) noexcept
+  {
+    return &__x == &__y || __x.is_equal(__y);
+  }
+
+  inline bool
+  operator!=(const memory_resource& __x, const memory_resource& __y) noexcept
+  {
+    return !(__x == __y);
+  }
+
+  /// @brief The resource using the global `operator new` and `operator delete`.
+  inline memory_resource*
+  new_delete_resource() noexcept
+  {
+    struct __new_delete_resource final : memory_resource
+    {
+      void*
+      do_allocate(std::size_t __bytes, std::size_t __alignment) override
+      {
+        if ( __alignment > max_align ) return ::operator new(__bytes, std::align_val_t(__alignment));
+        return ::operator new(__bytes);
+      }
+
+      void
+      do_deallocate(void* __p, std::size_t, std::size_t __alignment) override
+      {
+        if ( __alignment > max_align ) ::operator delete(__p, std::align_val_t(__alignment));
+        else ::operator delete(__p);
+      }
+
+      bool
+      do_is_equal(const memory_resource& __other) const noexcept override { return this == &__other; }
+    };
+
+    static __new_delete_resource __r;
+    return &__r;
+  }
+
+  /// @brief The resource that fails every allocation, to check that a buffer is never exceeded.
+  inline memory_resource*
+  null_memory_resource() noexcept
+  {
+    struct __null_resource final : memory_resource
+    {
+      void*
+      do_allocate(std::size_t, std::size_t) override { throw std::bad_alloc(); }
+
+      void
+      do_deallocate(void*, std::size_t, std::size_t) override { }
+
+      bool
+      do_is_equal(const memory_resource& __other) const noexcept override { return this == &__other; }
+    };
+
+    static __null_resource __r;
+    return &__r;
+  }
+
+  /// @brief The process-wide default resource, initially `new_delete_resource()`.
+  inline std::atomic<memory_resource*>&
+  __default_resource() noexcept
+  {
+    static std::atomic<memory_resource*> __r{ new_delete_resource() };
+    return __r;
+  }
+
+  /// @brief Get the resource used by default-constructed `polymorphic_allocator`s.
+  inline memory_resource*
+  get_default_resource() noexcept { return __default_resource().load(std::memory_order_acquire); }
+
+  /// @brief Replace the default resource; nullptr restores `new_delete_resource()`.
+  /// @return The previous default resource.
+  inline memory_resource*
+  set_default_resource(memory_resource* __r) noexcept
+  {
+    return __default_resource().exchange(__r != nullptr ? __r : new_delete_resource(), std::memory_order_acq_rel);
+  }
+
+  /// @brief Allocator drawing from a `memory_resource`, modelled on `std::pmr::polymorphic_allocator`.
+  /// @details The resource is chosen at run time and is not propagated: a container keeps
+  /// its resource when assigned or swapped, and a copied container uses the default
+  /// resource. When the resource skips deallocation, the allocator tells the containers
+  /// through `bulk_release_traits`, and a destroyed or cleared tree only runs the
+  /// destructors its values need.
+  template <typename _Tp>
+  class polymorphic_allocator
+  {
+    public:
+      using value_type      = _Tp;            ///< The type of the allocated objects.
+      using size_type       = std::size_t;    ///< Unsigned integer type for sizes.
+      using difference_type = std::ptrdiff_t; ///< Signed integer type for distances.
+
+    public:
+      /// @brief Allocate from `get_default_resource()`.
+      polymorphic_allocator() noexcept
+        : m_resource{ get_default_resource() } { }
+
+      /// @brief Allocate from __r, which must outlive the allocator and its copies.
+      polymorphic_allocator(memory_resource* __r) noexcept
+        : m_resource{ __r } { }
+
+      polymorphic_allocator(const polymorphic_allocator&) noexcept = default;
+      polymorphic_allocator& operator=(const polymorphic_allocator&) noexcept = default;
+
+      /// @brief Rebinding constructor, sharing the resource.
+      template <typename _Up>
+      polymorphic_allocator(const polymorphic_allocator<_Up>& __x) noexcept
+        : m_resource{ __x.resource() } { }
+
+      /// @brief A copied container allocates from the default resource.
+      polymorphic_allocator
+      select_on_container_copy_construction() const noexcept { return polymorphic_allocator(); }
+
+    public:
+      _Tp*
+      allocate(size_type __n)
+      {
+        if ( __n > max_size() ) throw std::bad_array_new_length();
+        return static_cast<_Tp*>(m_resource->allocate(__n * sizeof(_Tp), alignof(_Tp)));
+      }
+
+      void
+      deallocate(_Tp* __p, size_type __n) noexcept
+      {
+        m_resource->deallocate(__p, __n * sizeof(_Tp), alignof(_Tp));
+      }
+
+      size_type
+      max_size() const noexcept { return std::numeric_limits<size_type>::max() / sizeof(_Tp); }
+
+      /// @brief The resource the allocator draws from.
+      memory_resource*
+      resource() const noexcept { return m_resource; }
+
+    public:
+      /// @brief Whether deallocation may be skipped. See `bulk_release_traits`.
+      bool
+      __can_release() const noexcept { return m_resource->__skips_deallocate(); }
+
+      /// @brief Nothing to do: the memory goes back when the resource itself is released.
+      void
+      __release() noexcept { }
+
+    private:
+      memory_resource* m_resource; ///< The resource, never null.
+  };
+
+  template <typename _Tp, typename _Up>
+  inline bool
+  operator==(const polymorphic_allocator<_Tp>& __x, const polymorphic_allocator<_Up>& __y) noexcept
+  {
+    return *__x.resource() == *__y.resource();
+  }
+
+  template <typename _Tp, typename _Up>
+  inline bool
+  operator!=(const polymorphic_allocator<_Tp>& __x, const polymorphic_allocator<_Up>& __y) noexcept
+  {
+    return !(__x == __y);
+  }
+
+} // namespace ft
+
+#endif // __FT_MEMORY_RESOURCE__
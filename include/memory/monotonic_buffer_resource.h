@@ -0,0 +1,155 @@
+#ifndef   __FT_MONOTONIC_BUFFER_RESOURCE__
+# define  __FT_MONOTONIC_BUFFER_RESOURCE__
+
+# include <cstddef> // For std::size_t
+# include <cstdint> // For std::uintptr_t
+
+# include "memory_resource.h" // For memory_resource, get_default_resource
+
+namespace ft {
+
+  /// @brief Arena handing out memory with a bump pointer and freeing it all at once.
+  /// @details Allocation takes the next suitably aligned bytes of the current buffer; when
+  /// it is exhausted, a buffer twice as large is obtained from the upstream resource.
+  /// `deallocate` does nothing; `release()` or the destructor returns every buffer to the
+  /// upstream resource at once. An initial buffer supplied by the caller is used first
+  /// and never freed.
+  ///
+  /// Since deallocation is a no-op, containers using this resource through
+  /// `polymorphic_allocator` skip the per-node deallocation on destruction and only run
+  /// the destructors their values need. The resource is not thread-safe.
+  class monotonic_buffer_resource : public memory_resource
+  {
+    public:
+      static constexpr std::size_t default_buffer_size = 1024; ///< The size of the first upstream buffer.
+
+    private:
+      /// @brief Header placed at the start of every upstream buffer.
+      struct chunk
+      {
+        chunk*      m_next;      ///< The previously allocated buffer.
+        std::size_t m_size;      ///< The size of the buffer, header included.
+        std::size_t m_alignment; ///< The alignment the buffer was allocated with.
+      };
+
+    public:
+      /// @brief Draw buffers from the default resource.
+      monotonic_buffer_resource() noexcept
+        : monotonic_buffer_resource(get_default_resource()) { }
+
+      /// @brief Draw buffers from __upstream.
+      explicit
+      monotonic_buffer_resource(memory_resource* __upstream) noexcept
+        : monotonic_buffer_resource(default_buffer_size, __upstream) { }
+
+      /// @brief Draw buffers from __upstream, the first one of at least __initial_size bytes.
+      explicit
+      monotonic_buffer_resource(std::size_t __initial_size, memory_resource* __upstream = get_default_resource()) noexcept
+        : m_upstream{ __upstream },
+          m_chunks{ nullptr },
+          m_cur{ nullptr },
+          m_end{ nullptr },
+          m_initialBuffer{ nullptr },
+          m_initialSize{ 0 },
+          m_nextSize{ __initial_size > sizeof(chunk) ? __initial_size : default_buffer_size } { }
+
+      /// @brief Allocate from __buffer first, then from buffers drawn from __upstream.
+      monotonic_buffer_resource(void* __buffer, std::size_t __size,
+                                memory_resource* __upstream = get_default_resource()) noexcept
+        : m_upstream{ __upstream },
+          m_chunks{ nullptr },
+          m_cur{ static_cast<char*>(__buffer) },
+          m_end{ static_cast<char*>(__buffer) + __size },
+          m_initialBuffer{ static_cast<char*>(__buffer) },
+          m_initialSize{ __size },
+          m_nextSize{ __size * 2 > default_buffer_size ? __size * 2 : default_buffer_size } { }
+
+      monotonic_buffer_resource(const monotonic_buffer_resource&) = delete;
+      monotonic_buffer_resource& operator=(const monotonic_buffer_resource&) = delete;
+
+      /// @brief Return every buffer to the upstream resource.
+      ~monotonic_buffer_resource() override { release(); }
+
+      /// @brief Return every buffer to the upstream resource, invalidating all allocations.
+      /// @details Allocation restarts from the initial buffer, if one was given.
+      void
+      release() noexcept
+      {
+        while ( m_chunks != nullptr ) {
+          chunk* __next = m_chunks->m_next;
+          m_upstream->deallocate(m_chunks, m_chunks->m_size, m_chunks->m_alignment);
+          m_chunks = __next;
+        }
+        m_cur = m_initialBuffer;
+        m_end = m_initialBuffer + m_initialSize;
+      }
+
+      /// @brief The resource buffers are drawn from.
+      memory_resource*
+      upstream_resource() const noexcept { return m_upstream; }
+
+    private:
+      void*
+      do_allocate(std::size_t __bytes, std::size_t __alignment) override
+      {
+        if ( void* __p = __bump(__bytes, __alignment) ) return __p;
+        __grow(__bytes, __alignment);
+        return __bump(__bytes, __alignment);
+      }
+
+      void
+      do_deallocate(void*, std::size_t, std::size_t) override { }
+
+      bool
+      do_is_equal(const memory_resource& __other) const noexcept override { return this == &__other; }
+
+      bool
+      do_skips_deallocate() const noexcept override { return true; }
+
+      /// @brief Carve __bytes out of the current buffer, or return nullptr if they do not fit.
+      void*
+      __bump(std::size_t __bytes, std::size_t __alignment) noexcept
+      {
+        if ( m_cur == nullptr ) return nullptr;
+
+        const std::uintptr_t __p = ( reinterpret_cast<std::uintptr_t>(m_cur) + __alignment - 1 )
+                                   & ~static_cast<std::uintptr_t>(__alignment - 1);
+        const std::uintptr_t __e = reinterpret_cast<std::uintptr_t>(m_end);
+
+        if ( __p > __e || __e - __p < __bytes ) return nullptr;
+        m_cur = reinterpret_cast<char*>(__p + __bytes);
+        return reinterpret_cast<void*>(__p);
+      }
+
+      /// @brief Draw a buffer large enough for __bytes at __alignment, at least twice the previous one.
+      void
+      __grow(std::size_t __bytes, std::size_t __alignment)
+      {
+        const std::size_t __align = __alignment > alignof(chunk) ? __alignment : alignof(chunk);
+        std::size_t       __size  = sizeof(chunk) + __align + __bytes;
+
+        if ( __size < m_nextSize ) __size = m_nextSize;
+
+        chunk* __c = static_cast<chunk*>(m_upstream->allocate(__size, __align));
+        __c->m_next      = m_chunks;
+        __c->m_size      = __size;
+        __c->m_alignment = __align;
+        m_chunks = __c;
+        m_cur    = reinterpret_cast<char*>(__c + 1);
+        m_end    = reinterpret_cast<char*>(__c) + __size;
+        m_nextSize = __size * 2;
+      }
+
+    private:
+      memory_resource* m_upstream;      ///< The source of the buffers.
+      chunk*           m_chunks;        ///< The buffers drawn from upstream, newest first.
+      char*            m_cur;           ///< The next free byte of the current buffer.
+      char*            m_end;           ///< The end of the current buffer.
+      char*            m_initialBuffer; ///< The buffer supplied by the caller, or nullptr.
+      std::size_t      m_initialSize;   ///< The size of the initial buffer.
+      std::size_t      m_nextSize;      ///< The minimum size of the next upstream buffer.
+  };
+
+} // namespace ft
+
+#endif // __FT_MONOTONIC_BUFFER_RESOURCE__
@@ -0,0 +1,282 @@
+#ifndef   __FT_NODE_POOL__
+# define  __FT_NODE_POOL__
+
+# include <cstddef>     // For std::size_t, std::ptrdiff_t, std::max_align_t
+# include <limits>      // For std::numeric_limits
+# include <memory>      // For std::allocator, std::shared_ptr, std::make_shared
+# include <new>         // For ::operator new, ::operator delete
+# include <type_traits> // For std::is_base_of, std::true_type, std::false_type
+
+# include "../tree/rb_tree_node_base.h" // For rb_tree_node_base
+
+namespace ft {
+
+  /// @brief Slab allocator for fixed-size tree nodes.
+  /// @details Nodes are carved out of contiguous chunks with a bump pointer. Freed nodes are
+  /// kept on an intrusive singly linked freelist threaded through `rb_tree_node_base::m_left`,
+  /// so the pool needs no memory of its own besides a one-pointer header per chunk.
+  ///
+  /// Chunks start small and double in size up to `max_chunk_nodes`, so small trees stay
+  /// small and large trees amortize the chunk allocations away. `release()` frees every
+  /// chunk at once without looking at the nodes.
+  ///
+  /// @tparam _Node The node type; it must derive from `rb_tree_node_base`.
+  template <typename _Node>
+  class node_pool
+  {
+    static_assert(std::is_base_of<rb_tree_node_base, _Node>::value,
+                  "ft::node_pool: the node type must derive from rb_tree_node_base");
+    static_assert(alignof(_Node) <= alignof(std::max_align_t),
+                  "ft::node_pool: over-aligned node types are not supported");
+
+    public:
+      using size_type = std::size_t; ///< Unsigned integer type for sizes.
+
+      static constexpr size_type min_chunk_nodes = 32;   ///< Number of nodes in the first chunk.
+      static constexpr size_type max_chunk_nodes = 4096; ///< Upper bound for the chunk growth.
+
+    private:
+      /// @brief Header placed in front of the nodes of every chunk.
+      struct chunk
+      {
+        chunk* m_next; ///< The previously allocated chunk.
+      };
+
+      /// @brief Size of the chunk header, rounded up so that the first node is aligned.
+      static constexpr size_type header_size =
+        (sizeof(chunk) + alignof(_Node) - 1) / alignof(_Node) * alignof(_Node);
+
+    public:
+      /// @brief Default constructor.
+      /// @details No memory is allocated until the first node is requested.
+      node_pool() noexcept
+        : m_chunks{ nullptr },
+          m_freeList{ nullptr },
+          m_cur{ nullptr },
+          m_end{ nullptr },
+          m_nextChunkNodes{ min_chunk_nodes },
+          m_liveCount{ 0 } { }
+
+      node_pool(const node_pool&) = delete;
+      node_pool& operator=(const node_pool&) = delete;
+
+      /// @brief Destructor.
+      /// @details Frees every chunk; nodes still in use must not be touched afterwards.
+      ~node_pool() noexcept { release(); }
+
+    public:
+      /// @brief Get memory for one node.
+      /// @return Uninitialized storage suitable for a `_Node`.
+      /// @details Reuses a freed node if there is one, otherwise bumps the pointer of the
+      /// current chunk, allocating a new chunk when it is exhausted.
+      _Node*
+      allocate()
+      {
+        if ( m_freeList != nullptr ) {
+          rb_tree_node_base* __p = m_freeList;
+          m_freeList = __p->m_left;
+          ++m_liveCount;
+          return static_cast<_Node*>(static_cast<void*>(__p));
+        }
+
+        if ( m_cur == m_end ) __grow();
+
+        _Node* __p = m_cur++;
+        ++m_liveCount;
+        return __p;
+      }
+
+      /// @brief Return one node to the pool.
+      /// @param __p The node, already destroyed.
+      void
+      deallocate(_Node* __p) noexcept
+      {
+        rb_tree_node_base* __link = ::new(static_cast<void*>(__p)) rb_tree_node_base;
+        __link->m_left = m_freeList;
+        m_freeList = __link;
+        --m_liveCount;
+      }
+
+      /// @brief Free every chunk at once.
+      /// @details All nodes handed out by the pool become invalid; their destructors are not run.
+      void
+      release() noexcept
+      {
+        while ( m_chunks != nullptr ) {
+          chunk* __next = m_chunks->m_next;
+          ::operator delete(static_cast<void*>(m_chunks));
+          m_chunks = __next;
+        }
+        m_freeList       = nullptr;
+        m_cur            = nullptr;
+        m_end            = nullptr;
+        m_nextChunkNodes = min_chunk_nodes;
+        m_liveCount      = 0;
+      }
+
+    public:
+      /// @brief Get the number of nodes currently handed out.
+      size_type
+      live_count() const noexcept { return m_liveCount; }
+
+      /// @brief Get the number of chunks currently owned by the pool.
+      size_type
+      chunk_count() const noexcept
+      {
+        size_type __n = 0;
+        for ( const chunk* __c = m_chunks; __c != nullptr; __c = __c->m_next ) ++__n;
+        return __n;
+      }
+
+    private:
+      /// @brief Allocate a new chunk and make it the current bump region.
+      void
+      __grow()
+      {
+        const size_type __nodes = m_nextChunkNodes;
+        void* __raw = ::operator new(header_size + __nodes * sizeof(_Node));
+
+        chunk* __c  = static_cast<chunk*>(__raw);
+        __c->m_next = m_chunks;
+        m_chunks    = __c;
+
+        m_cur = static_cast<_Node*>(static_cast<void*>(static_cast<unsigned char*>(__raw) + header_size));
+        m_end = m_cur + __nodes;
+
+        if ( m_nextChunkNodes < max_chunk_nodes ) m_nextChunkNodes *= 2;
+      }
+
+    private:
+      chunk*             m_chunks;         ///< Singly linked list of owned chunks, newest first.
+      rb_tree_node_base* m_freeList;       ///< Freed nodes, linked through m_left.
+      _Node*             m_cur;            ///< Next never-used node in the current chunk.
+      _Node*             m_end;            ///< End of the current chunk.
+      size_type          m_nextChunkNodes; ///< Number of nodes in the next chunk to allocate.
+      size_type          m_liveCount;      ///< Number of nodes currently handed out.
+  };
+
+  /// @brief Allocator drawing tree nodes from a `node_pool`.
+  /// @details Pass it as the allocator of `ft::map`, `ft::set` and friends; the tree rebinds
+  /// it to its node type, which gets a pool of its own. Copies of a node allocator share
+  /// the pool, but a copied container selects a fresh one, so every container owns its pool
+  /// and can free it in bulk when it is cleared or destroyed.
+  ///
+  /// Rebinding to a type that is not a tree node yields a plain, stateless allocator.
+  template <typename _Tp, bool = std::is_base_of<rb_tree_node_base, _Tp>::value>
+  class node_pool_allocator
+  {
+    public:
+      using value_type      = _Tp;            ///< The type of the allocated objects.
+      using pointer         = _Tp*;           ///< Pointer type to the objects.
+      using const_pointer   = const _Tp*;     ///< Const pointer type to the objects.
+      using size_type       = std::size_t;    ///< Unsigned integer type for sizes.
+      using difference_type = std::ptrdiff_t; ///< Signed integer type for distances.
+
+      using propagate_on_container_copy_assignment = std::false_type;
+      using propagate_on_container_move_assignment = std::true_type;
+      using propagate_on_container_swap            = std::true_type;
+      using is_always_equal                        = std::false_type;
+
+      template <typename _Up>
+      struct rebind { using other = node_pool_allocator<_Up>; };
+
+    public:
+      /// @brief Default constructor, creating a new pool.
+      node_pool_allocator()
+        : m_pool{ std::make_shared<node_pool<_Tp>>() } { }
+
+      /// @brief Copy constructor, sharing the pool.
+      /// @details Moving is deliberately a copy as well, so that a moved-from container can
+      /// still allocate from the pool its remaining nodes live in.
+      node_pool_allocator(const node_pool_allocator&) noexcept = default;
+      node_pool_allocator& operator=(const node_pool_allocator&) noexcept = default;
+
+      /// @brief Rebinding constructor, creating a new pool for the node type.
+      template <typename _Up, bool _B>
+      node_pool_allocator(const node_pool_allocator<_Up, _B>&)
+        : m_pool{ std::make_shared<node_pool<_Tp>>() } { }
+
+      /// @brief Give a copied container a pool of its own.
+      node_pool_allocator
+      select_on_container_copy_construction() const { return node_pool_allocator(); }
+
+    public:
+      _Tp*
+      allocate(size_type __n)
+      {
+        if ( __n == 1 ) return m_pool->allocate();
+        return static_cast<_Tp*>(::operator new(__n * sizeof(_Tp)));
+      }
+
+      void
+      deallocate(_Tp* __p, size_type __n) noexcept
+      {
+        if ( __n == 1 ) m_pool->deallocate(__p);
+        else ::operator delete(static_cast<void*>(__p));
+      }
+
+      size_type
+      max_size() const noexcept { return std::numeric_limits<size_type>::max() / sizeof(_Tp); }
+
+      /// @brief Get the underlying pool.
+      node_pool<_Tp>&
+      pool() const noexcept { return *m_pool; }
+
+    public:
+      /// @brief Whether the pool is owned by this allocator alone. See `bulk_release_traits`.
+      bool
+      __can_release() const noexcept { return m_pool.use_count() == 1; }
+
+      /// @brief Free every chunk of the pool at once. See `bulk_release_traits`.
+      void
+      __release() noexcept { m_pool->release(); }
+
+      friend bool
+      operator==(const node_pool_allocator& __x, const node_pool_allocator& __y) noexcept
+      {
+        return __x.m_pool == __y.m_pool;
+      }
+
+      friend bool
+      operator!=(const node_pool_allocator& __x, const node_pool_allocator& __y) noexcept
+      {
+        return __x.m_pool != __y.m_pool;
+      }
+
+    private:
+      std::shared_ptr<node_pool<_Tp>> m_pool; ///< The pool shared by the copies of this allocator.
+  };
+
+  /// @brief Specialization for types that are not tree nodes.
+  /// @details This is the allocator type the user names for the container's value type; it
+  /// holds no pool and only exists to be rebound to the node type.
+  template <typename _Tp>
+  class node_pool_allocator<_Tp, false> : public std::allocator<_Tp>
+  {
+    public:
+      using value_type = _Tp; ///< The type of the allocated objects.
+
+      using propagate_on_container_copy_assignment = std::false_type;
+      using propagate_on_container_move_assignment = std::true_type;
+      using propagate_on_container_swap            = std::true_type;
+      using is_always_equal                        = std::true_type;
+
+      template <typename _Up>
+      struct rebind { using other = node_pool_allocator<_Up>; };
+
+    public:
+      node_pool_allocator() noexcept = default;
+
+      template <typename _Up, bool _B>
+      node_pool_allocator(const node_pool_allocator<_Up, _B>&) noexcept { }
+
+      friend bool
+      operator==(const node_pool_allocator&, const node_pool_allocator&) noexcept { return true; }
+
+      friend bool
+      operator!=(const node_pool_allocator&, const node_pool_allocator&) noexcept { return false; }
+  };
+
+} // namespace ft
+
+#endif // __FT_NODE_POOL__
@@ -0,0 +1,260 @@
+#ifndef   __FT_POOL_RESOURCE__
+# define  __FT_POOL_RESOURCE__
+
+# include <cstddef> // For std::size_t
+
+# include "memory_resource.h" // For memory_resource, get_default_resource
+
+namespace ft {
+
+  /// @brief Tuning knobs of the pool resources, as in `std::pmr::pool_options`.
+  struct pool_options
+  {
+    std::size_t max_blocks_per_chunk        = 0; ///< The most blocks a chunk holds; 0 picks the default.
+    std::size_t largest_required_pool_block = 0; ///< The largest request served from a pool; 0 picks the default.
+  };
+
+  /// @brief Resource keeping one free list per power-of-two block size, not thread-safe.
+  /// @details A request is rounded up to the next block size of at least 8 bytes and served
+  /// from that pool: from its free list if a block was returned, otherwise from the current
+  /// chunk, a contiguous run of blocks drawn from the upstream resource. Chunks start at 8
+  /// blocks and double up to `max_blocks_per_chunk`. Requests larger than
+  /// `largest_required_pool_block`, or aligned more strictly than the chunks are, go
+  /// directly to the upstream resource.
+  ///
+  /// Tree nodes all have the same size, so a tree using this resource through
+  /// `polymorphic_allocator` recycles freed nodes in O(1) without touching the upstream
+  /// resource. `release()` and the destructor return every chunk at once.
+  class unsynchronized_pool_resource : public memory_resource
+  {
+    public:
+      static constexpr std::size_t default_max_blocks_per_chunk = 4096; ///< The default cap on the blocks per chunk.
+      static constexpr std::size_t default_largest_block        = 4096; ///< The default largest pooled request.
+      static constexpr std::size_t max_largest_block            = std::size_t(1) << 20; ///< The cap on the largest pooled request.
+
+    private:
+      static constexpr std::size_t min_block    = 8;  ///< The smallest block size.
+      static constexpr std::size_t max_pools    = 18; ///< The number of block sizes, up to `max_largest_block`.
+      static constexpr std::size_t first_blocks = 8;  ///< The number of blocks in the first chunk of a pool.
+
+      static_assert(( min_block << ( max_pools - 1 ) ) == max_largest_block,
+                    "ft::unsynchronized_pool_resource: one pool per block size up to the largest");
+
+      /// @brief A free block, linked through its first word.
+      struct block
+      {
+        block* m_next;
+      };
+
+      /// @brief Header in front of every chunk; the blocks follow it.
+      struct alignas(max_align) chunk
+      {
+        chunk*      m_next; ///< The previous chunk of the same pool.
+        std::size_t m_size; ///< The size of the chunk, header included.
+      };
+
+      /// @brief Header in front of every oversized allocation, in a doubly linked list.
+      struct alignas(max_align) large
+      {
+        large*      m_prev;      ///< The previous oversized allocation.
+        large*      m_next;      ///< The next oversized allocation.
+        std::size_t m_size;      ///< The size drawn from upstream, header included.
+        std::size_t m_alignment; ///< The alignment drawn from upstream.
+      };
+
+      /// @brief The blocks of one size.
+      struct pool
+      {
+        block*      m_free   = nullptr; ///< Returned blocks.
+        char*       m_cur    = nullptr; ///< The next never-used block of the current chunk.
+        char*       m_end    = nullptr; ///< The end of the current chunk.
+        chunk*      m_chunks = nullptr; ///< The chunks of the pool, newest first.
+        std::size_t m_next   = first_blocks; ///< The number of blocks in the next chunk.
+      };
+
+    public:
+      /// @brief Draw chunks from the default resource.
+      unsynchronized_pool_resource() noexcept
+        : unsynchronized_pool_resource(pool_options(), get_default_resource()) { }
+
+      /// @brief Draw chunks from __upstream.
+      explicit
+      unsynchronized_pool_resource(memory_resource* __upstream) noexcept
+        : unsynchronized_pool_resource(pool_options(), __upstream) { }
+
+      /// @brief Draw chunks from __upstream, with the given options.
+      explicit
+      unsynchronized_pool_resource(const pool_options& __opts, memory_resource* __upstream = get_default_resource()) noexcept
+        : m_upstream{ __upstream },
+          m_pools{ },
+          m_large{ nullptr },
+          m_options{ __opts }
+      {
+        if ( m_options.max_blocks_per_chunk == 0 ) m_options.max_blocks_per_chunk = default_max_blocks_per_chunk;
+        if ( m_options.max_blocks_per_chunk < first_blocks ) m_options.max_blocks_per_chunk = first_blocks;
+        if ( m_options.largest_required_pool_block == 0 ) m_options.largest_required_pool_block = default_largest_block;
+        if ( m_options.largest_required_pool_block > max_largest_block ) m_options.largest_required_pool_block = max_largest_block;
+        m_options.largest_required_pool_block = __block_size(__pool_index(m_options.largest_required_pool_block));
+      }
+
+      unsynchronized_pool_resource(const unsynchronized_pool_resource&) = delete;
+      unsynchronized_pool_resource& operator=(const unsynchronized_pool_resource&) = delete;
+
+      /// @brief Return every chunk to the upstream resource.
+      ~unsynchronized_pool_resource() override { release(); }
+
+      /// @brief Return every chunk and oversized allocation to the upstream resource,
+      /// invalidating all allocations.
+      void
+      release() noexcept
+      {
+        for ( pool& __p : m_pools ) {
+          while ( __p.m_chunks != nullptr ) {
+            chunk* __next = __p.m_chunks->m_next;
+            m_upstream->deallocate(__p.m_chunks, __p.m_chunks->m_size, alignof(chunk));
+            __p.m_chunks = __next;
+          }
+          __p = pool();
+        }
+        while ( m_large != nullptr ) {
+          large* __next = m_large->m_next;
+          m_upstream->deallocate(reinterpret_cast<char*>(m_large + 1) - __large_offset(m_large->m_alignment),
+                                 m_large->m_size, m_large->m_alignment);
+          m_large = __next;
+        }
+      }
+
+      /// @brief The resource chunks are drawn from.
+      memory_resource*
+      upstream_resource() const noexcept { return m_upstream; }
+
+      /// @brief The options in effect, with defaults filled in and the largest block rounded up.
+      pool_options
+      options() const noexcept { return m_options; }
+
+    private:
+      void*
+      do_allocate(std::size_t __bytes, std::size_t __alignment) override
+      {
+        if ( !__pooled(__bytes, __alignment) ) return __allocate_large(__bytes, __alignment);
+
+        const std::size_t __i = __pool_index(__bytes);
+        pool&             __p = m_pools[__i];
+
+        if ( __p.m_free != nullptr ) {
+          block* __b = __p.m_free;
+          __p.m_free = __b->m_next;
+          return __b;
+        }
+        if ( __p.m_cur == __p.m_end ) __grow(__p, __block_size(__i));
+
+        void* __r = __p.m_cur;
+        __p.m_cur += __block_size(__i);
+        return __r;
+      }
+
+      void
+      do_deallocate(void* __ptr, std::size_t __bytes, std::size_t __alignment) override
+      {
+        if ( !__pooled(__bytes, __alignment) ) {
+          __deallocate_large(__ptr);
+          return;
+        }
+
+        pool&  __p = m_pools[__pool_index(__bytes)];
+        block* __b = static_cast<block*>(__ptr);
+
+        __b->m_next = __p.m_free;
+        __p.m_free  = __b;
+      }
+
+      bool
+      do_is_equal(const memory_resource& __other) const noexcept override { return this == &__other; }
+
+      /// @brief Whether a request is served from a pool: small enough, and aligned no more
+      /// strictly than both its block size and the chunks.
+      bool
+      __pooled(std::size_t __bytes, std::size_t __alignment) const noexcept
+      {
+        return __bytes <= m_options.largest_required_pool_block && __alignment <= max_align
+            && __alignment <= __block_size(__pool_index(__bytes));
+      }
+
+      /// @brief The index of the smallest block size holding __bytes.
+      static std::size_t
+      __pool_index(std::size_t __bytes) noexcept
+      {
+        std::size_t __i = 0;
+
+        while ( __block_size(__i) < __bytes ) ++__i;
+        return __i;
+      }
+
+      static constexpr std::size_t
+      __block_size(std::size_t __i) noexcept { return min_block << __i; }
+
+      /// @brief Give pool __p a new chunk of blocks of __size bytes.
+      void
+      __grow(pool& __p, std::size_t __size)
+      {
+        std::size_t __blocks = __p.m_next;
+
+        if ( __blocks > m_options.max_blocks_per_chunk ) __blocks = m_options.max_blocks_per_chunk;
+
+        const std::size_t __bytes = sizeof(chunk) + __blocks * __size;
+        chunk*            __c     = static_cast<chunk*>(m_upstream->allocate(__bytes, alignof(chunk)));
+
+        __c->m_next  = __p.m_chunks;
+        __c->m_size  = __bytes;
+        __p.m_chunks = __c;
+        __p.m_cur    = reinterpret_cast<char*>(__c + 1);
+        __p.m_end    = __p.m_cur + __blocks * __size;
+        if ( __p.m_next < m_options.max_blocks_per_chunk ) __p.m_next *= 2;
+      }
+
+      /// @brief The distance from the start of an oversized allocation to the memory handed out.
+      static std::size_t
+      __large_offset(std::size_t __alignment) noexcept
+      {
+        return __alignment > sizeof(large) ? __alignment : sizeof(large);
+      }
+
+      void*
+      __allocate_large(std::size_t __bytes, std::size_t __alignment)
+      {
+        const std::size_t __align  = __alignment > alignof(large) ? __alignment : alignof(large);
+        const std::size_t __offset = __large_offset(__align);
+        char*             __base   = static_cast<char*>(m_upstream->allocate(__offset + __bytes, __align));
+        large*            __h      = reinterpret_cast<large*>(__base + __offset) - 1;
+
+        __h->m_prev      = nullptr;
+        __h->m_next      = m_large;
+        __h->m_size      = __offset + __bytes;
+        __h->m_alignment = __align;
+        if ( m_large != nullptr ) m_large->m_prev = __h;
+        m_large = __h;
+        return __base + __offset;
+      }
+
+      void
+      __deallocate_large(void* __ptr) noexcept
+      {
+        large* __h = static_cast<large*>(__ptr) - 1;
+
+        if ( __h->m_prev != nullptr ) __h->m_prev->m_next = __h->m_next;
+        else m_large = __h->m_next;
+        if ( __h->m_next != nullptr ) __h->m_next->m_prev = __h->m_prev;
+        m_upstream->deallocate(static_cast<char*>(__ptr) - __large_offset(__h->m_alignment),
+                               __h->m_size, __h->m_alignment);
+      }
+
+    private:
+      memory_resource* m_upstream;         ///< The source of the chunks.
+      pool             m_pools[max_pools]; ///< One pool per block size, smallest first.
+      large*           m_large;            ///< The oversized allocations, newest first.
+      pool_options     m_options;          ///< The options in effect.
+  };
+
+} // namespace ft
+
+#endif // __FT_POOL_RESOURCE__
@@ -0,0 +1,21 @@
+#ifndef   __FT_PREFETCH__
+# define  __FT_PREFETCH__
+
+namespace ft {
+
+  /// @brief Hint that the cache line holding __p will be read soon.
+  /// @details Compiles to a prefetch instruction where the compiler offers one, and to
+  /// nothing elsewhere. Prefetching never faults, so __p may be any address.
+  inline void
+  __prefetch(const void* __p) noexcept
+  {
+# if defined(__GNUC__)
+    __builtin_prefetch(__p);
+# else
+    (void)__p;
+# endif
+  }
+
+} // namespace ft
+
+#endif // __FT_PREFETCH__
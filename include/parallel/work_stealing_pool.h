@@ -0,0 +1,272 @@
+#ifndef   __FT_WORK_STEALING_POOL__
+# define  __FT_WORK_STEALING_POOL__
+
+# include <atomic>             // For std::atomic
+# include <condition_variable> // For std::condition_variable
+# include <cstddef>            // For std::size_t
+# include <exception>          // For std::exception_ptr, std::current_exception, std::rethrow_exception
+# include <memory>             // For std::unique_ptr
+# include <mutex>              // For std::mutex, std::lock_guard, std::unique_lock
+# include <thread>             // For std::thread, std::this_thread::yield
+# include <vector>             // For std::vector
+
+namespace ft {
+
+  /// @brief Small fork-join thread pool with one task queue per thread and work stealing.
+  /// @details The pool runs the two halves of divide-and-conquer algorithms in parallel:
+  /// `invoke(f, g)` queues f, runs g on the calling thread, then runs queued tasks until f
+  /// has completed, either because the caller got it back or because an idle thread stole
+  /// it. Every thread pushes and pops at the back of its own queue, so it works depth-first
+  /// on the subproblems it created, and steals from the front of the others, where the
+  /// largest subproblems wait.
+  ///
+  /// A task lives in the frame of the `invoke` that queued it, so forking allocates
+  /// nothing; a full queue makes `invoke` run both halves itself. Threads that are not
+  /// workers of the pool may call `invoke` too, and help the workers while they wait.
+  class work_stealing_pool
+  {
+    public:
+      static constexpr std::size_t queue_capacity = 1024; ///< The number of tasks a queue holds.
+
+    public:
+      /// @brief Start a pool.
+      /// @param __workers The number of worker threads; the threads calling `invoke` take
+      /// part as well, so one less than the number of cores keeps every core busy.
+      explicit
+      work_stealing_pool(std::size_t __workers = __default_workers())
+        : m_queues{ new __queue[__workers + 1] }, m_queueCount{ __workers + 1 }
+      {
+        m_threads.reserve(__workers);
+        try {
+          for ( std::size_t __i = 0; __i < __workers; ++__i )
+            m_threads.emplace_back([this, __i] { __work(__i); });
+        } catch ( ... ) {
+          __stop();
+          throw;
+        }
+      }
+
+      work_stealing_pool(const work_stealing_pool&) = delete;
+      work_stealing_pool& operator=(const work_stealing_pool&) = delete;
+
+      /// @brief Stop and join the workers. No `invoke` may be running.
+      ~work_stealing_pool() { __stop(); }
+
+      /// @brief The number of threads that run tasks: the workers and one caller.
+      std::size_t
+      concurrency() const noexcept { return m_threads.size() + 1; }
+
+      /// @brief How many times a divide-and-conquer algorithm should fork in depth.
+      /// @details Enough levels for about eight tasks per thread, so that stealing can even
+      /// out subproblems of unequal cost.
+      unsigned int
+      fork_depth() const noexcept
+      {
+        unsigned int __d = 3;
+
+        for ( std::size_t __n = concurrency(); __n > 1; __n >>= 1 ) ++__d;
+        return __d;
+      }
+
+      /// @brief Run __f and __g, possibly in parallel, and return once both have completed.
+      /// @details If either throws, the exception is rethrown after both have completed; if
+      /// both throw, the one from __f wins. When the queue of the calling thread is full, __f
+      /// runs here first, with its exception held back the same way.
+      template <typename _Fn1, typename _Fn2>
+      void
+      invoke(_Fn1&& __f, _Fn2&& __g)
+      {
+        __task_of<_Fn1> __t(__f);
+        __queue&        __q = m_queues[__index()];
+
+        if ( __q.__push(&__t) ) __announce();
+        else __execute(&__t);
+
+        std::exception_ptr __error;
+
+        try {
+          __g();
+        } catch ( ... ) {
+          __error = std::current_exception();
+        }
+        while ( !__t.m_done.load(std::memory_order_acquire) ) {
+          if ( __task* __o = __find_task(__index()) ) __execute(__o);
+          else std::this_thread::yield();
+        }
+        if ( __t.m_error ) std::rethrow_exception(__t.m_error);
+        if ( __error ) std::rethrow_exception(__error);
+      }
+
+    private:
+      /// @brief A queued task; `invoke` waits on `m_done` before its frame goes away.
+      struct __task
+      {
+        void             (*m_run)(__task*);
+        std::atomic<bool>  m_done{ false };
+        std::exception_ptr m_error;
+      };
+
+      template <typename _Fn>
+      struct __task_of : __task
+      {
+        _Fn& m_fn;
+
+        explicit
+        __task_of(_Fn& __fn) : m_fn(__fn) { this->m_run = &__task_of::__run; }
+
+        static void
+        __run(__task* __t)
+        {
+          try {
+            static_cast<__task_of*>(__t)->m_fn();
+          } catch ( ... ) {
+            __t->m_error = std::current_exception();
+          }
+        }
+      };
+
+      /// @brief A bounded double-ended task queue; the owner works at the back, thieves at the front.
+      struct alignas(64) __queue
+      {
+        std::mutex  m_lock;
+        __task*     m_slots[queue_capacity];
+        std::size_t m_head = 0; ///< The index of the front task.
+        std::size_t m_size = 0; ///< The number of queued tasks.
+
+        bool
+        __push(__task* __t)
+        {
+          std::lock_guard<std::mutex> __lock(m_lock);
+
+          if ( m_size == queue_capacity ) return false;
+          m_slots[( m_head + m_size++ ) % queue_capacity] = __t;
+          return true;
+        }
+
+        __task*
+        __pop_back()
+        {
+          std::lock_guard<std::mutex> __lock(m_lock);
+
+          return m_size == 0 ? nullptr : m_slots[( m_head + --m_size ) % queue_capacity];
+        }
+
+        __task*
+        __pop_front()
+        {
+          std::lock_guard<std::mutex> __lock(m_lock);
+
+          if ( m_size == 0 ) return nullptr;
+          __task* __t = m_slots[m_head];
+          m_head = ( m_head + 1 ) % queue_capacity;
+          --m_size;
+          return __t;
+        }
+      };
+
+      static std::size_t
+      __default_workers() noexcept
+      {
+        const unsigned int __n = std::thread::hardware_concurrency();
+        return __n > 1 ? __n - 1 : 0;
+      }
+
+      /// @brief The queue of the calling thread: its own for a worker, the shared last one otherwise.
+      std::size_t
+      __index() const noexcept
+      {
+        return tl_pool == this ? tl_index : m_queueCount - 1;
+      }
+
+      /// @brief Take a task: the newest one of queue __i, or else the oldest one of another.
+      __task*
+      __find_task(std::size_t __i) noexcept
+      {
+        if ( __task* __t = m_queues[__i].__pop_back() ) return __taken(__t);
+        for ( std::size_t __k = 1; __k < m_queueCount; ++__k )
+          if ( __task* __t = m_queues[( __i + __k ) % m_queueCount].__pop_front() ) return __taken(__t);
+        return nullptr;
+      }
+
+      __task*
+      __taken(__task* __t) noexcept
+      {
+        m_queued.fetch_sub(1, std::memory_order_relaxed);
+        return __t;
+      }
+
+      static void
+      __execute(__task* __t) noexcept
+      {
+        __t->m_run(__t);
+        __t->m_done.store(true, std::memory_order_release);
+      }
+
+      /// @brief Count a newly queued task and wake an idle worker for it.
+      void
+      __announce()
+      {
+        m_queued.fetch_add(1, std::memory_order_seq_cst);
+        if ( m_sleeping.load(std::memory_order_seq_cst) != 0 ) {
+          { std::lock_guard<std::mutex> __lock(m_sleepLock); }
+          m_wake.notify_one();
+        }
+      }
+
+      /// @brief The loop of worker __i: run tasks, sleep when there are none.
+      void
+      __work(std::size_t __i)
+      {
+        tl_pool  = this;
+        tl_index = __i;
+        for ( ;; ) {
+          if ( __task* __t = __find_task(__i) ) {
+            __execute(__t);
+            continue;
+          }
+          std::unique_lock<std::mutex> __lock(m_sleepLock);
+
+          m_sleeping.fetch_add(1, std::memory_order_seq_cst);
+          m_wake.wait(__lock, [this] { return m_stop || m_queued.load(std::memory_order_seq_cst) != 0; });
+          m_sleeping.fetch_sub(1, std::memory_order_relaxed);
+          if ( m_stop ) return;
+        }
+      }
+
+      void
+      __stop() noexcept
+      {
+        {
+          std::lock_guard<std::mutex> __lock(m_sleepLock);
+          m_stop = true;
+        }
+        m_wake.notify_all();
+        for ( std::thread& __t : m_threads ) __t.join();
+      }
+
+    private:
+      std::unique_ptr<__queue[]> m_queues;          ///< One queue per worker, then the shared one.
+      std::size_t                m_queueCount;      ///< The number of queues.
+      std::vector<std::thread>   m_threads;         ///< The workers.
+      std::atomic<std::size_t>   m_queued{ 0 };     ///< The number of queued tasks.
+      std::atomic<std::size_t>   m_sleeping{ 0 };   ///< The number of idle workers.
+      std::mutex                 m_sleepLock;       ///< Guards `m_stop` and the idle workers' wait.
+      std::condition_variable    m_wake;            ///< Wakes idle workers.
+      bool                       m_stop = false;    ///< Whether the pool is shutting down.
+
+      static inline thread_local const work_stealing_pool* tl_pool  = nullptr; ///< The pool the calling thread works for.
+      static inline thread_local std::size_t               tl_index = 0;       ///< The queue of the calling worker.
+  };
+
+  /// @brief The process-wide pool used when an algorithm is given none, started on first use
+  /// with one worker per additional core.
+  inline work_stealing_pool&
+  default_work_stealing_pool()
+  {
+    static work_stealing_pool __pool;
+    return __pool;
+  }
+
+} // namespace ft
+
+#endif // __FT_WORK_STEALING_POOL__
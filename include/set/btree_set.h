@@ -0,0 +1,285 @@
+#ifndef   __FT_BTREE_SET__
+# define  __FT_BTREE_SET__
+
+# include <cstddef>    // For std::size_t
+# include <functional> // For std::less
+# include <memory>     // For std::allocator
+# include <utility>    // For std::move, std::forward
+
+# include "../tree/btree.h"             // For btree
+# include "../utility/pair.h"           // For ft::pair
+# include "../utility/functional.h"     // For ft::identity
+# include "../memory/memory_resource.h" // For polymorphic_allocator
+
+namespace ft {
+
+  /// @brief Ordered associative container of unique keys, stored in a B-tree.
+  /// @details A drop-in alternative to `ft::set`, see `btree_map`. Keys are packed many per
+  /// node, and every insertion and erasure invalidates all iterators.
+  ///
+  /// @tparam TargetNodeSize The desired size of a leaf node in bytes, see `btree_node`.
+  template <
+    typename Key,
+    typename Compare           = std::less<Key>,
+    typename Alloc             = std::allocator<Key>,
+    std::size_t TargetNodeSize = 256
+  > class btree_set
+  {
+    public:
+      using key_type       = Key;     ///< The type of the keys.
+      using value_type     = Key;     ///< The type of the stored elements.
+      using key_compare    = Compare; ///< The key comparison function type.
+      using value_compare  = Compare; ///< The element comparison function type.
+      using allocator_type = Alloc;   ///< The allocator type.
+
+    private:
+      using rep_type = btree<key_type, value_type, identity<value_type>, key_compare, allocator_type, TargetNodeSize>;
+
+      rep_type m_tree; ///< The B-tree holding the elements.
+
+    public:
+      using pointer                = typename rep_type::pointer;                ///< Pointer type to the element.
+      using const_pointer          = typename rep_type::const_pointer;          ///< Const pointer type to the element.
+      using reference              = typename rep_type::reference;              ///< Reference type to the element.
+      using const_reference        = typename rep_type::const_reference;        ///< Const reference type to the element.
+      using iterator               = typename rep_type::const_iterator;         ///< Constant bidirectional iterator.
+      using const_iterator         = typename rep_type::const_iterator;         ///< Constant bidirectional iterator.
+      using reverse_iterator       = typename rep_type::const_reverse_iterator; ///< Constant reverse iterator.
+      using const_reverse_iterator = typename rep_type::const_reverse_iterator; ///< Constant reverse iterator.
+      using size_type              = typename rep_type::size_type;              ///< Unsigned integer type for sizes.
+      using difference_type        = typename rep_type::difference_type;        ///< Signed integer type for distances.
+
+    public:
+      /// @brief Default constructor.
+      btree_set() = default;
+
+      /// @brief Constructor with a comparator and an allocator.
+      /// @param __comp The key comparison function.
+      /// @param __a The allocator.
+      explicit
+      btree_set(const Compare& __comp, const allocator_type& __a = allocator_type())
+        : m_tree{ __comp, __a } { }
+
+      /// @brief Constructor with an allocator, such as a `polymorphic_allocator` on a resource.
+      /// @param __a The allocator.
+      explicit
+      btree_set(const allocator_type& __a)
+        : m_tree{ Compare(), __a } { }
+
+      /// @brief Range constructor.
+      /// @param __first The beginning of the range to insert.
+      /// @param __last The end of the range to insert.
+      /// @details A sorted range is appended without any search.
+      template <typename _InputIterator>
+      btree_set(_InputIterator __first, _InputIterator __last,
+                const Compare& __comp = Compare(), const allocator_type& __a = allocator_type())
+        : m_tree{ __comp, __a }
+      {
+        m_tree.__insert_range_unique(__first, __last);
+      }
+
+      btree_set(const btree_set&) = default;
+      btree_set(btree_set&&) = default;
+      ~btree_set() = default;
+
+      btree_set& operator=(const btree_set&) = default;
+      btree_set& operator=(btree_set&&) = default;
+
+      allocator_type
+      get_allocator() const noexcept { return m_tree.get_allocator(); }
+
+    public:
+      iterator               begin()   const noexcept { return m_tree.begin(); }
+      iterator               end()     const noexcept { return m_tree.end(); }
+      reverse_iterator       rbegin()  const noexcept { return m_tree.rbegin(); }
+      reverse_iterator       rend()    const noexcept { return m_tree.rend(); }
+
+    public:
+      bool      empty()    const noexcept { return m_tree.empty(); }
+      size_type size()     const noexcept { return m_tree.size(); }
+      size_type max_size() const noexcept { return m_tree.max_size(); }
+
+    public:
+      /// @brief Insert a key if it is not present yet.
+      /// @return An iterator to the element with that key, and whether insertion took place.
+      pair<iterator, bool>
+      insert(const value_type& __x)
+      {
+        pair<typename rep_type::iterator, bool> __p = m_tree.__insert_unique(__x);
+        return pair<iterator, bool>(__p.first, __p.second);
+      }
+
+      pair<iterator, bool>
+      insert(value_type&& __x)
+      {
+        pair<typename rep_type::iterator, bool> __p = m_tree.__insert_unique(std::move(__x));
+        return pair<iterator, bool>(__p.first, __p.second);
+      }
+
+      /// @brief Insert a copy of __x, using __pos as a hint for where it goes.
+      /// @return An iterator to the element with the key of __x.
+      /// @details The descent is skipped when __x belongs right before or right after __pos,
+      /// e.g. when feeding sorted input with `end()` as the hint.
+      iterator
+      insert(const_iterator __pos, const value_type& __x) { return m_tree.__insert_unique(__pos, __x); }
+
+      iterator
+      insert(const_iterator __pos, value_type&& __x) { return m_tree.__insert_unique(__pos, std::move(__x)); }
+
+      /// @brief Insert every key of a range that is not present yet.
+      template <typename _InputIterator>
+      void
+      insert(_InputIterator __first, _InputIterator __last) { m_tree.__insert_range_unique(__first, __last); }
+
+      /// @brief Construct a key in place if it is not present yet.
+      /// @param __args The arguments forwarded to the constructor of `value_type`.
+      /// @return An iterator to the element with that key, and whether insertion took place.
+      template <typename... _Args>
+      pair<iterator, bool>
+      emplace(_Args&&... __args)
+      {
+        pair<typename rep_type::iterator, bool> __p = m_tree.__emplace_unique(std::forward<_Args>(__args)...);
+        return pair<iterator, bool>(__p.first, __p.second);
+      }
+
+      /// @brief Construct a key in place near a hint if it is not present yet.
+      /// @return An iterator to the element with that key.
+      template <typename... _Args>
+      iterator
+      emplace_hint(const_iterator __pos, _Args&&... __args)
+      {
+        return m_tree.__emplace_hint_unique(__pos, std::forward<_Args>(__args)...);
+      }
+
+      iterator
+      erase(const_iterator __position) { return m_tree.erase(__position); }
+
+      size_type
+      erase(const key_type& __k) { return m_tree.erase(__k); }
+
+      iterator
+      erase(const_iterator __first, const_iterator __last) { return m_tree.erase(__first, __last); }
+
+      void
+      swap(btree_set& __x) noexcept(noexcept(m_tree.swap(__x.m_tree))) { m_tree.swap(__x.m_tree); }
+
+      void
+      clear() noexcept { m_tree.clear(); }
+
+    public:
+      key_compare
+      key_comp() const { return m_tree.key_comp(); }
+
+      value_compare
+      value_comp() const { return m_tree.key_comp(); }
+
+    public:
+      iterator
+      find(const key_type& __k) const { return m_tree.find(__k); }
+
+      size_type
+      count(const key_type& __k) const { return m_tree.find(__k) == m_tree.end() ? 0 : 1; }
+
+      iterator
+      lower_bound(const key_type& __k) const { return m_tree.lower_bound(__k); }
+
+      iterator
+      upper_bound(const key_type& __k) const { return m_tree.upper_bound(__k); }
+
+      pair<iterator, iterator>
+      equal_range(const key_type& __k) const { return m_tree.equal_range(__k); }
+
+    public:
+      /// @brief Heterogeneous lookup, available when the comparator is transparent.
+      /// @details These overloads compare __x against the keys directly, so looking up a
+      /// `std::string` key by `const char*` or `std::string_view` allocates nothing.
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      iterator
+      find(const _Kt& __x) const { return m_tree.find(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      size_type
+      count(const _Kt& __x) const { return m_tree.count(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      iterator
+      lower_bound(const _Kt& __x) const { return m_tree.lower_bound(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      iterator
+      upper_bound(const _Kt& __x) const { return m_tree.upper_bound(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      pair<iterator, iterator>
+      equal_range(const _Kt& __x) const { return m_tree.equal_range(__x); }
+
+    public:
+      template <typename K1, typename C1, typename A1, std::size_t N1>
+      friend bool operator==(const btree_set<K1, C1, A1, N1>&, const btree_set<K1, C1, A1, N1>&);
+
+      template <typename K1, typename C1, typename A1, std::size_t N1>
+      friend bool operator<(const btree_set<K1, C1, A1, N1>&, const btree_set<K1, C1, A1, N1>&);
+  };
+
+  template <typename Key, typename Compare, typename Alloc, std::size_t N>
+  inline bool
+  operator==(const btree_set<Key, Compare, Alloc, N>& __x, const btree_set<Key, Compare, Alloc, N>& __y)
+  {
+    return __x.m_tree == __y.m_tree;
+  }
+
+  template <typename Key, typename Compare, typename Alloc, std::size_t N>
+  inline bool
+  operator<(const btree_set<Key, Compare, Alloc, N>& __x, const btree_set<Key, Compare, Alloc, N>& __y)
+  {
+    return __x.m_tree < __y.m_tree;
+  }
+
+  template <typename Key, typename Compare, typename Alloc, std::size_t N>
+  inline bool
+  operator!=(const btree_set<Key, Compare, Alloc, N>& __x, const btree_set<Key, Compare, Alloc, N>& __y)
+  {
+    return !(__x == __y);
+  }
+
+  template <typename Key, typename Compare, typename Alloc, std::size_t N>
+  inline bool
+  operator>(const btree_set<Key, Compare, Alloc, N>& __x, const btree_set<Key, Compare, Alloc, N>& __y)
+  {
+    return __y < __x;
+  }
+
+  template <typename Key, typename Compare, typename Alloc, std::size_t N>
+  inline bool
+  operator<=(const btree_set<Key, Compare, Alloc, N>& __x, const btree_set<Key, Compare, Alloc, N>& __y)
+  {
+    return !(__y < __x);
+  }
+
+  template <typename Key, typename Compare, typename Alloc, std::size_t N>
+  inline bool
+  operator>=(const btree_set<Key, Compare, Alloc, N>& __x, const btree_set<Key, Compare, Alloc, N>& __y)
+  {
+    return !(__x < __y);
+  }
+
+  /// @brief Swap the contents of two B-tree sets.
+  template <typename Key, typename Compare, typename Alloc, std::size_t N>
+  inline void
+  swap(btree_set<Key, Compare, Alloc, N>& __x, btree_set<Key, Compare, Alloc, N>& __y)
+    noexcept(noexcept(__x.swap(__y)))
+  {
+    __x.swap(__y);
+  }
+
+  namespace pmr {
+
+    /// @brief `btree_set` drawing its nodes from a `memory_resource`.
+    template <typename Key, typename Compare = std::less<Key>>
+    using btree_set = ft::btree_set<Key, Compare, polymorphic_allocator<Key>>;
+
+  } // namespace pmr
+
+} // namespace ft
+
+#endif // __FT_BTREE_SET__
@@ -0,0 +1,495 @@
+#ifndef   __FT_FLAT_SET__
+# define  __FT_FLAT_SET__
+
+# include <algorithm>   // For std::stable_sort
+# include <cstddef>     // For std::size_t, std::ptrdiff_t
+# include <functional>  // For std::less
+# include <iterator>    // For std::make_move_iterator, std::forward_iterator_tag, std::random_access_iterator_tag
+# include <type_traits> // For std::conditional_t, std::is_nothrow_swappable
+# include <utility>     // For std::move, std::forward
+# include <vector>      // For std::vector
+
+# include "../algorithm/algorithm.h"          // For ft::lexicographical_compare
+# include "../algorithm/sorted_search.h"      // For sorted_lower_bound, sorted_upper_bound, sorted_unique_t
+# include "../iterator/iterator_base_types.h" // For iterator_category_t, iterator tags
+# include "../iterator/reverse_iterator.h"    // For ft::reverse_iterator
+# include "../tree/rb_tree_key_compare.h"     // For rb_tree_key_compare, has_is_transparent_t
+# include "../utility/pair.h"                 // For ft::pair
+
+namespace ft {
+
+  /// @brief Ordered associative container of unique keys, kept in a sorted contiguous array.
+  /// @details The set counterpart of `flat_map`. The iterators are plain pointers to const
+  /// keys, so `ft::iterator_traits` classifies them as random access and `ft::distance` and
+  /// `ft::advance` run in O(1).
+  ///
+  /// Any insertion or erasure invalidates all iterators and references.
+  ///
+  /// @tparam KeyContainer A contiguous sequence container of `Key`, such as `std::vector<Key>`.
+  template <
+    typename Key,
+    typename Compare      = std::less<Key>,
+    typename KeyContainer = std::vector<Key>
+  > class flat_set
+  {
+    public:
+      using key_type               = Key;                                   ///< The type of the keys.
+      using value_type             = Key;                                   ///< The type of the stored elements.
+      using key_compare            = Compare;                               ///< The key comparison function type.
+      using value_compare          = Compare;                               ///< The element comparison function type.
+      using pointer                = const Key*;                            ///< Pointer type to the element.
+      using const_pointer          = const Key*;                            ///< Const pointer type to the element.
+      using reference              = const Key&;                            ///< Reference type to the element.
+      using const_reference        = const Key&;                            ///< Const reference type to the element.
+      using size_type              = std::size_t;                           ///< Unsigned integer type for sizes.
+      using difference_type        = std::ptrdiff_t;                        ///< Signed integer type for distances.
+      using iterator               = const Key*;                            ///< Constant random-access iterator.
+      using const_iterator         = const Key*;                            ///< Constant random-access iterator.
+      using reverse_iterator       = ft::reverse_iterator<const_iterator>;  ///< Constant reverse iterator.
+      using const_reverse_iterator = ft::reverse_iterator<const_iterator>;  ///< Constant reverse iterator.
+      using container_type         = KeyContainer;                          ///< The container of the keys.
+
+    private:
+      /// @brief The comparator (empty-base optimized) and the container.
+      struct flat_set_impl : public rb_tree_key_compare<key_compare>
+      {
+        container_type m_keys;
+
+        flat_set_impl() = default;
+
+        flat_set_impl(const key_compare& __comp)
+          : rb_tree_key_compare<key_compare>{ __comp }, m_keys{ } { }
+
+        flat_set_impl(const key_compare& __comp, container_type&& __keys)
+          : rb_tree_key_compare<key_compare>{ __comp }, m_keys{ std::move(__keys) } { }
+      };
+
+      flat_set_impl m_impl; ///< The comparator and the keys.
+
+    public:
+      /// @brief Default constructor.
+      flat_set() = default;
+
+      /// @brief Constructor with a comparator.
+      /// @param __comp The key comparison function.
+      explicit
+      flat_set(const Compare& __comp)
+        : m_impl{ __comp } { }
+
+      /// @brief Constructor adopting a container of keys.
+      /// @param __keys The keys, in any order. They are sorted and, of equal keys, the first is kept.
+      explicit
+      flat_set(container_type __keys, const Compare& __comp = Compare())
+        : m_impl{ __comp }
+      {
+        __sort_and_merge(__keys);
+      }
+
+      /// @brief Constructor adopting a container that is already sorted and unique.
+      /// @details The container is moved in as is, in O(1).
+      flat_set(sorted_unique_t, container_type __keys, const Compare& __comp = Compare())
+        : m_impl{ __comp, std::move(__keys) } { }
+
+      /// @brief Range constructor.
+      /// @param __first The beginning of the range to insert.
+      /// @param __last The end of the range to insert.
+      /// @details The range is sorted once and stored in O(n log n).
+      template <typename _InputIterator>
+      flat_set(_InputIterator __first, _InputIterator __last, const Compare& __comp = Compare())
+        : m_impl{ __comp }
+      {
+        insert(__first, __last);
+      }
+
+      /// @brief Range constructor for a range that is already sorted and unique.
+      template <typename _InputIterator>
+      flat_set(sorted_unique_t, _InputIterator __first, _InputIterator __last, const Compare& __comp = Compare())
+        : m_impl{ __comp }
+      {
+        insert_sorted_range(__first, __last);
+      }
+
+      flat_set(const flat_set&) = default;
+      flat_set(flat_set&&) = default;
+      ~flat_set() = default;
+
+      flat_set&
+      operator=(const flat_set& __x)
+      {
+        if ( this != &__x ) {
+          m_impl.__key_compare() = __x.m_impl.__key_compare();
+          m_impl.m_keys          = __x.m_impl.m_keys;
+        }
+        return *this;
+      }
+
+      flat_set&
+      operator=(flat_set&& __x)
+      {
+        m_impl.__key_compare() = std::move(__x.m_impl.__key_compare());
+        m_impl.m_keys          = std::move(__x.m_impl.m_keys);
+        return *this;
+      }
+
+    public:
+      const_iterator         begin()   const noexcept { return m_impl.m_keys.data(); }
+      const_iterator         end()     const noexcept { return m_impl.m_keys.data() + size(); }
+      const_reverse_iterator rbegin()  const noexcept { return const_reverse_iterator(end()); }
+      const_reverse_iterator rend()    const noexcept { return const_reverse_iterator(begin()); }
+
+    public:
+      bool      empty()    const noexcept { return m_impl.m_keys.empty(); }
+      size_type size()     const noexcept { return m_impl.m_keys.size(); }
+      size_type max_size() const noexcept { return m_impl.m_keys.max_size(); }
+
+      /// @brief Reserve room for __n elements.
+      void
+      reserve(size_type __n) { m_impl.m_keys.reserve(__n); }
+
+    public:
+      /// @brief Insert a key if it is not present yet.
+      /// @return An iterator to the element with that key, and whether insertion took place.
+      pair<iterator, bool>
+      insert(const value_type& __x) { return __insert_unique(__x); }
+
+      pair<iterator, bool>
+      insert(value_type&& __x) { return __insert_unique(std::move(__x)); }
+
+      /// @brief Insert a key, using __pos as a hint for where it goes.
+      /// @return An iterator to the element with that key.
+      /// @details The search is skipped when __x belongs right before __pos.
+      iterator
+      insert(const_iterator __pos, const value_type& __x) { return __insert_unique(__pos, __x); }
+
+      iterator
+      insert(const_iterator __pos, value_type&& __x) { return __insert_unique(__pos, std::move(__x)); }
+
+      /// @brief Insert every key of a range that is not present yet.
+      /// @details The range is buffered, stably sorted and merged in, in O(m log m + n + m).
+      template <typename _InputIterator>
+      void
+      insert(_InputIterator __first, _InputIterator __last)
+      {
+        container_type __buf;
+
+        for ( ; __first != __last; ++__first )
+          __buf.push_back(*__first);
+        __sort_and_merge(__buf);
+      }
+
+      /// @brief Merge a sorted range of keys into the set in O(n + m).
+      /// @details Keys already present, or repeating an earlier key of the range, are
+      /// skipped. The new keys are gathered aside first, then merged with the current ones
+      /// into a new container that is swapped in. The current keys are only moved when
+      /// nothing after that can throw, and copied otherwise, so the set is left unchanged if
+      /// an exception is thrown, unless its keys can neither be copied nor moved without
+      /// throwing.
+      template <typename _InputIterator>
+      void
+      insert_sorted_range(_InputIterator __first, _InputIterator __last)
+      {
+        container_type& __keys = m_impl.m_keys;
+        container_type  __add;
+        size_type       __i = 0;
+
+        __add.reserve(__size_hint(__first, __last));
+        for ( ; __first != __last; ++__first ) {
+          auto&& __x = *__first;
+
+          while ( __i < __keys.size() && __key_comp()(__keys[__i], __x) ) ++__i;
+          if ( __i < __keys.size() && !__key_comp()(__x, __keys[__i]) ) continue;
+          if ( !__add.empty() && !__key_comp()(__add.back(), __x) ) continue;
+          __add.push_back(std::forward<decltype(__x)>(__x));
+        }
+        if ( __add.empty() ) return;
+
+        container_type __out;
+        size_type      __j = 0;
+
+        __out.reserve(__keys.size() + __add.size());
+        for ( __i = 0; __i < __keys.size() || __j < __add.size(); ) {
+          if ( __j == __add.size() || ( __i < __keys.size() && __key_comp()(__keys[__i], __add[__j]) ) )
+            __out.push_back(__take_current(__keys[__i++]));
+          else
+            __out.push_back(std::move(__add[__j++]));
+        }
+        __keys.swap(__out);
+      }
+
+      /// @brief Construct a key in place if it is not present yet.
+      template <typename... _Args>
+      pair<iterator, bool>
+      emplace(_Args&&... __args) { return __insert_unique(value_type(std::forward<_Args>(__args)...)); }
+
+      /// @brief Construct a key in place near a hint if it is not present yet.
+      template <typename... _Args>
+      iterator
+      emplace_hint(const_iterator __pos, _Args&&... __args)
+      {
+        return __insert_unique(__pos, value_type(std::forward<_Args>(__args)...));
+      }
+
+      iterator
+      erase(const_iterator __position) { return erase(__position, __position + 1); }
+
+      size_type
+      erase(const key_type& __k)
+      {
+        const_iterator __i = find(__k);
+
+        if ( __i == end() ) return 0;
+        erase(__i);
+        return 1;
+      }
+
+      iterator
+      erase(const_iterator __first, const_iterator __last)
+      {
+        const difference_type __f = __first - begin();
+
+        m_impl.m_keys.erase(m_impl.m_keys.begin() + __f, m_impl.m_keys.begin() + ( __last - begin() ));
+        return begin() + __f;
+      }
+
+      void
+      swap(flat_set& __x) noexcept(std::is_nothrow_swappable<Compare>::value)
+      {
+        std::swap(m_impl.__key_compare(), __x.m_impl.__key_compare());
+        m_impl.m_keys.swap(__x.m_impl.m_keys);
+      }
+
+      void
+      clear() noexcept { m_impl.m_keys.clear(); }
+
+      /// @brief Move the underlying container out, leaving the set empty.
+      container_type
+      extract() &&
+      {
+        container_type __keys = std::move(m_impl.m_keys);
+
+        clear();
+        return __keys;
+      }
+
+      /// @brief Replace the underlying container.
+      /// @param __keys The keys, sorted by `key_comp()` and without duplicates.
+      void
+      replace(container_type&& __keys) { m_impl.m_keys = std::move(__keys); }
+
+    public:
+      key_compare
+      key_comp() const { return m_impl.__key_compare(); }
+
+      value_compare
+      value_comp() const { return m_impl.__key_compare(); }
+
+    public:
+      const_iterator
+      find(const key_type& __k) const { return begin() + __find_index(__k); }
+
+      size_type
+      count(const key_type& __k) const { return __find_index(__k) != size() ? 1 : 0; }
+
+      const_iterator
+      lower_bound(const key_type& __k) const { return begin() + __lower_index(__k); }
+
+      const_iterator
+      upper_bound(const key_type& __k) const { return begin() + __upper_index(__k); }
+
+      pair<const_iterator, const_iterator>
+      equal_range(const key_type& __k) const
+      {
+        const size_type __i = __lower_index(__k);
+
+        return pair<const_iterator, const_iterator>(begin() + __i, begin() + __i + __matches(__i, __k));
+      }
+
+    public:
+      /// @brief Heterogeneous lookup, available when the comparator is transparent.
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      const_iterator
+      find(const _Kt& __x) const { return begin() + __find_index(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      size_type
+      count(const _Kt& __x) const { return __upper_index(__x) - __lower_index(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      const_iterator
+      lower_bound(const _Kt& __x) const { return begin() + __lower_index(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      const_iterator
+      upper_bound(const _Kt& __x) const { return begin() + __upper_index(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      pair<const_iterator, const_iterator>
+      equal_range(const _Kt& __x) const { return pair<const_iterator, const_iterator>(lower_bound(__x), upper_bound(__x)); }
+
+    private:
+      const key_compare&
+      __key_comp() const noexcept { return m_impl.__key_compare(); }
+
+      template <typename _Kt>
+      size_type
+      __lower_index(const _Kt& __k) const { return sorted_lower_bound(m_impl.m_keys.data(), size(), __k, __key_comp()); }
+
+      template <typename _Kt>
+      size_type
+      __upper_index(const _Kt& __k) const { return sorted_upper_bound(m_impl.m_keys.data(), size(), __k, __key_comp()); }
+
+      /// @brief Whether the element at __i, the lower bound of __k, is equivalent to __k.
+      template <typename _Kt>
+      bool
+      __matches(size_type __i, const _Kt& __k) const
+      {
+        return __i != size() && !__key_comp()(__k, m_impl.m_keys[__i]);
+      }
+
+      /// @brief Index of the element equivalent to __k, or `size()`.
+      template <typename _Kt>
+      size_type
+      __find_index(const _Kt& __k) const
+      {
+        const size_type __i = __lower_index(__k);
+
+        return __matches(__i, __k) ? __i : size();
+      }
+
+      /// @brief Insert __x at its lower bound unless an equivalent key is there.
+      template <typename _Arg>
+      pair<iterator, bool>
+      __insert_unique(_Arg&& __x)
+      {
+        const size_type __i = __lower_index(__x);
+
+        if ( __matches(__i, __x) ) return pair<iterator, bool>(begin() + __i, false);
+        m_impl.m_keys.insert(m_impl.m_keys.begin() + static_cast<difference_type>(__i), std::forward<_Arg>(__x));
+        return pair<iterator, bool>(begin() + __i, true);
+      }
+
+      /// @brief Insert __x, skipping the search if it belongs right before __pos.
+      template <typename _Arg>
+      iterator
+      __insert_unique(const_iterator __pos, _Arg&& __x)
+      {
+        const size_type  __h = static_cast<size_type>(__pos - begin());
+        const key_type*  __k = begin();
+
+        if ( ( __h == 0 || __key_comp()(__k[__h - 1], __x) ) && ( __h == size() || __key_comp()(__x, __k[__h]) ) ) {
+          m_impl.m_keys.insert(m_impl.m_keys.begin() + static_cast<difference_type>(__h), std::forward<_Arg>(__x));
+          return begin() + __h;
+        }
+        return __insert_unique(std::forward<_Arg>(__x)).first;
+      }
+
+      /// @brief Stably sort a buffer of new keys and merge it in with `insert_sorted_range`.
+      void
+      __sort_and_merge(container_type& __buf)
+      {
+        std::stable_sort(__buf.begin(), __buf.end(), __key_comp());
+        insert_sorted_range(std::make_move_iterator(__buf.begin()), std::make_move_iterator(__buf.end()));
+      }
+
+      /// @brief Whether a merge may move the current keys: moving them cannot throw, or they
+      /// cannot be copied anyway.
+      static constexpr bool __move_current =
+        std::is_nothrow_move_constructible<key_type>::value || !std::is_copy_constructible<key_type>::value;
+
+      /// @brief A current key to merge, as an rvalue if `__move_current`, as a const lvalue otherwise.
+      static std::conditional_t<__move_current, key_type&&, const key_type&>
+      __take_current(key_type& __x) noexcept { return std::move(__x); }
+
+      /// @brief The length of a multi-pass range, or 0 for a single-pass one, to reserve for.
+      template <typename _Iter>
+      static size_type
+      __size_hint(_Iter __first, _Iter __last)
+      {
+        using _Cat = iterator_category_t<_Iter>;
+
+        return __size_hint(__first, __last,
+                           std::integral_constant<bool, std::is_convertible<_Cat, random_access_iterator_tag>::value ||
+                                                        std::is_convertible<_Cat, std::random_access_iterator_tag>::value>(),
+                           std::integral_constant<bool, std::is_convertible<_Cat, forward_iterator_tag>::value ||
+                                                        std::is_convertible<_Cat, std::forward_iterator_tag>::value>());
+      }
+
+      template <typename _Iter>
+      static size_type
+      __size_hint(_Iter __first, _Iter __last, std::true_type, std::true_type) { return static_cast<size_type>(__last - __first); }
+
+      template <typename _Iter>
+      static size_type
+      __size_hint(_Iter __first, _Iter __last, std::false_type, std::true_type)
+      {
+        size_type __n = 0;
+
+        for ( ; __first != __last; ++__first ) ++__n;
+        return __n;
+      }
+
+      template <typename _Iter>
+      static size_type
+      __size_hint(_Iter, _Iter, std::false_type, std::false_type) { return 0; }
+
+    public:
+      template <typename K1, typename C1, typename KC1>
+      friend bool operator==(const flat_set<K1, C1, KC1>&, const flat_set<K1, C1, KC1>&);
+
+      template <typename K1, typename C1, typename KC1>
+      friend bool operator<(const flat_set<K1, C1, KC1>&, const flat_set<K1, C1, KC1>&);
+  };
+
+  template <typename Key, typename Compare, typename KC>
+  inline bool
+  operator==(const flat_set<Key, Compare, KC>& __x, const flat_set<Key, Compare, KC>& __y)
+  {
+    return __x.m_impl.m_keys == __y.m_impl.m_keys;
+  }
+
+  template <typename Key, typename Compare, typename KC>
+  inline bool
+  operator<(const flat_set<Key, Compare, KC>& __x, const flat_set<Key, Compare, KC>& __y)
+  {
+    return ft::lexicographical_compare(__x.begin(), __x.end(), __y.begin(), __y.end());
+  }
+
+  template <typename Key, typename Compare, typename KC>
+  inline bool
+  operator!=(const flat_set<Key, Compare, KC>& __x, const flat_set<Key, Compare, KC>& __y)
+  {
+    return !(__x == __y);
+  }
+
+  template <typename Key, typename Compare, typename KC>
+  inline bool
+  operator>(const flat_set<Key, Compare, KC>& __x, const flat_set<Key, Compare, KC>& __y)
+  {
+    return __y < __x;
+  }
+
+  template <typename Key, typename Compare, typename KC>
+  inline bool
+  operator<=(const flat_set<Key, Compare, KC>& __x, const flat_set<Key, Compare, KC>& __y)
+  {
+    return !(__y < __x);
+  }
+
+  template <typename Key, typename Compare, typename KC>
+  inline bool
+  operator>=(const flat_set<Key, Compare, KC>& __x, const flat_set<Key, Compare, KC>& __y)
+  {
+    return !(__x < __y);
+  }
+
+  /// @brief Swap the contents of two flat sets.
+  template <typename Key, typename Compare, typename KC>
+  inline void
+  swap(flat_set<Key, Compare, KC>& __x, flat_set<Key, Compare, KC>& __y) noexcept(noexcept(__x.swap(__y)))
+  {
+    __x.swap(__y);
+  }
+
+} // namespace ft
+
+#endif // __FT_FLAT_SET__
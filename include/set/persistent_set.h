@@ -0,0 +1,235 @@
+#ifndef   __FT_PERSISTENT_SET__
+# define  __FT_PERSISTENT_SET__
+
+# include <functional> // For std::less
+# include <memory>     // For std::allocator
+# include <utility>    // For std::move, std::forward
+
+# include "../tree/persistent_rb_tree.h" // For persistent_rb_tree
+# include "../utility/pair.h"            // For ft::pair
+# include "../utility/functional.h"      // For ft::identity
+
+namespace ft {
+
+  /// @brief Ordered set of unique keys with O(1) copies and snapshots.
+  /// @details See `persistent_map`: copies and snapshots share every node, and each update
+  /// copies only the O(log n) nodes it changes, leaving the other versions intact.
+  template <
+    typename Key,
+    typename Compare = std::less<Key>,
+    typename Alloc   = std::allocator<Key>
+  > class persistent_set
+  {
+    public:
+      using key_type       = Key;     ///< The type of the keys.
+      using value_type     = Key;     ///< The type of the stored elements.
+      using key_compare    = Compare; ///< The key comparison function type.
+      using value_compare  = Compare; ///< The element comparison function type.
+      using allocator_type = Alloc;   ///< The allocator type.
+
+    private:
+      using rep_type = persistent_rb_tree<key_type, value_type, identity<value_type>, key_compare, allocator_type>;
+
+      rep_type m_tree; ///< The persistent tree holding the elements.
+
+    public:
+      using pointer                = typename rep_type::pointer;                ///< Pointer type to the element.
+      using const_pointer          = typename rep_type::const_pointer;          ///< Const pointer type to the element.
+      using reference              = typename rep_type::reference;              ///< Reference type to the element.
+      using const_reference        = typename rep_type::const_reference;        ///< Const reference type to the element.
+      using iterator               = typename rep_type::const_iterator;         ///< Constant bidirectional iterator.
+      using const_iterator         = typename rep_type::const_iterator;         ///< Constant bidirectional iterator.
+      using reverse_iterator       = typename rep_type::const_reverse_iterator; ///< Constant reverse iterator.
+      using const_reverse_iterator = typename rep_type::const_reverse_iterator; ///< Constant reverse iterator.
+      using size_type              = typename rep_type::size_type;              ///< Unsigned integer type for sizes.
+      using difference_type        = typename rep_type::difference_type;        ///< Signed integer type for distances.
+
+    public:
+      /// @brief Default constructor.
+      persistent_set() = default;
+
+      /// @brief Constructor with a comparator and an allocator.
+      /// @param __comp The key comparison function.
+      /// @param __a The allocator.
+      explicit
+      persistent_set(const Compare& __comp, const allocator_type& __a = allocator_type())
+        : m_tree{ __comp, __a } { }
+
+      /// @brief Range constructor.
+      /// @param __first The beginning of the range to insert.
+      /// @param __last The end of the range to insert.
+      template <typename _InputIterator>
+      persistent_set(_InputIterator __first, _InputIterator __last,
+                     const Compare& __comp = Compare(), const allocator_type& __a = allocator_type())
+        : m_tree{ __comp, __a }
+      {
+        m_tree.__insert_range_unique(__first, __last);
+      }
+
+      /// @brief Copy constructor. O(1): the copy shares every node with __x.
+      persistent_set(const persistent_set&) = default;
+      persistent_set(persistent_set&&) = default;
+      ~persistent_set() = default;
+
+      persistent_set& operator=(const persistent_set&) = default;
+      persistent_set& operator=(persistent_set&&) = default;
+
+      /// @brief Take a snapshot of the set, in O(1).
+      /// @return A set that later updates of this one leave unchanged, and vice versa.
+      persistent_set
+      snapshot() const { return *this; }
+
+      allocator_type
+      get_allocator() const noexcept { return m_tree.get_allocator(); }
+
+    public:
+      iterator               begin()   const noexcept { return m_tree.begin(); }
+      iterator               end()     const noexcept { return m_tree.end(); }
+      reverse_iterator       rbegin()  const noexcept { return m_tree.rbegin(); }
+      reverse_iterator       rend()    const noexcept { return m_tree.rend(); }
+
+    public:
+      bool      empty()    const noexcept { return m_tree.empty(); }
+      size_type size()     const noexcept { return m_tree.size(); }
+      size_type max_size() const noexcept { return m_tree.max_size(); }
+
+    public:
+      /// @brief Insert a key if it is not present yet.
+      /// @return An iterator to the element with that key, and whether insertion took place.
+      pair<iterator, bool>
+      insert(const value_type& __x) { return m_tree.__insert_unique(__x); }
+
+      pair<iterator, bool>
+      insert(value_type&& __x) { return m_tree.__insert_unique(std::move(__x)); }
+
+      /// @brief Insert every key of a range that is not present yet.
+      template <typename _InputIterator>
+      void
+      insert(_InputIterator __first, _InputIterator __last) { m_tree.__insert_range_unique(__first, __last); }
+
+      /// @brief Construct a key in place if it is not present yet.
+      /// @param __args The arguments forwarded to the constructor of `value_type`.
+      /// @return An iterator to the element with that key, and whether insertion took place.
+      template <typename... _Args>
+      pair<iterator, bool>
+      emplace(_Args&&... __args) { return m_tree.__emplace_unique(std::forward<_Args>(__args)...); }
+
+      iterator
+      erase(const_iterator __position) { return m_tree.erase(__position); }
+
+      size_type
+      erase(const key_type& __k) { return m_tree.erase(__k); }
+
+      void
+      swap(persistent_set& __x) noexcept(noexcept(m_tree.swap(__x.m_tree))) { m_tree.swap(__x.m_tree); }
+
+      void
+      clear() noexcept { m_tree.clear(); }
+
+    public:
+      key_compare
+      key_comp() const { return m_tree.key_comp(); }
+
+      value_compare
+      value_comp() const { return m_tree.key_comp(); }
+
+    public:
+      iterator
+      find(const key_type& __k) const { return m_tree.find(__k); }
+
+      size_type
+      count(const key_type& __k) const { return m_tree.count(__k); }
+
+      iterator
+      lower_bound(const key_type& __k) const { return m_tree.lower_bound(__k); }
+
+      iterator
+      upper_bound(const key_type& __k) const { return m_tree.upper_bound(__k); }
+
+      pair<iterator, iterator>
+      equal_range(const key_type& __k) const { return m_tree.equal_range(__k); }
+
+    public:
+      /// @brief Heterogeneous lookup, available when the comparator is transparent.
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      iterator
+      find(const _Kt& __x) const { return m_tree.find(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      size_type
+      count(const _Kt& __x) const { return m_tree.count(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      iterator
+      lower_bound(const _Kt& __x) const { return m_tree.lower_bound(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      iterator
+      upper_bound(const _Kt& __x) const { return m_tree.upper_bound(__x); }
+
+      template <typename _Kt, typename = has_is_transparent_t<Compare, _Kt>>
+      pair<iterator, iterator>
+      equal_range(const _Kt& __x) const { return m_tree.equal_range(__x); }
+
+    public:
+      template <typename K1, typename C1, typename A1>
+      friend bool operator==(const persistent_set<K1, C1, A1>&, const persistent_set<K1, C1, A1>&);
+
+      template <typename K1, typename C1, typename A1>
+      friend bool operator<(const persistent_set<K1, C1, A1>&, const persistent_set<K1, C1, A1>&);
+  };
+
+  template <typename Key, typename Compare, typename Alloc>
+  inline bool
+  operator==(const persistent_set<Key, Compare, Alloc>& __x, const persistent_set<Key, Compare, Alloc>& __y)
+  {
+    return __x.m_tree == __y.m_tree;
+  }
+
+  template <typename Key, typename Compare, typename Alloc>
+  inline bool
+  operator<(const persistent_set<Key, Compare, Alloc>& __x, const persistent_set<Key, Compare, Alloc>& __y)
+  {
+    return __x.m_tree < __y.m_tree;
+  }
+
+  template <typename Key, typename Compare, typename Alloc>
+  inline bool
+  operator!=(const persistent_set<Key, Compare, Alloc>& __x, const persistent_set<Key, Compare, Alloc>& __y)
+  {
+    return !(__x == __y);
+  }
+
+  template <typename Key, typename Compare, typename Alloc>
+  inline bool
+  operator>(const persistent_set<Key, Compare, Alloc>& __x, const persistent_set<Key, Compare, Alloc>& __y)
+  {
+    return __y < __x;
+  }
+
+  template <typename Key, typename Compare, typename Alloc>
+  inline bool
+  operator<=(const persistent_set<Key, Compare, Alloc>& __x, const persistent_set<Key, Compare, Alloc>& __y)
+  {
+    return !(__y < __x);
+  }
+
+  template <typename Key, typename Compare, typename Alloc>
+  inline bool
+  operator>=(const persistent_set<Key, Compare, Alloc>& __x, const persistent_set<Key, Compare, Alloc>& __y)
+  {
+    return !(__x < __y);
+  }
+
+  /// @brief Swap the contents of two persistent sets.
+  template <typename Key, typename Compare, typename Alloc>
+  inline void
+  swap(persistent_set<Key, Compare, Alloc>& __x, persistent_set<Key, Compare, Alloc>& __y)
+    noexcept(noexcept(__x.swap(__y)))
+  {
+    __x.swap(__y);
+  }
+
+} // namespace ft
+
+#endif // __FT_PERSISTENT_SET__
@@ -0,0 +1,262 @@
+#ifndef   __FT_UNORDERED_SET__
+# define  __FT_UNORDERED_SET__
+
+# include <cstddef>     // For std::size_t
+# include <functional>  // For std::hash, std::equal_to
+# include <memory>      // For std::allocator
+# include <utility>     // For std::move, std::forward
+
+# include "../hash/hash_table.h"        // For hash_table, has_transparent_hash_t
+# include "../utility/pair.h"           // For ft::pair
+# include "../utility/functional.h"     // For ft::identity
+# include "../memory/memory_resource.h" // For polymorphic_allocator
+
+namespace ft {
+
+  /// @brief Unordered associative container of unique keys, in a Swiss table.
+  /// @details Lookups, insertions and erasures take O(1) on average. The keys live in one
+  /// flat array, so any insertion may move all of them and invalidate every iterator,
+  /// pointer and reference; `node_unordered_set` keeps them in place instead.
+  /// Both iterator types are constant, as a key must not change while in the set.
+  ///
+  /// @tparam NodeStable Whether every key is allocated on its own and never moves.
+  template <
+    typename Key,
+    typename Hash     = std::hash<Key>,
+    typename KeyEqual = std::equal_to<Key>,
+    typename Alloc    = std::allocator<Key>,
+    bool NodeStable   = false
+  > class unordered_set
+  {
+    public:
+      using key_type       = Key;      ///< The type of the keys.
+      using value_type     = Key;      ///< The type of the stored elements.
+      using hasher         = Hash;     ///< The hash function type.
+      using key_equal      = KeyEqual; ///< The key equality type.
+      using allocator_type = Alloc;    ///< The allocator type.
+
+    private:
+      using rep_type = hash_table<key_type, value_type, identity<value_type>, hasher, key_equal, allocator_type, NodeStable>;
+
+      rep_type m_table; ///< The hash table holding the elements.
+
+    public:
+      using pointer         = typename rep_type::const_pointer;   ///< Pointer type to the element.
+      using const_pointer   = typename rep_type::const_pointer;   ///< Const pointer type to the element.
+      using reference       = typename rep_type::const_reference; ///< Reference type to the element.
+      using const_reference = typename rep_type::const_reference; ///< Const reference type to the element.
+      using iterator        = typename rep_type::const_iterator;  ///< Constant forward iterator.
+      using const_iterator  = typename rep_type::const_iterator;  ///< Constant forward iterator.
+      using size_type       = typename rep_type::size_type;       ///< Unsigned integer type for sizes.
+      using difference_type = typename rep_type::difference_type; ///< Signed integer type for distances.
+
+    public:
+      /// @brief Default constructor. Allocates nothing.
+      unordered_set() = default;
+
+      /// @brief Constructor with an initial bucket count, the function objects and an allocator.
+      /// @param __n The number of slots to allocate at once.
+      explicit
+      unordered_set(size_type __n, const Hash& __h = Hash(), const KeyEqual& __e = KeyEqual(),
+                    const allocator_type& __a = allocator_type())
+        : m_table{ __n, __h, __e, __a } { }
+
+      /// @brief Constructor with an allocator, such as a `polymorphic_allocator` on a resource.
+      /// @param __a The allocator.
+      explicit
+      unordered_set(const allocator_type& __a)
+        : m_table{ 0, Hash(), KeyEqual(), __a } { }
+
+      /// @brief Range constructor.
+      /// @param __first The beginning of the range to insert.
+      /// @param __last The end of the range to insert.
+      template <typename _InputIterator>
+      unordered_set(_InputIterator __first, _InputIterator __last, size_type __n = 0,
+                    const Hash& __h = Hash(), const KeyEqual& __e = KeyEqual(),
+                    const allocator_type& __a = allocator_type())
+        : m_table{ __n, __h, __e, __a }
+      {
+        m_table.__insert_range_unique(__first, __last);
+      }
+
+      unordered_set(const unordered_set&) = default;
+      unordered_set(unordered_set&&) = default;
+      ~unordered_set() = default;
+
+      unordered_set& operator=(const unordered_set&) = default;
+      unordered_set& operator=(unordered_set&&) = default;
+
+      allocator_type
+      get_allocator() const noexcept { return m_table.get_allocator(); }
+
+    public:
+      iterator begin() const noexcept { return m_table.begin(); }
+      iterator end()   const noexcept { return m_table.end(); }
+
+    public:
+      bool      empty()    const noexcept { return m_table.empty(); }
+      size_type size()     const noexcept { return m_table.size(); }
+      size_type max_size() const noexcept { return m_table.max_size(); }
+
+    public:
+      /// @brief Insert a key if it is not present yet.
+      /// @return An iterator to the equal key in the set, and whether insertion took place.
+      pair<iterator, bool>
+      insert(const value_type& __x)
+      {
+        pair<typename rep_type::iterator, bool> __r = m_table.__insert_unique(__x);
+        return pair<iterator, bool>(__r.first, __r.second);
+      }
+
+      pair<iterator, bool>
+      insert(value_type&& __x)
+      {
+        pair<typename rep_type::iterator, bool> __r = m_table.__insert_unique(std::move(__x));
+        return pair<iterator, bool>(__r.first, __r.second);
+      }
+
+      /// @brief Insert a key; the hint is accepted for interface compatibility and unused.
+      iterator
+      insert(const_iterator, const value_type& __x) { return insert(__x).first; }
+
+      iterator
+      insert(const_iterator, value_type&& __x) { return insert(std::move(__x)).first; }
+
+      /// @brief Insert every key of a range that is not present yet.
+      template <typename _InputIterator>
+      void
+      insert(_InputIterator __first, _InputIterator __last) { m_table.__insert_range_unique(__first, __last); }
+
+      /// @brief Construct a key in place if it is not present yet.
+      /// @return An iterator to the equal key in the set, and whether insertion took place.
+      template <typename... _Args>
+      pair<iterator, bool>
+      emplace(_Args&&... __args)
+      {
+        pair<typename rep_type::iterator, bool> __r = m_table.__emplace_unique(std::forward<_Args>(__args)...);
+        return pair<iterator, bool>(__r.first, __r.second);
+      }
+
+      /// @brief Like `emplace`; the hint is unused.
+      template <typename... _Args>
+      iterator
+      emplace_hint(const_iterator, _Args&&... __args) { return emplace(std::forward<_Args>(__args)...).first; }
+
+      iterator
+      erase(const_iterator __position) { return m_table.erase(__position); }
+
+      size_type
+      erase(const key_type& __k) { return m_table.erase(__k); }
+
+      iterator
+      erase(const_iterator __first, const_iterator __last) { return m_table.erase(__first, __last); }
+
+      void
+      swap(unordered_set& __x) noexcept(noexcept(m_table.swap(__x.m_table))) { m_table.swap(__x.m_table); }
+
+      void
+      clear() noexcept { m_table.clear(); }
+
+    public:
+      hasher
+      hash_function() const { return m_table.hash_function(); }
+
+      key_equal
+      key_eq() const { return m_table.key_eq(); }
+
+    public:
+      iterator
+      find(const key_type& __k) const { return m_table.find(__k); }
+
+      size_type
+      count(const key_type& __k) const { return m_table.count(__k); }
+
+      pair<iterator, iterator>
+      equal_range(const key_type& __k) const { return m_table.equal_range(__k); }
+
+    public:
+      /// @brief Heterogeneous lookup, available when the hash and the key equality are transparent.
+      template <typename _Kt, typename = has_transparent_hash_t<Hash, KeyEqual, _Kt>>
+      iterator
+      find(const _Kt& __x) const { return m_table.find(__x); }
+
+      template <typename _Kt, typename = has_transparent_hash_t<Hash, KeyEqual, _Kt>>
+      size_type
+      count(const _Kt& __x) const { return m_table.count(__x); }
+
+      template <typename _Kt, typename = has_transparent_hash_t<Hash, KeyEqual, _Kt>>
+      pair<iterator, iterator>
+      equal_range(const _Kt& __x) const { return m_table.equal_range(__x); }
+
+    public:
+      /// @brief Get the number of slots.
+      size_type
+      bucket_count() const noexcept { return m_table.bucket_count(); }
+
+      float
+      load_factor() const noexcept { return m_table.load_factor(); }
+
+      /// @brief Get the load factor at which the table grows, fixed at 7/8.
+      float
+      max_load_factor() const noexcept { return m_table.max_load_factor(); }
+
+      /// @brief Make room for __n keys, so that inserting them does not rehash.
+      void
+      reserve(size_type __n) { m_table.reserve(__n); }
+
+      /// @brief Rebuild the table with at least __n slots; `rehash(0)` shrinks it to fit.
+      void
+      rehash(size_type __n) { m_table.rehash(__n); }
+
+    public:
+      template <typename K1, typename H1, typename E1, typename A1, bool N1>
+      friend bool operator==(const unordered_set<K1, H1, E1, A1, N1>&, const unordered_set<K1, H1, E1, A1, N1>&);
+  };
+
+  template <typename Key, typename Hash, typename KeyEqual, typename Alloc, bool N>
+  inline bool
+  operator==(const unordered_set<Key, Hash, KeyEqual, Alloc, N>& __x, const unordered_set<Key, Hash, KeyEqual, Alloc, N>& __y)
+  {
+    return __x.m_table == __y.m_table;
+  }
+
+  template <typename Key, typename Hash, typename KeyEqual, typename Alloc, bool N>
+  inline bool
+  operator!=(const unordered_set<Key, Hash, KeyEqual, Alloc, N>& __x, const unordered_set<Key, Hash, KeyEqual, Alloc, N>& __y)
+  {
+    return !(__x == __y);
+  }
+
+  /// @brief Swap the contents of two unordered sets.
+  template <typename Key, typename Hash, typename KeyEqual, typename Alloc, bool N>
+  inline void
+  swap(unordered_set<Key, Hash, KeyEqual, Alloc, N>& __x, unordered_set<Key, Hash, KeyEqual, Alloc, N>& __y)
+    noexcept(noexcept(__x.swap(__y)))
+  {
+    __x.swap(__y);
+  }
+
+  /// @brief `unordered_set` whose keys are allocated one by one and never move.
+  /// @details Pointers and references to a key stay valid until it is erased.
+  template <
+    typename Key,
+    typename Hash     = std::hash<Key>,
+    typename KeyEqual = std::equal_to<Key>,
+    typename Alloc    = std::allocator<Key>
+  > using node_unordered_set = unordered_set<Key, Hash, KeyEqual, Alloc, true>;
+
+  namespace pmr {
+
+    /// @brief `unordered_set` drawing its slots from a `memory_resource`.
+    template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+    using unordered_set = ft::unordered_set<Key, Hash, KeyEqual, polymorphic_allocator<Key>>;
+
+    /// @brief `node_unordered_set` drawing its slots and keys from a `memory_resource`.
+    template <typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+    using node_unordered_set = ft::node_unordered_set<Key, Hash, KeyEqual, polymorphic_allocator<Key>>;
+
+  } // namespace pmr
+
+} // namespace ft
+
+#endif // __FT_UNORDERED_SET__
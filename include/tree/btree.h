@@ -0,0 +1,1020 @@
+#ifndef   __FT_BTREE__
+# define  __FT_BTREE__
+
+# include <cstddef>     // For std::size_t, std::ptrdiff_t
+# include <memory>      // For std::allocator, std::allocator_traits
+# include <new>         // For placement new
+# include <type_traits> // For std::true_type, std::false_type, std::integral_constant, std::enable_if_t, std::is_trivially_destructible
+# include <utility>     // For std::move, std::forward, std::swap
+
+# include "../iterator/iterator.h"             // For ft::reverse_iterator, ft::distance
+# include "../utility/pair.h"                  // For ft::pair
+# include "../algorithm/algorithm.h"           // For ft::equal, ft::lexicographical_compare
+# include "rb_tree_key_compare.h"              // For rb_tree_key_compare, is_transparent_compare
+# include "btree_node.h"                       // For btree_node, btree_internal_node
+# include "btree_iterator.h"                   // For btree_iterator, btree_const_iterator
+
+namespace ft {
+
+  /// @brief B-tree engine for ordered associative containers with unique keys.
+  /// @details An alternative to `rb_tree` for large or lookup-heavy containers. Each node
+  /// holds up to `node_slots` values in a contiguous array, so a lookup touches about
+  /// log_B(n) nodes instead of log_2(n), and scanning a node for the next value stays in
+  /// the same cache lines. In-node searches are branchless, see `btree_node::__lower_bound`.
+  ///
+  /// The interface mirrors the unique-key part of `rb_tree`, with the same value type and
+  /// iterator model, so `btree_map` and `btree_set` can stand in for `map` and `set`. The
+  /// differences follow from storing several values per node: every insertion and erasure
+  /// invalidates all iterators, and there are no node handles.
+  ///
+  /// Splits are biased towards the inserted position, so appending sorted input fills
+  /// nodes almost completely.
+  template <
+    typename _Key,
+    typename _Val,
+    typename _KeyOfValue,
+    typename _Compare,
+    typename _Alloc = std::allocator<_Val>,
+    std::size_t _TargetNodeSize = 256
+  > class btree
+  {
+    protected:
+      using leaf_node          = btree_node<_Val, _TargetNodeSize>;
+      using internal_node      = btree_internal_node<_Val, _TargetNodeSize>;
+      using leaf_allocator     = typename std::allocator_traits<_Alloc>::template rebind_alloc<leaf_node>;
+      using internal_allocator = typename std::allocator_traits<_Alloc>::template rebind_alloc<internal_node>;
+      using leaf_alloc_traits     = std::allocator_traits<leaf_allocator>;
+      using internal_alloc_traits = std::allocator_traits<internal_allocator>;
+      using value_alloc_traits    = std::allocator_traits<_Alloc>;
+
+      using node_ptr       = leaf_node*;
+      using const_node_ptr = const leaf_node*;
+
+    public:
+      using key_type        = _Key;             ///< The type of the keys.
+      using value_type      = _Val;             ///< The type of the stored values.
+      using pointer         = value_type*;      ///< Pointer type to the value.
+      using const_pointer   = const value_type*;///< Const pointer type to the value.
+      using reference       = value_type&;      ///< Reference type to the value.
+      using const_reference = const value_type&;///< Const reference type to the value.
+      using size_type       = std::size_t;      ///< Unsigned integer type for sizes.
+      using difference_type = std::ptrdiff_t;   ///< Signed integer type for distances.
+      using allocator_type  = _Alloc;           ///< The allocator type given by the user.
+
+      using iterator               = btree_iterator<leaf_node>;          ///< Bidirectional iterator.
+      using const_iterator         = btree_const_iterator<leaf_node>;    ///< Constant bidirectional iterator.
+      using reverse_iterator       = ft::reverse_iterator<iterator>;      ///< Reverse iterator.
+      using const_reverse_iterator = ft::reverse_iterator<const_iterator>;///< Constant reverse iterator.
+
+      static constexpr size_type node_slots = leaf_node::node_slots; ///< The maximum number of values per node.
+
+    private:
+      /// @brief The tree state: allocator, comparator, root, leftmost leaf and size.
+      /// @details Inheriting from the allocator lets stateless allocators take no space.
+      struct btree_impl
+        : public leaf_allocator,
+          public rb_tree_key_compare<_Compare>
+      {
+        node_ptr  m_root     = nullptr; ///< The root node, or nullptr when empty.
+        node_ptr  m_leftmost = nullptr; ///< The leftmost leaf, where `begin()` points.
+        size_type m_size     = 0;       ///< The number of values.
+
+        btree_impl()
+          : leaf_allocator{ }, rb_tree_key_compare<_Compare>{ } { }
+
+        btree_impl(const _Compare& __comp, const leaf_allocator& __a)
+          : leaf_allocator(__a), rb_tree_key_compare<_Compare>(__comp) { }
+
+        btree_impl(const btree_impl& __x)
+          : leaf_allocator(leaf_alloc_traits::select_on_container_copy_construction(__x)),
+            rb_tree_key_compare<_Compare>(__x.__key_compare()) { }
+
+        btree_impl(btree_impl&& __x) noexcept
+          : leaf_allocator(std::move(static_cast<leaf_allocator&>(__x))),
+            rb_tree_key_compare<_Compare>(std::move(static_cast<rb_tree_key_compare<_Compare>&>(__x))),
+            m_root{ __x.m_root }, m_leftmost{ __x.m_leftmost }, m_size{ __x.m_size }
+        {
+          __x.__reset();
+        }
+
+        void
+        __reset() noexcept
+        {
+          m_root     = nullptr;
+          m_leftmost = nullptr;
+          m_size     = 0;
+        }
+      };
+
+      btree_impl m_impl; ///< The allocator, comparator and root of the tree.
+
+    public:
+      /// @brief Default constructor.
+      btree() = default;
+
+      /// @brief Constructor with a comparator and an allocator.
+      /// @param __comp The key comparison function.
+      /// @param __a The allocator.
+      btree(const _Compare& __comp, const allocator_type& __a = allocator_type())
+        : m_impl(__comp, leaf_allocator(__a)) { }
+
+      /// @brief Copy constructor.
+      /// @param __x The tree to copy from.
+      btree(const btree& __x)
+        : m_impl(__x.m_impl)
+      {
+        __copy(__x);
+      }
+
+      /// @brief Move constructor.
+      /// @details Steals the nodes of __x, leaving it empty.
+      btree(btree&&) = default;
+
+      /// @brief Destructor.
+      ~btree() noexcept { __erase(m_impl.m_root); }
+
+      /// @brief Copy assignment operator.
+      /// @param __x The tree to copy from.
+      /// @return A reference to this tree.
+      btree&
+      operator=(const btree& __x)
+      {
+        if ( this == &__x ) {
+          return *this;
+        }
+        clear();
+        __alloc_on_copy(__x, typename leaf_alloc_traits::propagate_on_container_copy_assignment());
+        m_impl.__key_compare() = __x.m_impl.__key_compare();
+        __copy(__x);
+        return *this;
+      }
+
+      /// @brief Move assignment operator.
+      /// @param __x The tree to move from.
+      /// @return A reference to this tree.
+      /// @details Nodes are stolen when the allocators allow it; otherwise the values are moved one by one.
+      btree&
+      operator=(btree&& __x)
+        noexcept(leaf_alloc_traits::is_always_equal::value &&
+                 std::is_nothrow_move_assignable<_Compare>::value)
+      {
+        m_impl.__key_compare() = std::move(__x.m_impl.__key_compare());
+        __move_assign(__x, std::integral_constant<bool,
+                             leaf_alloc_traits::propagate_on_container_move_assignment::value ||
+                             leaf_alloc_traits::is_always_equal::value>());
+        return *this;
+      }
+
+    public:
+      /// @brief Get the key comparison function.
+      _Compare
+      key_comp() const { return m_impl.__key_compare(); }
+
+      /// @brief Get a copy of the allocator.
+      allocator_type
+      get_allocator() const noexcept { return allocator_type(__leaf_allocator()); }
+
+    public:
+      iterator
+      begin() noexcept { return iterator(m_impl.m_leftmost, 0); }
+
+      const_iterator
+      begin() const noexcept { return const_iterator(m_impl.m_leftmost, 0); }
+
+      iterator
+      end() noexcept { return iterator(m_impl.m_root, m_impl.m_root == nullptr ? 0 : m_impl.m_root->m_count); }
+
+      const_iterator
+      end() const noexcept { return const_iterator(m_impl.m_root, m_impl.m_root == nullptr ? 0 : m_impl.m_root->m_count); }
+
+      reverse_iterator
+      rbegin() noexcept { return reverse_iterator(end()); }
+
+      const_reverse_iterator
+      rbegin() const noexcept { return const_reverse_iterator(end()); }
+
+      reverse_iterator
+      rend() noexcept { return reverse_iterator(begin()); }
+
+      const_reverse_iterator
+      rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    public:
+      bool
+      empty() const noexcept { return m_impl.m_size == 0; }
+
+      size_type
+      size() const noexcept { return m_impl.m_size; }
+
+      size_type
+      max_size() const noexcept { return value_alloc_traits::max_size(_Alloc(__leaf_allocator())); }
+
+    public:
+      /// @brief Insert a value if no element with an equivalent key exists.
+      /// @param __v The value to insert.
+      /// @return An iterator to the element with the key of __v, and whether insertion took place.
+      pair<iterator, bool>
+      __insert_unique(const value_type& __v) { return __insert_unique_aux(_KeyOfValue()(__v), __v); }
+
+      pair<iterator, bool>
+      __insert_unique(value_type&& __v) { return __insert_unique_aux(_KeyOfValue()(__v), std::move(__v)); }
+
+      /// @brief Insert a value near a hint if no element with an equivalent key exists.
+      /// @param __pos A hint for the position of the new element.
+      /// @param __v The value to insert.
+      /// @return An iterator to the element with the key of __v.
+      /// @details The descent is skipped when __v belongs right before or right after __pos.
+      iterator
+      __insert_unique(const_iterator __pos, const value_type& __v)
+      {
+        return __insert_hint_unique_aux(__pos, _KeyOfValue()(__v), __v);
+      }
+
+      iterator
+      __insert_unique(const_iterator __pos, value_type&& __v)
+      {
+        return __insert_hint_unique_aux(__pos, _KeyOfValue()(__v), std::move(__v));
+      }
+
+      /// @brief Construct a value and insert it if its key is not present yet.
+      /// @param __args The arguments forwarded to the constructor of the value.
+      /// @return An iterator to the element with that key, and whether insertion took place.
+      /// @details Values live inside shared nodes, so the value is built first to learn its
+      /// key, then moved into its slot.
+      template <typename... _Args>
+      pair<iterator, bool>
+      __emplace_unique(_Args&&... __args)
+      {
+        value_type __v(std::forward<_Args>(__args)...);
+        return __insert_unique_aux(_KeyOfValue()(__v), std::move(__v));
+      }
+
+      /// @brief Construct a value and insert it near a hint if its key is not present yet.
+      /// @param __pos A hint for the position of the new element.
+      /// @return An iterator to the element with the key of the new value.
+      template <typename... _Args>
+      iterator
+      __emplace_hint_unique(const_iterator __pos, _Args&&... __args)
+      {
+        value_type __v(std::forward<_Args>(__args)...);
+        return __insert_hint_unique_aux(__pos, _KeyOfValue()(__v), std::move(__v));
+      }
+
+      /// @brief Construct a value in its slot only if no element has the key __k.
+      /// @param __k The key the new value will have.
+      /// @param __args The arguments forwarded to the constructor of the value.
+      /// @return An iterator to the element with key __k, and whether insertion took place.
+      /// @details Nothing is constructed, and no argument moved from, when the key exists.
+      template <typename... _Args>
+      pair<iterator, bool>
+      __try_emplace_unique(const key_type& __k, _Args&&... __args)
+      {
+        return __insert_unique_aux(__k, std::forward<_Args>(__args)...);
+      }
+
+      /// @brief Like `__try_emplace_unique`, using __pos as a hint for the position.
+      template <typename... _Args>
+      iterator
+      __try_emplace_hint_unique(const_iterator __pos, const key_type& __k, _Args&&... __args)
+      {
+        return __insert_hint_unique_aux(__pos, __k, std::forward<_Args>(__args)...);
+      }
+
+      /// @brief Insert every value of a range, skipping duplicate keys.
+      /// @details Every value is hinted at `end()`, so sorted input is appended without
+      /// descending the tree, and the biased splits leave the nodes nearly full.
+      template <typename _InputIterator>
+      void
+      __insert_range_unique(_InputIterator __first, _InputIterator __last)
+      {
+        for ( ; __first != __last; ++__first )
+          __insert_unique(end(), *__first);
+      }
+
+    public:
+      /// @brief Erase the element at a position.
+      /// @return An iterator to the element following the erased one.
+      iterator
+      erase(const_iterator __position) { return __erase_at(__position.__const_cast()); }
+
+      iterator
+      erase(iterator __position) { return __erase_at(__position); }
+
+      /// @brief Erase the element with a key equivalent to __k, if any.
+      /// @return The number of erased elements.
+      size_type
+      erase(const key_type& __k)
+      {
+        iterator __i = find(__k);
+
+        if ( __i == end() ) return 0;
+        __erase_at(__i);
+        return 1;
+      }
+
+      /// @brief Erase the elements in [__first, __last).
+      /// @return An iterator to the element following the last erased one.
+      /// @details Every erasure invalidates __last, so the elements are counted first and
+      /// erased one at a time from __first.
+      iterator
+      erase(const_iterator __first, const_iterator __last)
+      {
+        if ( __first == begin() && __last == end() ) {
+          clear();
+          return end();
+        }
+
+        iterator  __i = __first.__const_cast();
+        size_type __n = static_cast<size_type>(ft::distance(__first, __last));
+
+        for ( ; __n != 0; --__n ) __i = __erase_at(__i);
+        return __i;
+      }
+
+      /// @brief Erase every element.
+      void
+      clear() noexcept
+      {
+        __erase(m_impl.m_root);
+        m_impl.__reset();
+      }
+
+      /// @brief Swap the contents with another tree.
+      /// @param __t The tree to swap with.
+      void
+      swap(btree& __t) noexcept(std::is_nothrow_swappable<_Compare>::value)
+      {
+        std::swap(m_impl.m_root, __t.m_impl.m_root);
+        std::swap(m_impl.m_leftmost, __t.m_impl.m_leftmost);
+        std::swap(m_impl.m_size, __t.m_impl.m_size);
+        std::swap(m_impl.__key_compare(), __t.m_impl.__key_compare());
+        __alloc_on_swap(__t, typename leaf_alloc_traits::propagate_on_container_swap());
+      }
+
+    private:
+      /// @brief SFINAE helper accepting the key type, or any type if the comparator is transparent.
+      template <typename _Kt>
+      using __lookup_t = std::enable_if_t<std::is_same<_Kt, key_type>::value ||
+                                          is_transparent_compare<_Compare>::value>;
+
+    public:
+      /// @brief Find the element with a key equivalent to __k.
+      /// @return An iterator to the element, or end() if there is none.
+      /// @details Keys are unique, so the descent stops at the first equivalent key, even
+      /// in an internal node.
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      iterator
+      find(const _Kt& __k) { return __find(__k).template __as<iterator>(); }
+
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      const_iterator
+      find(const _Kt& __k) const { return __find(__k).template __as<const_iterator>(); }
+
+      /// @brief Count the elements with a key equivalent to __k, zero or one.
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      size_type
+      count(const _Kt& __k) const { return find(__k) == end() ? 0 : 1; }
+
+      /// @brief Get the first element whose key is not less than __k.
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      iterator
+      lower_bound(const _Kt& __k) { return __bound(__k, std::true_type()).template __as<iterator>(); }
+
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      const_iterator
+      lower_bound(const _Kt& __k) const { return __bound(__k, std::true_type()).template __as<const_iterator>(); }
+
+      /// @brief Get the first element whose key is greater than __k.
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      iterator
+      upper_bound(const _Kt& __k) { return __bound(__k, std::false_type()).template __as<iterator>(); }
+
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      const_iterator
+      upper_bound(const _Kt& __k) const { return __bound(__k, std::false_type()).template __as<const_iterator>(); }
+
+      /// @brief Get the range of elements with a key equivalent to __k, of length zero or one.
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      pair<iterator, iterator>
+      equal_range(const _Kt& __k)
+      {
+        iterator __i = lower_bound(__k);
+
+        if ( __i == end() || m_impl.__key_compare()(__k, _KeyOfValue()(*__i)) )
+          return pair<iterator, iterator>(__i, __i);
+        iterator __j = __i;
+        return pair<iterator, iterator>(__i, ++__j);
+      }
+
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      pair<const_iterator, const_iterator>
+      equal_range(const _Kt& __k) const
+      {
+        const_iterator __i = lower_bound(__k);
+
+        if ( __i == end() || m_impl.__key_compare()(__k, _KeyOfValue()(*__i)) )
+          return pair<const_iterator, const_iterator>(__i, __i);
+        const_iterator __j = __i;
+        return pair<const_iterator, const_iterator>(__i, ++__j);
+      }
+
+    public:
+      /// @brief Check the B-tree invariants.
+      /// @return True if the tree is valid.
+      /// @details Checks that keys are strictly increasing, that every non-root node holds
+      /// between one and `node_slots` values, that all leaves are at the same depth, that
+      /// parent and position links agree, and the cached size and leftmost leaf. Intended
+      /// for debugging; runs in O(n).
+      bool
+      __btree_verify() const
+      {
+        if ( m_impl.m_root == nullptr )
+          return m_impl.m_size == 0 && m_impl.m_leftmost == nullptr;
+        if ( m_impl.m_root->m_parent != nullptr || m_impl.m_root->m_count == 0 ) return false;
+
+        const_node_ptr __x = m_impl.m_root;
+        while ( !__x->m_leaf ) __x = __x->__child(0);
+        if ( __x != m_impl.m_leftmost ) return false;
+
+        size_type __n     = 0;
+        int       __depth = -1;
+        if ( !__verify_node(m_impl.m_root, 0, __depth, __n) || __n != m_impl.m_size ) return false;
+
+        size_type __walked = 0;
+        for ( const_iterator __i = begin(), __e = end(); __i != __e; ++__walked ) {
+          const_iterator __p = __i++;
+          if ( __i != __e && !m_impl.__key_compare()(_KeyOfValue()(*__p), _KeyOfValue()(*__i)) ) return false;
+        }
+        return __walked == m_impl.m_size;
+      }
+
+    private:
+      /// @brief A position found by a search, convertible to either iterator type.
+      struct __slot
+      {
+        node_ptr m_node;
+        int      m_position;
+
+        template <typename _Iterator>
+        _Iterator
+        __as() const noexcept { return _Iterator(m_node, m_position); }
+      };
+
+      leaf_allocator&
+      __leaf_allocator() noexcept { return m_impl; }
+
+      const leaf_allocator&
+      __leaf_allocator() const noexcept { return m_impl; }
+
+      __slot
+      __end_slot() const noexcept
+      {
+        return __slot{ m_impl.m_root, m_impl.m_root == nullptr ? 0 : m_impl.m_root->m_count };
+      }
+
+      template <typename _Kt>
+      __slot
+      __find(const _Kt& __k) const
+      {
+        node_ptr __x = m_impl.m_root;
+
+        while ( __x != nullptr ) {
+          const std::size_t __i = __x->template __lower_bound<_KeyOfValue>(__k, m_impl.__key_compare());
+
+          if ( __i < __x->m_count && !m_impl.__key_compare()(__k, _KeyOfValue()(*__x->__valptr(__i))) )
+            return __slot{ __x, static_cast<int>(__i) };
+          if ( __x->m_leaf ) break;
+          __x = __x->__child(__i);
+        }
+        return __end_slot();
+      }
+
+      /// @brief Lower bound of __k for std::true_type, upper bound for std::false_type.
+      /// @details The deepest node with a candidate slot holds the smallest one.
+      template <typename _Kt, typename _Lower>
+      __slot
+      __bound(const _Kt& __k, _Lower) const
+      {
+        __slot   __res = __end_slot();
+        node_ptr __x   = m_impl.m_root;
+
+        while ( __x != nullptr ) {
+          const std::size_t __i = _Lower::value
+            ? __x->template __lower_bound<_KeyOfValue>(__k, m_impl.__key_compare())
+            : __x->template __upper_bound<_KeyOfValue>(__k, m_impl.__key_compare());
+
+          if ( __i < __x->m_count ) __res = __slot{ __x, static_cast<int>(__i) };
+          if ( __x->m_leaf ) break;
+          __x = __x->__child(__i);
+        }
+        return __res;
+      }
+
+      /// @brief Find where __k goes.
+      /// @return The element with key __k and false, or the leaf slot to insert at and true.
+      pair<iterator, bool>
+      __get_insert_unique_pos(const key_type& __k) const
+      {
+        node_ptr __x = m_impl.m_root;
+
+        if ( __x == nullptr ) return pair<iterator, bool>(iterator(), true);
+        while ( true ) {
+          const std::size_t __i = __x->template __lower_bound<_KeyOfValue>(__k, m_impl.__key_compare());
+
+          if ( __i < __x->m_count && !m_impl.__key_compare()(__k, _KeyOfValue()(*__x->__valptr(__i))) )
+            return pair<iterator, bool>(iterator(__x, static_cast<int>(__i)), false);
+          if ( __x->m_leaf )
+            return pair<iterator, bool>(iterator(__x, static_cast<int>(__i)), true);
+          __x = __x->__child(__i);
+        }
+      }
+
+      /// @brief Like `__get_insert_unique_pos`, trying the neighbours of a hint first.
+      pair<iterator, bool>
+      __get_insert_hint_unique_pos(const_iterator __hint, const key_type& __k)
+      {
+        iterator __pos = __hint.__const_cast();
+
+        if ( __pos == end() || m_impl.__key_compare()(__k, _KeyOfValue()(*__pos)) ) {
+          if ( __pos == begin() )
+            return pair<iterator, bool>(__leaf_slot_before(__pos), true);
+
+          iterator __before = __pos;
+          --__before;
+          if ( m_impl.__key_compare()(_KeyOfValue()(*__before), __k) )
+            return pair<iterator, bool>(__leaf_slot_before(__pos), true);
+        } else if ( m_impl.__key_compare()(_KeyOfValue()(*__pos), __k) ) {
+          iterator __after = __pos;
+          ++__after;
+          if ( __after == end() || m_impl.__key_compare()(__k, _KeyOfValue()(*__after)) )
+            return pair<iterator, bool>(__leaf_slot_before(__after), true);
+        } else {
+          return pair<iterator, bool>(__pos, false);
+        }
+        return __get_insert_unique_pos(__k);
+      }
+
+      /// @brief Get the leaf slot where a value inserted right before __pos goes.
+      /// @details New values always go into leaves: before a value of an internal node
+      /// means after the last value of the subtree on its left.
+      iterator
+      __leaf_slot_before(iterator __pos) noexcept
+      {
+        if ( __pos.m_node == nullptr || __pos.m_node->m_leaf ) return __pos;
+        --__pos;
+        return iterator(__pos.m_node, __pos.m_position + 1);
+      }
+
+      template <typename... _Args>
+      pair<iterator, bool>
+      __insert_unique_aux(const key_type& __k, _Args&&... __args)
+      {
+        pair<iterator, bool> __res = __get_insert_unique_pos(__k);
+
+        if ( !__res.second ) return __res;
+        return pair<iterator, bool>(__insert_at(__res.first, std::forward<_Args>(__args)...), true);
+      }
+
+      template <typename... _Args>
+      iterator
+      __insert_hint_unique_aux(const_iterator __pos, const key_type& __k, _Args&&... __args)
+      {
+        pair<iterator, bool> __res = __get_insert_hint_unique_pos(__pos, __k);
+
+        if ( !__res.second ) return __res.first;
+        return __insert_at(__res.first, std::forward<_Args>(__args)...);
+      }
+
+      /// @brief Construct a value in the leaf slot __pos, splitting full nodes on the way up.
+      /// @return An iterator to the new value.
+      template <typename... _Args>
+      iterator
+      __insert_at(iterator __pos, _Args&&... __args)
+      {
+        node_ptr __x = __pos.m_node;
+        int      __i = __pos.m_position;
+
+        if ( __x == nullptr ) {
+          __x = __new_node(true);
+          __i = 0;
+          m_impl.m_root     = __x;
+          m_impl.m_leftmost = __x;
+        } else if ( __x->m_count == node_slots ) {
+          __split(__x, __i);
+        }
+
+        __shift_right(__x, __i);
+        try {
+          __construct_value(__x->__valptr(__i), std::forward<_Args>(__args)...);
+        } catch ( ... ) {
+          // The values shifted right sit in slots __i + 1 to m_count inclusive.
+          for ( int __j = __i + 1; __j <= __x->m_count; ++__j ) __transfer(__x, __j - 1, __x, __j);
+          if ( m_impl.m_size == 0 ) {
+            __delete_node(__x);
+            m_impl.__reset();
+          } else if ( __x->m_count == 0 ) {
+            // A split at either end of a node left this side empty; merge it back.
+            __rebalance_after_erase(iterator(__x, 0));
+          }
+          throw;
+        }
+        ++__x->m_count;
+        ++m_impl.m_size;
+        return iterator(__x, __i);
+      }
+
+      /// @brief Split the full node __x before inserting at slot __i of it.
+      /// @details The parent is split first if it is full too. The separator moves up to
+      /// the parent and the upper values to a new right sibling. Inserting at either end
+      /// of the node leaves that side nearly empty and the other full, so sequential
+      /// insertion packs the nodes. On return __x and __i designate the insertion slot.
+      void
+      __split(node_ptr& __x, int& __i)
+      {
+        node_ptr __p = __x->m_parent;
+
+        if ( __p == nullptr ) {
+          __p = __new_node(false);
+          __p->__set_child(0, __x);
+          m_impl.m_root = __p;
+        } else if ( __p->m_count == node_slots ) {
+          int __pi = __x->m_position;
+          __split(__p, __pi);
+          __p = __x->m_parent;
+        }
+
+        const int __n   = __x->m_count;
+        const int __mid = __i == __n ? __n - 1 : ( __i == 0 ? 0 : __n / 2 );
+        node_ptr  __r   = __new_node(__x->m_leaf);
+
+        for ( int __j = __mid + 1; __j < __n; ++__j ) __transfer(__r, __j - __mid - 1, __x, __j);
+        if ( !__x->m_leaf )
+          for ( int __j = __mid + 1; __j <= __n; ++__j ) __r->__set_child(__j - __mid - 1, __x->__child(__j));
+        __r->m_count = static_cast<typename leaf_node::field_type>(__n - __mid - 1);
+
+        const int __pos = __x->m_position;
+        __shift_right(__p, __pos);
+        __transfer(__p, __pos, __x, __mid);
+        ++__p->m_count;
+        __p->__set_child(__pos + 1, __r);
+        __x->m_count = static_cast<typename leaf_node::field_type>(__mid);
+
+        if ( __i > __mid ) {
+          __x = __r;
+          __i -= __mid + 1;
+        }
+      }
+
+      /// @brief Erase the value at __pos and rebalance.
+      /// @return An iterator to the value that followed it.
+      /// @details A value of an internal node is replaced by its predecessor, which always
+      /// sits at the end of a leaf, so only leaves ever lose a slot. The position of the
+      /// gap is tracked through the rebalancing to find the successor afterwards.
+      iterator
+      __erase_at(iterator __pos)
+      {
+        const bool __internal = !__pos.m_node->m_leaf;
+
+        __destroy_value(__pos.m_node->__valptr(__pos.m_position));
+        if ( __internal ) {
+          iterator __pred = __pos;
+          --__pred;
+          __transfer(__pos.m_node, __pos.m_position, __pred.m_node, __pred.m_position);
+          __pos = __pred;
+        }
+        __shift_left(__pos.m_node, __pos.m_position + 1);
+        --__pos.m_node->m_count;
+        --m_impl.m_size;
+
+        __pos = __rebalance_after_erase(__pos);
+        if ( __pos.m_node == nullptr ) return end();
+
+        // The gap may be one past the end of its node; climb to the value it stands for.
+        while ( __pos.m_position == __pos.m_node->m_count && __pos.m_node->m_parent != nullptr ) {
+          __pos.m_position = __pos.m_node->m_position;
+          __pos.m_node     = __pos.m_node->m_parent;
+        }
+        if ( __internal ) ++__pos;
+        return __pos;
+      }
+
+      /// @brief Restore the minimum occupancy from the node of __pos upwards.
+      /// @return __pos, adjusted if its values moved to another node.
+      /// @details An underfull node is merged with a sibling when both fit in one node;
+      /// otherwise it takes half the surplus of a sibling and the walk stops. A root left
+      /// without values is replaced by its only child, or freed if it is a leaf.
+      iterator
+      __rebalance_after_erase(iterator __pos)
+      {
+        node_ptr __x = __pos.m_node;
+
+        while ( true ) {
+          if ( __x == m_impl.m_root ) {
+            if ( __x->m_count == 0 ) {
+              if ( __x->m_leaf ) {
+                __delete_node(__x);
+                m_impl.__reset();
+                return iterator();
+              }
+              m_impl.m_root = __x->__child(0);
+              m_impl.m_root->m_parent   = nullptr;
+              m_impl.m_root->m_position = 0;
+              __delete_node(__x);
+            }
+            return __pos;
+          }
+          if ( __x->m_count >= leaf_node::min_slots ) return __pos;
+
+          node_ptr  __p  = __x->m_parent;
+          const int __xi = __x->m_position;
+
+          if ( __xi > 0 ) {
+            node_ptr __l = __p->__child(__xi - 1);
+            if ( static_cast<size_type>(__l->m_count + 1 + __x->m_count) <= node_slots ) {
+              if ( __pos.m_node == __x ) {
+                __pos.m_node      = __l;
+                __pos.m_position += __l->m_count + 1;
+              }
+              __merge(__l, __x);
+              __x = __p;
+              continue;
+            }
+          }
+          if ( __xi < __p->m_count ) {
+            node_ptr __r = __p->__child(__xi + 1);
+            if ( static_cast<size_type>(__x->m_count + 1 + __r->m_count) <= node_slots ) {
+              __merge(__x, __r);
+              __x = __p;
+              continue;
+            }
+            __rotate_left(__x, __r, ( __r->m_count - __x->m_count ) / 2);
+            return __pos;
+          }
+
+          node_ptr  __l = __p->__child(__xi - 1);
+          const int __n = ( __l->m_count - __x->m_count ) / 2;
+          __rotate_right(__l, __x, __n);
+          if ( __pos.m_node == __x ) __pos.m_position += __n;
+          return __pos;
+        }
+      }
+
+      /// @brief Move the separator and all of __r into its left sibling __l, and free __r.
+      void
+      __merge(node_ptr __l, node_ptr __r) noexcept
+      {
+        node_ptr  __p   = __l->m_parent;
+        const int __pos = __l->m_position;
+        const int __n   = __l->m_count;
+
+        __transfer(__l, __n, __p, __pos);
+        for ( int __j = 0; __j < __r->m_count; ++__j ) __transfer(__l, __n + 1 + __j, __r, __j);
+        if ( !__l->m_leaf )
+          for ( int __j = 0; __j <= __r->m_count; ++__j ) __l->__set_child(__n + 1 + __j, __r->__child(__j));
+        __l->m_count = static_cast<typename leaf_node::field_type>(__n + 1 + __r->m_count);
+
+        __shift_left(__p, __pos + 1);
+        --__p->m_count;
+        __delete_node(__r);
+      }
+
+      /// @brief Move __n values from __r, through the separator, to the end of its left sibling __x.
+      void
+      __rotate_left(node_ptr __x, node_ptr __r, int __n) noexcept
+      {
+        node_ptr  __p   = __x->m_parent;
+        const int __pos = __x->m_position;
+        const int __c   = __x->m_count;
+        const int __rc  = __r->m_count;
+
+        __transfer(__x, __c, __p, __pos);
+        for ( int __j = 0; __j < __n - 1; ++__j ) __transfer(__x, __c + 1 + __j, __r, __j);
+        __transfer(__p, __pos, __r, __n - 1);
+        for ( int __j = __n; __j < __rc; ++__j ) __transfer(__r, __j - __n, __r, __j);
+
+        if ( !__x->m_leaf ) {
+          for ( int __j = 0; __j < __n; ++__j ) __x->__set_child(__c + 1 + __j, __r->__child(__j));
+          for ( int __j = __n; __j <= __rc; ++__j ) __r->__set_child(__j - __n, __r->__child(__j));
+        }
+        __x->m_count = static_cast<typename leaf_node::field_type>(__c + __n);
+        __r->m_count = static_cast<typename leaf_node::field_type>(__rc - __n);
+      }
+
+      /// @brief Move __n values from __l, through the separator, to the front of its right sibling __x.
+      void
+      __rotate_right(node_ptr __l, node_ptr __x, int __n) noexcept
+      {
+        node_ptr  __p   = __l->m_parent;
+        const int __pos = __l->m_position;
+        const int __c   = __x->m_count;
+        const int __lc  = __l->m_count;
+
+        for ( int __j = __c - 1; __j >= 0; --__j ) __transfer(__x, __j + __n, __x, __j);
+        __transfer(__x, __n - 1, __p, __pos);
+        for ( int __j = 0; __j < __n - 1; ++__j ) __transfer(__x, __j, __l, __lc - __n + 1 + __j);
+        __transfer(__p, __pos, __l, __lc - __n);
+
+        if ( !__x->m_leaf ) {
+          for ( int __j = __c; __j >= 0; --__j ) __x->__set_child(__j + __n, __x->__child(__j));
+          for ( int __j = 0; __j < __n; ++__j ) __x->__set_child(__j, __l->__child(__lc - __n + 1 + __j));
+        }
+        __x->m_count = static_cast<typename leaf_node::field_type>(__c + __n);
+        __l->m_count = static_cast<typename leaf_node::field_type>(__lc - __n);
+      }
+
+      /// @brief Open slot __i of __x by moving the values after it (and their right children) up by one.
+      void
+      __shift_right(node_ptr __x, int __i) noexcept
+      {
+        for ( int __j = __x->m_count - 1; __j >= __i; --__j ) __transfer(__x, __j + 1, __x, __j);
+        if ( !__x->m_leaf )
+          for ( int __j = __x->m_count; __j > __i; --__j ) __x->__set_child(__j + 1, __x->__child(__j));
+      }
+
+      /// @brief Close the gap before slot __i of __x by moving the values from __i (and their right children) down by one.
+      void
+      __shift_left(node_ptr __x, int __i) noexcept
+      {
+        for ( int __j = __i; __j < __x->m_count; ++__j ) __transfer(__x, __j - 1, __x, __j);
+        if ( !__x->m_leaf )
+          for ( int __j = __i + 1; __j <= __x->m_count; ++__j ) __x->__set_child(__j - 1, __x->__child(__j));
+      }
+
+      /// @brief Move the value in slot __j of __src into the empty slot __i of __dst.
+      void
+      __transfer(node_ptr __dst, int __i, node_ptr __src, int __j) noexcept
+      {
+        __construct_value(__dst->__valptr(__i), std::move(*__src->__valptr(__j)));
+        __destroy_value(__src->__valptr(__j));
+      }
+
+      /// @brief Allocate an empty leaf or internal node.
+      node_ptr
+      __new_node(bool __leaf)
+      {
+        if ( __leaf ) {
+          leaf_node* __x = leaf_alloc_traits::allocate(__leaf_allocator(), 1);
+          ::new (static_cast<void*>(__x)) leaf_node();
+          return __x;
+        }
+        internal_allocator __a(__leaf_allocator());
+        internal_node*     __x = internal_alloc_traits::allocate(__a, 1);
+        ::new (static_cast<void*>(__x)) internal_node();
+        return __x;
+      }
+
+      /// @brief Release a node whose values are already destroyed or moved out.
+      void
+      __delete_node(node_ptr __x) noexcept
+      {
+        if ( __x->m_leaf ) {
+          __x->~leaf_node();
+          leaf_alloc_traits::deallocate(__leaf_allocator(), __x, 1);
+        } else {
+          internal_allocator __a(__leaf_allocator());
+          internal_node*     __y = static_cast<internal_node*>(__x);
+          __y->~internal_node();
+          internal_alloc_traits::deallocate(__a, __y, 1);
+        }
+      }
+
+      /// @brief Destroy the values and release the nodes of the subtree rooted at __x.
+      void
+      __erase(node_ptr __x) noexcept
+      {
+        if ( __x == nullptr ) return;
+
+        if ( !__x->m_leaf )
+          for ( int __j = 0; __j <= __x->m_count; ++__j ) __erase(__x->__child(__j));
+        __destroy_values(__x, std::is_trivially_destructible<value_type>());
+        __delete_node(__x);
+      }
+
+      void
+      __destroy_values(node_ptr __x, std::false_type) noexcept
+      {
+        for ( int __j = 0; __j < __x->m_count; ++__j )
+          __destroy_value(__x->__valptr(__j));
+      }
+
+      void
+      __destroy_values(node_ptr, std::true_type) noexcept { }
+
+      /// @brief Construct a value in a slot with the user's allocator, rebound to values.
+      template <typename... _Args>
+      void
+      __construct_value(value_type* __p, _Args&&... __args)
+      {
+        _Alloc __a(__leaf_allocator());
+        value_alloc_traits::construct(__a, __p, std::forward<_Args>(__args)...);
+      }
+
+      void
+      __destroy_value(value_type* __p) noexcept
+      {
+        _Alloc __a(__leaf_allocator());
+        value_alloc_traits::destroy(__a, __p);
+      }
+
+      /// @brief Append the values of __x to this (empty) tree in order.
+      /// @details Each value goes right after the previous one, so no search is needed and
+      /// the biased splits leave every node but the rightmost ones full.
+      void
+      __copy(const btree& __x)
+      {
+        iterator __last;
+
+        try {
+          for ( const_iterator __i = __x.begin(); __i != __x.end(); ++__i ) {
+            __last = __insert_at(__last.m_node == nullptr ? iterator() : iterator(__last.m_node, __last.m_position + 1), *__i);
+          }
+        } catch ( ... ) {
+          clear();
+          throw;
+        }
+      }
+
+      /// @brief Check the subtree rooted at __x; __depth is the leaf depth, set by the first leaf.
+      bool
+      __verify_node(const_node_ptr __x, int __level, int& __depth, size_type& __n) const
+      {
+        if ( __x->m_count > node_slots || ( __x != m_impl.m_root && __x->m_count == 0 ) ) return false;
+        __n += __x->m_count;
+
+        if ( __x->m_leaf ) {
+          if ( __depth < 0 ) __depth = __level;
+          return __depth == __level;
+        }
+        for ( int __j = 0; __j <= __x->m_count; ++__j ) {
+          const_node_ptr __c = __x->__child(__j);
+          if ( __c->m_parent != __x || __c->m_position != __j ) return false;
+          if ( !__verify_node(__c, __level + 1, __depth, __n) ) return false;
+        }
+        return true;
+      }
+
+      void
+      __move_assign(btree& __x, std::true_type)
+      {
+        clear();
+        m_impl.m_root     = __x.m_impl.m_root;
+        m_impl.m_leftmost = __x.m_impl.m_leftmost;
+        m_impl.m_size     = __x.m_impl.m_size;
+        __x.m_impl.__reset();
+        __alloc_on_move(__x, typename leaf_alloc_traits::propagate_on_container_move_assignment());
+      }
+
+      void
+      __move_assign(btree& __x, std::false_type)
+      {
+        if ( __leaf_allocator() == __x.__leaf_allocator() ) {
+          __move_assign(__x, std::true_type());
+          return;
+        }
+        clear();
+        iterator __last;
+        for ( iterator __i = __x.begin(); __i != __x.end(); ++__i ) {
+          __last = __insert_at(__last.m_node == nullptr ? iterator() : iterator(__last.m_node, __last.m_position + 1),
+                               std::move(*__i));
+        }
+        __x.clear();
+      }
+
+      void
+      __alloc_on_copy(const btree& __x, std::true_type) { __leaf_allocator() = __x.__leaf_allocator(); }
+
+      void
+      __alloc_on_copy(const btree&, std::false_type) { }
+
+      void
+      __alloc_on_move(btree& __x, std::true_type) { __leaf_allocator() = std::move(__x.__leaf_allocator()); }
+
+      void
+      __alloc_on_move(btree&, std::false_type) { }
+
+      void
+      __alloc_on_swap(btree& __x, std::true_type) { std::swap(__leaf_allocator(), __x.__leaf_allocator()); }
+
+      void
+      __alloc_on_swap(btree&, std::false_type) { }
+  };
+
+  template <typename _Key, typename _Val, typename _KeyOfValue, typename _Compare, typename _Alloc, std::size_t _N>
+  inline bool
+  operator==(const btree<_Key, _Val, _KeyOfValue, _Compare, _Alloc, _N>& __x,
+             const btree<_Key, _Val, _KeyOfValue, _Compare, _Alloc, _N>& __y)
+  {
+    return __x.size() == __y.size() && ft::equal(__x.begin(), __x.end(), __y.begin());
+  }
+
+  template <typename _Key, typename _Val, typename _KeyOfValue, typename _Compare, typename _Alloc, std::size_t _N>
+  inline bool
+  operator<(const btree<_Key, _Val, _KeyOfValue, _Compare, _Alloc, _N>& __x,
+            const btree<_Key, _Val, _KeyOfValue, _Compare, _Alloc, _N>& __y)
+  {
+    return ft::lexicographical_compare(__x.begin(), __x.end(), __y.begin(), __y.end());
+  }
+
+} // namespace ft
+
+#endif // __FT_BTREE__
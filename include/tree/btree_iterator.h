@@ -0,0 +1,186 @@
+#ifndef   __FT_BTREE_ITERATOR__
+# define  __FT_BTREE_ITERATOR__
+
+# include <cstddef> // For std::ptrdiff_t
+
+# include "../iterator/iterator_base_types.h" // For bidirectional_iterator_tag
+# include "btree_node.h"                      // For btree_increment, btree_decrement
+
+namespace ft {
+
+  /// @brief Bidirectional iterator over the values of a B-tree.
+  /// @details The iterator holds a node and a slot in it. The past-the-end position is
+  /// (root, root->m_count), so `--end()` yields the last value of the rightmost leaf.
+  ///
+  /// Values move between nodes when the tree splits or merges them, so inserting into or
+  /// erasing from a B-tree invalidates every iterator, unlike the red-black tree.
+  template <typename _Node>
+  struct btree_iterator
+  {
+    using value_type        = typename _Node::value_type; ///< The type of the value pointed to by the iterator.
+    using reference         = value_type&;                ///< Reference type to the value.
+    using pointer           = value_type*;                ///< Pointer type to the value.
+    using iterator_category = bidirectional_iterator_tag; ///< The category of the iterator.
+    using difference_type   = std::ptrdiff_t;             ///< The type used for representing the difference between two iterators.
+
+    using self      = btree_iterator<_Node>;
+    using node_ptr  = _Node*;
+
+    node_ptr m_node;     ///< The node the iterator points into.
+    int      m_position; ///< The slot of the value in the node.
+
+    /// @brief Default constructor.
+    btree_iterator() noexcept
+      : m_node{ }, m_position{ 0 } { }
+
+    /// @brief Constructor from a node and a slot.
+    btree_iterator(node_ptr __x, int __i) noexcept
+      : m_node{ __x }, m_position{ __i } { }
+
+    /// @brief Dereference operator.
+    /// @return A reference to the value in the slot.
+    reference
+    operator*() const noexcept { return *m_node->__valptr(static_cast<std::size_t>(m_position)); }
+
+    /// @brief Arrow operator.
+    /// @return A pointer to the value in the slot.
+    pointer
+    operator->() const noexcept { return m_node->__valptr(static_cast<std::size_t>(m_position)); }
+
+    /// @brief Pre-increment operator.
+    self&
+    operator++() noexcept
+    {
+      btree_increment(m_node, m_position);
+      return *this;
+    }
+
+    /// @brief Post-increment operator.
+    self
+    operator++(int) noexcept
+    {
+      self __tmp = *this;
+      btree_increment(m_node, m_position);
+      return __tmp;
+    }
+
+    /// @brief Pre-decrement operator.
+    self&
+    operator--() noexcept
+    {
+      btree_decrement(m_node, m_position);
+      return *this;
+    }
+
+    /// @brief Post-decrement operator.
+    self
+    operator--(int) noexcept
+    {
+      self __tmp = *this;
+      btree_decrement(m_node, m_position);
+      return __tmp;
+    }
+
+    friend bool
+    operator==(const self& __x, const self& __y) noexcept
+    {
+      return __x.m_node == __y.m_node && __x.m_position == __y.m_position;
+    }
+
+    friend bool
+    operator!=(const self& __x, const self& __y) noexcept { return !( __x == __y ); }
+  };
+
+  /// @brief Constant bidirectional iterator over the values of a B-tree.
+  /// @details Implicitly constructible from the mutable iterator, and comparable with it.
+  template <typename _Node>
+  struct btree_const_iterator
+  {
+    using value_type        = typename _Node::value_type; ///< The type of the value pointed to by the iterator.
+    using reference         = const value_type&;          ///< Reference type to the value.
+    using pointer           = const value_type*;          ///< Pointer type to the value.
+    using iterator_category = bidirectional_iterator_tag; ///< The category of the iterator.
+    using difference_type   = std::ptrdiff_t;             ///< The type used for representing the difference between two iterators.
+
+    using iterator  = btree_iterator<_Node>;
+    using self      = btree_const_iterator<_Node>;
+    using node_ptr  = const _Node*;
+
+    node_ptr m_node;     ///< The node the iterator points into.
+    int      m_position; ///< The slot of the value in the node.
+
+    /// @brief Default constructor.
+    btree_const_iterator() noexcept
+      : m_node{ }, m_position{ 0 } { }
+
+    /// @brief Constructor from a node and a slot.
+    btree_const_iterator(node_ptr __x, int __i) noexcept
+      : m_node{ __x }, m_position{ __i } { }
+
+    /// @brief Converting constructor from a mutable iterator.
+    /// @param __it The iterator to convert.
+    btree_const_iterator(const iterator& __it) noexcept
+      : m_node{ __it.m_node }, m_position{ __it.m_position } { }
+
+    /// @brief Get a mutable iterator to the same slot.
+    /// @details Used by the tree to implement erase and hinted insertion on const iterators.
+    iterator
+    __const_cast() const noexcept { return iterator(const_cast<_Node*>(m_node), m_position); }
+
+    /// @brief Dereference operator.
+    /// @return A const reference to the value in the slot.
+    reference
+    operator*() const noexcept { return *m_node->__valptr(static_cast<std::size_t>(m_position)); }
+
+    /// @brief Arrow operator.
+    /// @return A const pointer to the value in the slot.
+    pointer
+    operator->() const noexcept { return m_node->__valptr(static_cast<std::size_t>(m_position)); }
+
+    /// @brief Pre-increment operator.
+    self&
+    operator++() noexcept
+    {
+      btree_increment(m_node, m_position);
+      return *this;
+    }
+
+    /// @brief Post-increment operator.
+    self
+    operator++(int) noexcept
+    {
+      self __tmp = *this;
+      btree_increment(m_node, m_position);
+      return __tmp;
+    }
+
+    /// @brief Pre-decrement operator.
+    self&
+    operator--() noexcept
+    {
+      btree_decrement(m_node, m_position);
+      return *this;
+    }
+
+    /// @brief Post-decrement operator.
+    self
+    operator--(int) noexcept
+    {
+      self __tmp = *this;
+      btree_decrement(m_node, m_position);
+      return __tmp;
+    }
+
+    friend bool
+    operator==(const self& __x, const self& __y) noexcept
+    {
+      return __x.m_node == __y.m_node && __x.m_position == __y.m_position;
+    }
+
+    friend bool
+    operator!=(const self& __x, const self& __y) noexcept { return !( __x == __y ); }
+  };
+
+} // namespace ft
+
+#endif // __FT_BTREE_ITERATOR__
@@ -0,0 +1,173 @@
+#ifndef   __FT_BTREE_NODE__
+# define  __FT_BTREE_NODE__
+
+# include <cstddef> // For std::size_t
+# include <cstdint> // For std::uint16_t
+
+namespace ft {
+
+  /// @brief Node of a B-tree, holding up to `node_slots` values in sorted order.
+  /// @details Leaves are allocated as `btree_node`; internal nodes as `btree_internal_node`,
+  /// which appends the array of child pointers. The values live in raw storage inside the
+  /// node, so only the first `m_count` slots are constructed.
+  ///
+  /// The number of slots is derived from `_TargetNodeSize`, the size in bytes a leaf should
+  /// have: 256 bytes (four cache lines) suits small keys, while a page-sized target suits
+  /// very large trees. Every node holds at least three values so that a split leaves both
+  /// halves non-empty.
+  ///
+  /// @tparam _Val The type of the stored values.
+  /// @tparam _TargetNodeSize The desired size of a leaf in bytes.
+  template <typename _Val, std::size_t _TargetNodeSize>
+  struct btree_node
+  {
+    using value_type = _Val;          ///< The type of the stored values.
+    using field_type = std::uint16_t; ///< The type of the count and position fields.
+    using node_ptr   = btree_node*;   ///< Pointer type for the nodes.
+
+  private:
+    static constexpr std::size_t __fields_size = sizeof(void*) + 2 * sizeof(field_type) + sizeof(bool);
+    static constexpr std::size_t __fit         = _TargetNodeSize > __fields_size
+                                                 ? ( _TargetNodeSize - __fields_size ) / sizeof(_Val) : 0;
+
+  public:
+    /// @brief The maximum number of values in a node.
+    static constexpr std::size_t node_slots = __fit < 3 ? 3 : ( __fit > 0x7fff ? 0x7fff : __fit );
+
+    /// @brief The number of values below which a non-root node is rebalanced after erasure.
+    static constexpr std::size_t min_slots  = node_slots / 2;
+
+    node_ptr   m_parent   = nullptr; ///< The parent node, or nullptr for the root.
+    field_type m_position = 0;       ///< The index of this node among the children of its parent.
+    field_type m_count    = 0;       ///< The number of constructed values.
+    bool       m_leaf     = true;    ///< Whether the node has no children.
+
+    alignas(_Val) unsigned char m_storage[node_slots * sizeof(_Val)]; ///< Raw storage for the values.
+
+    /// @brief Pointer to the value in slot __i.
+    _Val*
+    __valptr(std::size_t __i) noexcept { return reinterpret_cast<_Val*>(m_storage) + __i; }
+
+    /// @brief Const pointer to the value in slot __i.
+    const _Val*
+    __valptr(std::size_t __i) const noexcept { return reinterpret_cast<const _Val*>(m_storage) + __i; }
+
+    /// @brief Get child __i. The node must be internal.
+    node_ptr
+    __child(std::size_t __i) const noexcept;
+
+    /// @brief Make __c child __i of this node, updating its parent and position.
+    void
+    __set_child(std::size_t __i, node_ptr __c) noexcept;
+
+    /// @brief Index of the first value whose key is not less than __k.
+    /// @details The search is branchless: each step halves the range with a conditional
+    /// move rather than a jump, so it does not suffer from branch mispredictions and the
+    /// number of steps depends only on `m_count`.
+    template <typename _KeyOfValue, typename _Compare, typename _Kt>
+    std::size_t
+    __lower_bound(const _Kt& __k, const _Compare& __comp) const
+    {
+      std::size_t      __n    = m_count;
+      const _Val*      __base = __valptr(0);
+      const _KeyOfValue __kov{ };
+
+      if ( __n == 0 ) return 0;
+      while ( __n > 1 ) {
+        const std::size_t __half = __n / 2;
+        __base = __comp(__kov(__base[__half]), __k) ? __base + __half : __base;
+        __n -= __half;
+      }
+      return static_cast<std::size_t>(__base - __valptr(0)) + ( __comp(__kov(*__base), __k) ? 1 : 0 );
+    }
+
+    /// @brief Index of the first value whose key is greater than __k.
+    /// @details Branchless, see `__lower_bound`.
+    template <typename _KeyOfValue, typename _Compare, typename _Kt>
+    std::size_t
+    __upper_bound(const _Kt& __k, const _Compare& __comp) const
+    {
+      std::size_t      __n    = m_count;
+      const _Val*      __base = __valptr(0);
+      const _KeyOfValue __kov{ };
+
+      if ( __n == 0 ) return 0;
+      while ( __n > 1 ) {
+        const std::size_t __half = __n / 2;
+        __base = __comp(__k, __kov(__base[__half])) ? __base : __base + __half;
+        __n -= __half;
+      }
+      return static_cast<std::size_t>(__base - __valptr(0)) + ( __comp(__k, __kov(*__base)) ? 0 : 1 );
+    }
+  };
+
+  /// @brief Internal node of a B-tree: a node with `node_slots + 1` children.
+  template <typename _Val, std::size_t _TargetNodeSize>
+  struct btree_internal_node : public btree_node<_Val, _TargetNodeSize>
+  {
+    using base_type = btree_node<_Val, _TargetNodeSize>;
+
+    typename base_type::node_ptr m_children[base_type::node_slots + 1]; ///< The children; the first `m_count + 1` are set.
+
+    btree_internal_node() noexcept { this->m_leaf = false; }
+  };
+
+  template <typename _Val, std::size_t _TargetNodeSize>
+  inline typename btree_node<_Val, _TargetNodeSize>::node_ptr
+  btree_node<_Val, _TargetNodeSize>::__child(std::size_t __i) const noexcept
+  {
+    return static_cast<const btree_internal_node<_Val, _TargetNodeSize>*>(this)->m_children[__i];
+  }
+
+  template <typename _Val, std::size_t _TargetNodeSize>
+  inline void
+  btree_node<_Val, _TargetNodeSize>::__set_child(std::size_t __i, node_ptr __c) noexcept
+  {
+    static_cast<btree_internal_node<_Val, _TargetNodeSize>*>(this)->m_children[__i] = __c;
+    __c->m_parent   = this;
+    __c->m_position = static_cast<field_type>(__i);
+  }
+
+  /// @brief Step a (node, slot) position to the next value in key order.
+  /// @details In a leaf this is usually a single increment. Past the last slot of a leaf the
+  /// position climbs to the first ancestor with a value to the right; past the last value of
+  /// the tree it ends as (root, root->m_count), which is the past-the-end position.
+  template <typename _Node>
+  inline void
+  btree_increment(_Node*& __x, int& __i) noexcept
+  {
+    if ( !__x->m_leaf ) {
+      __x = __x->__child(static_cast<std::size_t>(__i) + 1);
+      while ( !__x->m_leaf ) __x = __x->__child(0);
+      __i = 0;
+      return;
+    }
+    ++__i;
+    while ( __i == __x->m_count && __x->m_parent != nullptr ) {
+      __i = __x->m_position;
+      __x = __x->m_parent;
+    }
+  }
+
+  /// @brief Step a (node, slot) position to the previous value in key order.
+  /// @details The past-the-end position steps to the last value of the rightmost leaf.
+  template <typename _Node>
+  inline void
+  btree_decrement(_Node*& __x, int& __i) noexcept
+  {
+    if ( !__x->m_leaf ) {
+      __x = __x->__child(static_cast<std::size_t>(__i));
+      while ( !__x->m_leaf ) __x = __x->__child(__x->m_count);
+      __i = __x->m_count - 1;
+      return;
+    }
+    --__i;
+    while ( __i < 0 && __x->m_parent != nullptr ) {
+      __i = __x->m_position - 1;
+      __x = __x->m_parent;
+    }
+  }
+
+} // namespace ft
+
+#endif // __FT_BTREE_NODE__
@@ -0,0 +1,447 @@
+#ifndef   __FT_INTRUSIVE_RB_TREE__
+# define  __FT_INTRUSIVE_RB_TREE__
+
+# include <cstddef>     // For std::size_t, std::ptrdiff_t
+# include <functional>  // For std::less
+# include <limits>      // For std::numeric_limits
+# include <type_traits> // For std::decay_t, std::enable_if_t, std::is_same, std::is_nothrow_swappable
+# include <utility>     // For std::declval, std::swap
+
+# include "../iterator/iterator.h"       // For ft::reverse_iterator
+# include "../utility/pair.h"            // For ft::pair
+# include "rb_tree_node_base.h"          // For rb_tree_node_base, rb_tree_color
+# include "rb_tree_header.h"             // For rb_tree_header
+# include "rb_tree_key_compare.h"        // For rb_tree_key_compare, is_transparent_compare
+# include "rb_tree_base_functions.h"     // For rb_tree_insert_and_rebalance, rb_tree_rebalance_for_erase
+# include "intrusive_rb_tree_iterator.h" // For rb_tree_member_hook, intrusive_rb_tree_iterator
+
+namespace ft {
+
+  /// @brief Red-black tree linking objects through an `rb_tree_node_base` they embed.
+  /// @tparam _Tp The type of the linked objects.
+  /// @tparam _Hook The member of `_Tp` the tree links through.
+  /// @tparam _KeyOfValue Extracts the key from a `const _Tp&`.
+  /// @tparam _Compare Orders the keys.
+  /// @details The tree owns neither the objects nor any memory: insertion links the hook
+  /// of an object the caller keeps alive, erasure unlinks it, and neither allocates. An
+  /// object with several hooks can be in as many trees at once, one per hook, each with
+  /// its own ordering:
+  /// ```cpp
+  /// struct order {
+  ///   int                   id;
+  ///   double                price;
+  ///   ft::rb_tree_node_base by_id;
+  ///   ft::rb_tree_node_base by_price;
+  /// };
+  /// ft::intrusive_rb_tree<order, &order::by_id, id_of>       ids;
+  /// ft::intrusive_rb_tree<order, &order::by_price, price_of> prices;
+  /// ```
+  /// The tree uses the same rebalancing functions and node layout as `rb_tree`, including
+  /// the layouts selected by `FT_RB_TREE_COMPACT_NODE`, `FT_RB_TREE_ORDER_STATISTICS` and
+  /// `FT_RB_TREE_THREADED_NODE`. A linked object must not be moved or destroyed, nor its
+  /// key changed, until it is erased or the tree is cleared; a hook is in at most one
+  /// tree at a time. Elements are reachable as mutable references, for the fields that
+  /// are not part of the key.
+  template <
+    typename _Tp,
+    rb_tree_node_base _Tp::* _Hook,
+    typename _KeyOfValue,
+    typename _Compare = std::less<std::decay_t<decltype(_KeyOfValue()(std::declval<const _Tp&>()))>>
+  > class intrusive_rb_tree
+  {
+    private:
+      using base_ptr       = rb_tree_node_base*;
+      using const_base_ptr = const rb_tree_node_base*;
+      using hook_traits    = rb_tree_member_hook<_Tp, _Hook>;
+
+    public:
+      using key_type        = std::decay_t<decltype(_KeyOfValue()(std::declval<const _Tp&>()))>; ///< The type of the keys.
+      using value_type      = _Tp;              ///< The type of the linked objects.
+      using key_compare     = _Compare;         ///< The key comparison function type.
+      using pointer         = value_type*;      ///< Pointer type to the object.
+      using const_pointer   = const value_type*;///< Const pointer type to the object.
+      using reference       = value_type&;      ///< Reference type to the object.
+      using const_reference = const value_type&;///< Const reference type to the object.
+      using size_type       = std::size_t;      ///< Unsigned integer type for sizes.
+      using difference_type = std::ptrdiff_t;   ///< Signed integer type for distances.
+
+      using iterator               = intrusive_rb_tree_iterator<hook_traits, _Tp>;       ///< Bidirectional iterator.
+      using const_iterator         = intrusive_rb_tree_iterator<hook_traits, const _Tp>; ///< Constant bidirectional iterator.
+      using reverse_iterator       = ft::reverse_iterator<iterator>;                      ///< Reverse iterator.
+      using const_reverse_iterator = ft::reverse_iterator<const_iterator>;                ///< Constant reverse iterator.
+
+    private:
+      /// @brief The tree state: comparator and header.
+      struct intrusive_rb_tree_impl
+        : public rb_tree_key_compare<_Compare>,
+          public rb_tree_header
+      {
+        intrusive_rb_tree_impl()
+          : rb_tree_key_compare<_Compare>{ }, rb_tree_header{ } { }
+
+        explicit
+        intrusive_rb_tree_impl(const _Compare& __comp)
+          : rb_tree_key_compare<_Compare>(__comp), rb_tree_header{ } { }
+
+        intrusive_rb_tree_impl(intrusive_rb_tree_impl&&) = default;
+      };
+
+      intrusive_rb_tree_impl m_impl; ///< The comparator and header of the tree.
+
+      /// @brief SFINAE helper accepting the key type, or any type if the comparator is transparent.
+      template <typename _Kt>
+      using __lookup_t = std::enable_if_t<std::is_same<_Kt, key_type>::value ||
+                                          is_transparent_compare<_Compare>::value>;
+
+    public:
+      /// @brief Default constructor.
+      intrusive_rb_tree() = default;
+
+      /// @brief Constructor with a comparator.
+      /// @param __comp The key comparison function.
+      explicit
+      intrusive_rb_tree(const _Compare& __comp)
+        : m_impl(__comp) { }
+
+      /// @brief The tree does not own its elements, so it cannot be copied.
+      intrusive_rb_tree(const intrusive_rb_tree&) = delete;
+      intrusive_rb_tree& operator=(const intrusive_rb_tree&) = delete;
+
+      /// @brief Move constructor.
+      /// @details Takes over the linked objects of __x, leaving it empty.
+      intrusive_rb_tree(intrusive_rb_tree&&) = default;
+
+      /// @brief Move assignment operator.
+      /// @details Forgets the objects linked in this tree, then takes over those of __x.
+      intrusive_rb_tree&
+      operator=(intrusive_rb_tree&& __x) noexcept(std::is_nothrow_swappable<_Compare>::value)
+      {
+        clear();
+        swap(__x);
+        return *this;
+      }
+
+      /// @brief Destructor. The linked objects are left alone.
+      ~intrusive_rb_tree() = default;
+
+    public:
+      iterator               begin()         noexcept { return iterator(m_impl.m_header.m_left); }
+      const_iterator         begin()   const noexcept { return const_iterator(m_impl.m_header.m_left); }
+      iterator               end()           noexcept { return iterator(&m_impl.m_header); }
+      const_iterator         end()     const noexcept { return const_iterator(&m_impl.m_header); }
+      reverse_iterator       rbegin()        noexcept { return reverse_iterator(end()); }
+      const_reverse_iterator rbegin()  const noexcept { return const_reverse_iterator(end()); }
+      reverse_iterator       rend()          noexcept { return reverse_iterator(begin()); }
+      const_reverse_iterator rend()    const noexcept { return const_reverse_iterator(begin()); }
+
+    public:
+      bool      empty()    const noexcept { return m_impl.m_nodeCount == 0; }
+      size_type size()     const noexcept { return m_impl.m_nodeCount; }
+      size_type max_size() const noexcept { return std::numeric_limits<size_type>::max(); }
+
+      key_compare
+      key_comp() const { return m_impl.__key_compare(); }
+
+    public:
+      /// @brief Link an object unless one with an equivalent key is linked already.
+      /// @param __x The object; its hook must not be linked in any tree.
+      /// @return An iterator to the object with that key, and whether __x was linked.
+      pair<iterator, bool>
+      insert_unique(reference __x)
+      {
+        const key_type& __k = _KeyOfValue()(__x);
+        base_ptr        __y = &m_impl.m_header;
+        base_ptr        __p = __root();
+        bool            __comp = true;
+
+        while ( __p != nullptr ) {
+          __y    = __p;
+          __comp = m_impl.__key_compare()(__k, __key(__p));
+          __p    = __comp ? __p->m_left : __p->m_right;
+        }
+
+        iterator __j = iterator(__y);
+        if ( __comp ) {
+          if ( __j == begin() ) return pair<iterator, bool>(__link(true, __x, __y), true);
+          --__j;
+        }
+        if ( m_impl.__key_compare()(__key(__j.m_node), __k) )
+          return pair<iterator, bool>(__link(__comp, __x, __y), true);
+        return pair<iterator, bool>(__j, false);
+      }
+
+      /// @brief Link an object after the objects with an equivalent key.
+      /// @param __x The object; its hook must not be linked in any tree.
+      /// @return An iterator to __x.
+      iterator
+      insert_equal(reference __x)
+      {
+        const key_type& __k = _KeyOfValue()(__x);
+        base_ptr        __y = &m_impl.m_header;
+        base_ptr        __p = __root();
+        bool            __comp = true;
+
+        while ( __p != nullptr ) {
+          __y    = __p;
+          __comp = m_impl.__key_compare()(__k, __key(__p));
+          __p    = __comp ? __p->m_left : __p->m_right;
+        }
+        return __link(__comp, __x, __y);
+      }
+
+      /// @brief Unlink the object at __position.
+      /// @return An iterator to the next object.
+      iterator
+      erase(const_iterator __position) noexcept
+      {
+        base_ptr __z    = const_cast<base_ptr>(__position.m_node);
+        iterator __next = iterator(rb_tree_increment(__z));
+
+        rb_tree_rebalance_for_erase(__z, m_impl.m_header);
+        --m_impl.m_nodeCount;
+        return __next;
+      }
+
+      /// @brief Unlink the objects in [__first, __last).
+      iterator
+      erase(const_iterator __first, const_iterator __last) noexcept
+      {
+        if ( __first == begin() && __last == end() ) {
+          clear();
+          return end();
+        }
+        while ( __first != __last ) __first = erase(__first);
+        return iterator(const_cast<base_ptr>(__last.m_node));
+      }
+
+      /// @brief Unlink a linked object.
+      /// @return An iterator to the next object.
+      iterator
+      erase(reference __x) noexcept { return erase(iterator_to(__x)); }
+
+      /// @brief Unlink every object with a key equivalent to __k.
+      /// @return The number of unlinked objects.
+      /// @details Named apart from `erase` so that a key of type `_Tp` is never taken for
+      /// a linked object.
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      size_type
+      erase_key(const _Kt& __k)
+      {
+        pair<iterator, iterator> __r = equal_range(__k);
+        size_type                __n = 0;
+
+        for ( iterator __i = __r.first; __i != __r.second; ++__n ) __i = erase(__i);
+        return __n;
+      }
+
+      size_type
+      erase_key(const key_type& __k) { return erase_key<key_type>(__k); }
+
+      /// @brief Unlink every object. The objects are left alone; their hooks keep stale links.
+      void
+      clear() noexcept { m_impl.__reset(); }
+
+      /// @brief Unlink every object and pass a pointer to each to __d, in no particular order.
+      /// @param __d Called once per object, for instance to return it to its arena; it must
+      /// not throw and must not touch this tree.
+      template <typename _Disposer>
+      void
+      clear_and_dispose(_Disposer __d) noexcept
+      {
+        base_ptr __x = __root();
+
+        m_impl.__reset();
+        __dispose(__x, __d);
+      }
+
+      /// @brief Swap the contents and comparators with another tree.
+      void
+      swap(intrusive_rb_tree& __t) noexcept(std::is_nothrow_swappable<_Compare>::value)
+      {
+        if ( __root() == nullptr ) {
+          if ( __t.__root() != nullptr ) m_impl.__move_data(__t.m_impl);
+        } else if ( __t.__root() == nullptr ) {
+          __t.m_impl.__move_data(m_impl);
+        } else {
+          base_ptr __r = __root();
+          m_impl.m_header.__set_parent(__t.__root());
+          __t.m_impl.m_header.__set_parent(__r);
+          std::swap(m_impl.m_header.m_left, __t.m_impl.m_header.m_left);
+          std::swap(m_impl.m_header.m_right, __t.m_impl.m_header.m_right);
+
+          __root()->__set_parent(&m_impl.m_header);
+          __t.__root()->__set_parent(&__t.m_impl.m_header);
+          std::swap(m_impl.m_nodeCount, __t.m_impl.m_nodeCount);
+          m_impl.__thread_ends();
+          __t.m_impl.__thread_ends();
+        }
+        std::swap(m_impl.__key_compare(), __t.m_impl.__key_compare());
+      }
+
+    public:
+      /// @brief An iterator to an object linked in this tree, in O(1).
+      iterator
+      iterator_to(reference __x) noexcept { return iterator(hook_traits::__to_node(__x)); }
+
+      const_iterator
+      iterator_to(const_reference __x) const noexcept { return const_iterator(hook_traits::__to_node(__x)); }
+
+    public:
+      /// @brief Find an object with a key equivalent to __k.
+      /// @details Keys of another type are accepted when the comparator is transparent.
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      iterator
+      find(const _Kt& __k) { return iterator(const_cast<base_ptr>(__find(__k))); }
+
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      const_iterator
+      find(const _Kt& __k) const { return const_iterator(__find(__k)); }
+
+      iterator       find(const key_type& __k)       { return find<key_type>(__k); }
+      const_iterator find(const key_type& __k) const { return find<key_type>(__k); }
+
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      size_type
+      count(const _Kt& __k) const
+      {
+        pair<const_iterator, const_iterator> __r = equal_range(__k);
+        size_type                            __n = 0;
+
+        for ( ; __r.first != __r.second; ++__r.first ) ++__n;
+        return __n;
+      }
+
+      size_type count(const key_type& __k) const { return count<key_type>(__k); }
+
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      iterator
+      lower_bound(const _Kt& __k) { return iterator(const_cast<base_ptr>(__lower_bound(__k))); }
+
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      const_iterator
+      lower_bound(const _Kt& __k) const { return const_iterator(__lower_bound(__k)); }
+
+      iterator       lower_bound(const key_type& __k)       { return lower_bound<key_type>(__k); }
+      const_iterator lower_bound(const key_type& __k) const { return lower_bound<key_type>(__k); }
+
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      iterator
+      upper_bound(const _Kt& __k) { return iterator(const_cast<base_ptr>(__upper_bound(__k))); }
+
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      const_iterator
+      upper_bound(const _Kt& __k) const { return const_iterator(__upper_bound(__k)); }
+
+      iterator       upper_bound(const key_type& __k)       { return upper_bound<key_type>(__k); }
+      const_iterator upper_bound(const key_type& __k) const { return upper_bound<key_type>(__k); }
+
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      pair<iterator, iterator>
+      equal_range(const _Kt& __k) { return pair<iterator, iterator>(lower_bound(__k), upper_bound(__k)); }
+
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      pair<const_iterator, const_iterator>
+      equal_range(const _Kt& __k) const
+      {
+        return pair<const_iterator, const_iterator>(lower_bound(__k), upper_bound(__k));
+      }
+
+      pair<iterator, iterator>
+      equal_range(const key_type& __k) { return equal_range<key_type>(__k); }
+
+      pair<const_iterator, const_iterator>
+      equal_range(const key_type& __k) const { return equal_range<key_type>(__k); }
+
+    private:
+      base_ptr
+      __root() const noexcept { return m_impl.m_header.__parent(); }
+
+      /// @brief The key of the object linked by __x, by reference or by value as the extractor returns it.
+      static decltype(auto)
+      __key(const_base_ptr __x) { return _KeyOfValue()(*hook_traits::__to_value(__x)); }
+
+      /// @brief Link the hook of __x under __p, on the left if __insert_left, and rebalance.
+      iterator
+      __link(bool __insert_left, reference __x, base_ptr __p) noexcept
+      {
+        base_ptr __z = hook_traits::__to_node(__x);
+
+        rb_tree_insert_and_rebalance(__insert_left, __z, __p, m_impl.m_header);
+        ++m_impl.m_nodeCount;
+        return iterator(__z);
+      }
+
+      template <typename _Kt>
+      const_base_ptr
+      __lower_bound(const _Kt& __k) const
+      {
+        const_base_ptr __x = __root();
+        const_base_ptr __y = &m_impl.m_header;
+
+        while ( __x != nullptr ) {
+          if ( !m_impl.__key_compare()(__key(__x), __k) ) {
+            __y = __x;
+            __x = __x->m_left;
+          } else {
+            __x = __x->m_right;
+          }
+        }
+        return __y;
+      }
+
+      template <typename _Kt>
+      const_base_ptr
+      __upper_bound(const _Kt& __k) const
+      {
+        const_base_ptr __x = __root();
+        const_base_ptr __y = &m_impl.m_header;
+
+        while ( __x != nullptr ) {
+          if ( m_impl.__key_compare()(__k, __key(__x)) ) {
+            __y = __x;
+            __x = __x->m_left;
+          } else {
+            __x = __x->m_right;
+          }
+        }
+        return __y;
+      }
+
+      template <typename _Kt>
+      const_base_ptr
+      __find(const _Kt& __k) const
+      {
+        const_base_ptr __y = __lower_bound(__k);
+
+        if ( __y == &m_impl.m_header || m_impl.__key_compare()(__k, __key(__y)) ) return &m_impl.m_header;
+        return __y;
+      }
+
+      /// @brief Pass every object of the detached subtree __x to __d.
+      /// @details Recurses on right children and loops on left children, like `rb_tree::__erase`.
+      template <typename _Disposer>
+      static void
+      __dispose(base_ptr __x, _Disposer& __d) noexcept
+      {
+        while ( __x != nullptr ) {
+          __dispose(__x->m_right, __d);
+          base_ptr __y = __x->m_left;
+          __d(hook_traits::__to_value(__x));
+          __x = __y;
+        }
+      }
+  };
+
+  /// @brief Swap the contents of two intrusive trees.
+  template <typename _Tp, rb_tree_node_base _Tp::* _Hook, typename _KeyOfValue, typename _Compare>
+  inline void
+  swap(intrusive_rb_tree<_Tp, _Hook, _KeyOfValue, _Compare>& __x,
+       intrusive_rb_tree<_Tp, _Hook, _KeyOfValue, _Compare>& __y)
+    noexcept(noexcept(__x.swap(__y)))
+  {
+    __x.swap(__y);
+  }
+
+} // namespace ft
+
+#endif // __FT_INTRUSIVE_RB_TREE__
@@ -0,0 +1,176 @@
+#ifndef   __FT_INTRUSIVE_RB_TREE_ITERATOR__
+# define  __FT_INTRUSIVE_RB_TREE_ITERATOR__
+
+# include <cstddef>     // For std::ptrdiff_t
+# include <type_traits> // For std::aligned_storage_t, std::remove_const_t, std::conditional_t, std::enable_if_t, std::is_const, std::is_same
+
+# include "../iterator/iterator_base_types.h" // For bidirectional_iterator_tag, order_statistic_iterator_tag
+# include "rb_tree_node_base.h"               // For rb_tree_node_base
+# include "rb_tree_base_functions.h"          // For rb_tree_increment, rb_tree_decrement, rb_tree_rank
+
+namespace ft {
+
+  /// @brief Maps between objects of type `_Tp` and the `rb_tree_node_base` member __Hook
+  /// they embed.
+  /// @details The offset of the hook is taken once from a suitably aligned buffer, so any
+  /// type whose member is a plain `rb_tree_node_base` can be linked, standard layout or not.
+  template <typename _Tp, rb_tree_node_base _Tp::* _Hook>
+  struct rb_tree_member_hook
+  {
+    using value_type = _Tp; ///< The type of the linked objects.
+
+    /// @brief The offset of the hook from the start of the object.
+    static std::ptrdiff_t
+    __offset() noexcept
+    {
+      static const std::aligned_storage_t<sizeof(_Tp), alignof(_Tp)> __probe{ };
+      const _Tp* __t = reinterpret_cast<const _Tp*>(&__probe);
+
+      return reinterpret_cast<const char*>(&( __t->*_Hook )) - reinterpret_cast<const char*>(__t);
+    }
+
+    /// @brief The hook of an object.
+    static rb_tree_node_base*
+    __to_node(_Tp& __x) noexcept { return &( __x.*_Hook ); }
+
+    static const rb_tree_node_base*
+    __to_node(const _Tp& __x) noexcept { return &( __x.*_Hook ); }
+
+    /// @brief The object embedding a hook.
+    static _Tp*
+    __to_value(rb_tree_node_base* __n) noexcept
+    {
+      return reinterpret_cast<_Tp*>(reinterpret_cast<char*>(__n) - __offset());
+    }
+
+    static const _Tp*
+    __to_value(const rb_tree_node_base* __n) noexcept
+    {
+      return reinterpret_cast<const _Tp*>(reinterpret_cast<const char*>(__n) - __offset());
+    }
+  };
+
+  /// @brief Bidirectional iterator over the objects linked in an intrusive red-black tree.
+  /// @tparam _HookTraits The `rb_tree_member_hook` of the tree.
+  /// @tparam _Tp The object type, const-qualified for the constant iterator.
+  /// @details Like `rb_tree_iterator`, the iterator holds a node base and the header is the
+  /// past-the-end position; dereferencing steps back from the hook to its object.
+  template <typename _HookTraits, typename _Tp>
+  struct intrusive_rb_tree_iterator
+  {
+    using value_type        = std::remove_const_t<_Tp>;   ///< The type of the linked objects.
+    using reference         = _Tp&;                       ///< Reference type to the object.
+    using pointer           = _Tp*;                       ///< Pointer type to the object.
+    using iterator_category = bidirectional_iterator_tag; ///< The category of the iterator.
+    using difference_type   = std::ptrdiff_t;             ///< The type used for representing the difference between two iterators.
+
+    using self      = intrusive_rb_tree_iterator<_HookTraits, _Tp>;
+    using base_ptr  = std::conditional_t<std::is_const<_Tp>::value,
+                                         rb_tree_node_base::const_base_ptr, rb_tree_node_base::base_ptr>;
+
+    base_ptr m_node; ///< The hook the iterator points to.
+
+# if defined(FT_RB_TREE_ORDER_STATISTICS)
+    using order_statistic_category = order_statistic_iterator_tag; ///< Makes `ft::distance` and `ft::advance` O(log n).
+
+    static difference_type
+    __order_distance(const self& __first, const self& __last) noexcept
+    {
+      return static_cast<difference_type>(rb_tree_rank(__last.m_node)) -
+             static_cast<difference_type>(rb_tree_rank(__first.m_node));
+    }
+
+    static void
+    __order_advance(self& __i, difference_type __n) noexcept
+    {
+      __i.m_node = rb_tree_advance(const_cast<rb_tree_node_base*>(__i.m_node), __n);
+    }
+# endif
+
+    /// @brief Default constructor.
+    intrusive_rb_tree_iterator() noexcept
+      : m_node{ } { }
+
+    /// @brief Constructor from a hook.
+    /// @param __x The hook to point to.
+    explicit
+    intrusive_rb_tree_iterator(base_ptr __x) noexcept
+      : m_node{ __x } { }
+
+    /// @brief Conversion from the mutable iterator to the constant one.
+    template <typename _Up, typename = std::enable_if_t<std::is_const<_Tp>::value &&
+                                                        std::is_same<const _Up, _Tp>::value>>
+    intrusive_rb_tree_iterator(const intrusive_rb_tree_iterator<_HookTraits, _Up>& __it) noexcept
+      : m_node{ __it.m_node } { }
+
+    /// @brief Dereference operator.
+    /// @return A reference to the object embedding the hook.
+    reference
+    operator*() const noexcept { return *_HookTraits::__to_value(m_node); }
+
+    /// @brief Arrow operator.
+    /// @return A pointer to the object embedding the hook.
+    pointer
+    operator->() const noexcept { return _HookTraits::__to_value(m_node); }
+
+    /// @brief Pre-increment operator.
+    self&
+    operator++() noexcept
+    {
+      m_node = rb_tree_increment(m_node);
+      return *this;
+    }
+
+    /// @brief Post-increment operator.
+    self
+    operator++(int) noexcept
+    {
+      self __tmp = *this;
+      m_node = rb_tree_increment(m_node);
+      return __tmp;
+    }
+
+    /// @brief Pre-decrement operator.
+    self&
+    operator--() noexcept
+    {
+      m_node = rb_tree_decrement(m_node);
+      return *this;
+    }
+
+    /// @brief Post-decrement operator.
+    self
+    operator--(int) noexcept
+    {
+      self __tmp = *this;
+      m_node = rb_tree_decrement(m_node);
+      return __tmp;
+    }
+
+    friend bool
+    operator==(const self& __x, const self& __y) noexcept { return __x.m_node == __y.m_node; }
+
+    friend bool
+    operator!=(const self& __x, const self& __y) noexcept { return __x.m_node != __y.m_node; }
+  };
+
+  /// @brief Compare a mutable and a constant iterator of the same tree.
+  template <typename _HookTraits, typename _Tp>
+  inline bool
+  operator==(const intrusive_rb_tree_iterator<_HookTraits, _Tp>& __x,
+             const intrusive_rb_tree_iterator<_HookTraits, const _Tp>& __y) noexcept
+  {
+    return __x.m_node == __y.m_node;
+  }
+
+  template <typename _HookTraits, typename _Tp>
+  inline bool
+  operator!=(const intrusive_rb_tree_iterator<_HookTraits, _Tp>& __x,
+             const intrusive_rb_tree_iterator<_HookTraits, const _Tp>& __y) noexcept
+  {
+    return __x.m_node != __y.m_node;
+  }
+
+} // namespace ft
+
+#endif // __FT_INTRUSIVE_RB_TREE_ITERATOR__
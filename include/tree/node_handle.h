@@ -0,0 +1,200 @@
+#ifndef   __FT_NODE_HANDLE__
+# define  __FT_NODE_HANDLE__
+
+# include <memory>      // For std::allocator_traits
+# include <optional>    // For std::optional
+# include <utility>     // For std::move, std::swap
+
+namespace ft {
+
+  /// @brief Owner of a tree node that has been extracted from its container.
+  /// @details A node handle keeps the node and a copy of the node allocator, so the value can
+  /// be inspected, modified and inserted into another compatible container without being
+  /// copied, moved or reallocated. An empty handle holds neither. A non-empty handle that is
+  /// destroyed destroys and deallocates its node.
+  ///
+  /// Holding the allocator copy also keeps a pooled allocator's pool alive and shared, so
+  /// the source container cannot release it in bulk while the node is out.
+  ///
+  /// @tparam _Val The value type stored in the node.
+  /// @tparam _NodeAlloc The allocator of the node type.
+  template <typename _Val, typename _NodeAlloc>
+  class node_handle_base
+  {
+    protected:
+      using node_alloc_traits = std::allocator_traits<_NodeAlloc>;
+      using link_type         = typename node_alloc_traits::pointer;
+
+    public:
+      using allocator_type = typename node_alloc_traits::template rebind_alloc<_Val>; ///< The allocator type of the container.
+
+    public:
+      /// @brief Default constructor, creating an empty handle.
+      constexpr node_handle_base() noexcept
+        : m_node{ nullptr }, m_alloc{ } { }
+
+      /// @brief Move constructor, taking the node of __x and leaving it empty.
+      node_handle_base(node_handle_base&& __x) noexcept
+        : m_node{ __x.m_node }, m_alloc{ std::move(__x.m_alloc) }
+      {
+        __x.m_node = nullptr;
+        __x.m_alloc.reset();
+      }
+
+      /// @brief Move assignment operator, destroying the current node if any.
+      node_handle_base&
+      operator=(node_handle_base&& __x) noexcept
+      {
+        __reset();
+        m_node  = __x.m_node;
+        m_alloc = std::move(__x.m_alloc);
+        __x.m_node = nullptr;
+        __x.m_alloc.reset();
+        return *this;
+      }
+
+      node_handle_base(const node_handle_base&) = delete;
+      node_handle_base& operator=(const node_handle_base&) = delete;
+
+      /// @brief Destructor, destroying the node if any.
+      ~node_handle_base() noexcept { __reset(); }
+
+    public:
+      /// @brief Whether the handle holds no node.
+      [[nodiscard]] bool
+      empty() const noexcept { return m_node == nullptr; }
+
+      explicit
+      operator bool() const noexcept { return m_node != nullptr; }
+
+      /// @brief Get a copy of the allocator. The handle must not be empty.
+      allocator_type
+      get_allocator() const { return allocator_type(*m_alloc); }
+
+    protected:
+      /// @brief Take ownership of a detached node allocated with __a.
+      node_handle_base(link_type __p, const _NodeAlloc& __a)
+        : m_node{ __p }, m_alloc{ __a } { }
+
+      void
+      __swap(node_handle_base& __x) noexcept
+      {
+        std::swap(m_node, __x.m_node);
+        std::swap(m_alloc, __x.m_alloc);
+      }
+
+      /// @brief Destroy and deallocate the node, leaving the handle empty.
+      void
+      __reset() noexcept
+      {
+        if ( m_node == nullptr ) return;
+
+        node_alloc_traits::destroy(*m_alloc, m_node);
+        node_alloc_traits::deallocate(*m_alloc, m_node, 1);
+        m_node = nullptr;
+        m_alloc.reset();
+      }
+
+    public:
+      /// @brief Get the node, for the container only.
+      link_type
+      __node() const noexcept { return m_node; }
+
+      /// @brief Get the allocator the node came from, for the container only.
+      const _NodeAlloc&
+      __node_allocator() const noexcept { return *m_alloc; }
+
+      /// @brief Give up ownership of the node once the container has relinked it.
+      void
+      __release() noexcept
+      {
+        m_node = nullptr;
+        m_alloc.reset();
+      }
+
+    protected:
+      link_type                 m_node;  ///< The owned node, or nullptr.
+      std::optional<_NodeAlloc> m_alloc; ///< The allocator of the node; engaged iff m_node is.
+  };
+
+  /// @brief Node handle of the map-like containers, exposing the key and the mapped value.
+  /// @details `key()` gives non-const access to the key, which is const inside a container:
+  /// while the node is out it can be re-keyed before being inserted elsewhere.
+  template <typename _Key, typename _Val, typename _NodeAlloc>
+  class node_handle : public node_handle_base<_Val, _NodeAlloc>
+  {
+    using base = node_handle_base<_Val, _NodeAlloc>;
+
+    public:
+      using key_type    = _Key;                          ///< The type of the keys.
+      using mapped_type = typename _Val::second_type;    ///< The type of the mapped values.
+
+    public:
+      constexpr node_handle() noexcept = default;
+      node_handle(node_handle&&) noexcept = default;
+      node_handle& operator=(node_handle&&) noexcept = default;
+
+      /// @brief Take ownership of a detached node allocated with __a, for the container only.
+      node_handle(typename base::link_type __p, const _NodeAlloc& __a)
+        : base(__p, __a) { }
+
+    public:
+      /// @brief Get the key of the held value. The handle must not be empty.
+      key_type&
+      key() const noexcept { return const_cast<key_type&>(this->m_node->__valptr()->first); }
+
+      /// @brief Get the mapped value of the held value. The handle must not be empty.
+      mapped_type&
+      mapped() const noexcept { return this->m_node->__valptr()->second; }
+
+      void
+      swap(node_handle& __x) noexcept { this->__swap(__x); }
+
+      friend void
+      swap(node_handle& __x, node_handle& __y) noexcept { __x.swap(__y); }
+  };
+
+  /// @brief Node handle of the set-like containers, exposing the value.
+  template <typename _Val, typename _NodeAlloc>
+  class node_handle<_Val, _Val, _NodeAlloc> : public node_handle_base<_Val, _NodeAlloc>
+  {
+    using base = node_handle_base<_Val, _NodeAlloc>;
+
+    public:
+      using value_type = _Val; ///< The type of the stored values.
+
+    public:
+      constexpr node_handle() noexcept = default;
+      node_handle(node_handle&&) noexcept = default;
+      node_handle& operator=(node_handle&&) noexcept = default;
+
+      /// @brief Take ownership of a detached node allocated with __a, for the container only.
+      node_handle(typename base::link_type __p, const _NodeAlloc& __a)
+        : base(__p, __a) { }
+
+    public:
+      /// @brief Get the held value. The handle must not be empty.
+      value_type&
+      value() const noexcept { return *this->m_node->__valptr(); }
+
+      void
+      swap(node_handle& __x) noexcept { this->__swap(__x); }
+
+      friend void
+      swap(node_handle& __x, node_handle& __y) noexcept { __x.swap(__y); }
+  };
+
+  /// @brief Result of inserting a node handle into a container with unique keys.
+  /// @details On failure `node` holds the node back, and `position` points to the element
+  /// that blocked the insertion.
+  template <typename _Iterator, typename _NodeHandle>
+  struct node_insert_return
+  {
+    _Iterator   position = _Iterator(); ///< The inserted element, or the one with the same key.
+    bool        inserted = false;       ///< Whether the node was inserted.
+    _NodeHandle node;                   ///< The node, if it was not inserted.
+  };
+
+} // namespace ft
+
+#endif // __FT_NODE_HANDLE__
@@ -0,0 +1,554 @@
+#ifndef   __FT_PERSISTENT_RB_TREE__
+# define  __FT_PERSISTENT_RB_TREE__
+
+# include <atomic>      // For std::atomic
+# include <cstddef>     // For std::size_t, std::ptrdiff_t
+# include <memory>      // For std::allocator, std::allocator_traits
+# include <type_traits> // For std::enable_if_t, std::is_same
+# include <utility>     // For std::move, std::forward, std::swap, std::in_place
+# include <vector>      // For std::vector
+
+# include "../iterator/iterator.h"   // For ft::reverse_iterator
+# include "../utility/pair.h"        // For ft::pair
+# include "../algorithm/algorithm.h" // For ft::equal, ft::lexicographical_compare
+# include "rb_tree_key_compare.h"    // For rb_tree_key_compare, is_transparent_compare
+# include "rb_tree_node.h"           // For rb_tree_node
+# include "rb_tree_path_copy.h"      // For rb_tree_path, rb_tree_path_insert, rb_tree_path_erase
+# include "rb_tree_path_iterator.h"  // For rb_tree_path_iterator
+
+namespace ft {
+
+  /// @brief Node of a persistent red-black tree: a tree node shared by reference counting.
+  /// @details The count is the number of links to the node: child pointers of other nodes
+  /// and roots of versions. It is atomic so that versions sharing nodes can be read,
+  /// updated and destroyed in different threads.
+  template <typename _Val>
+  struct persistent_rb_tree_node : public rb_tree_node<_Val>
+  {
+    std::atomic<std::size_t> m_refs{ 1 }; ///< The number of links to the node.
+
+    /// @brief In-place constructor; the node starts with a single link.
+    template <typename... _Args>
+    explicit
+    persistent_rb_tree_node(std::in_place_t, _Args&&... __args)
+      : rb_tree_node<_Val>(std::in_place, std::forward<_Args>(__args)...) { }
+  };
+
+  /// @brief Persistent red-black tree for ordered associative containers with unique keys.
+  /// @details Nodes are immutable once they belong to a version and are shared between
+  /// versions by reference counting. Copying a tree, or taking a `snapshot()`, is O(1): the
+  /// copy takes a link to the root. An update copies the O(log n) nodes on the path it
+  /// changes, plus the few siblings rebalancing recolors, and leaves every other version as
+  /// it was; nodes are freed as soon as no version links to them any more.
+  ///
+  /// Every version is read with constant bidirectional iterators that walk from the root
+  /// of their version (see `rb_tree_path_iterator`), and `ft::reverse_iterator` over them.
+  /// Updating a tree invalidates its own iterators but never those of other versions.
+  /// Distinct versions may be used from different threads without synchronization; a
+  /// single version follows the usual rules of standard containers.
+  ///
+  /// Versions share nodes, so they share the allocator too: copying a tree always copies
+  /// its allocator.
+  template <
+    typename _Key,
+    typename _Val,
+    typename _KeyOfValue,
+    typename _Compare,
+    typename _Alloc = std::allocator<_Val>
+  > class persistent_rb_tree
+  {
+    protected:
+      using node_type         = persistent_rb_tree_node<_Val>;
+      using node_allocator    = typename std::allocator_traits<_Alloc>::template rebind_alloc<node_type>;
+      using node_alloc_traits = std::allocator_traits<node_allocator>;
+      using base_ptr          = rb_tree_node_base*;
+      using const_base_ptr    = const rb_tree_node_base*;
+      using link_type         = node_type*;
+      using const_link_type   = const node_type*;
+
+    public:
+      using key_type        = _Key;              ///< The type of the keys.
+      using value_type      = _Val;              ///< The type of the stored values.
+      using pointer         = value_type*;       ///< Pointer type to the value.
+      using const_pointer   = const value_type*; ///< Const pointer type to the value.
+      using reference       = value_type&;       ///< Reference type to the value.
+      using const_reference = const value_type&; ///< Const reference type to the value.
+      using size_type       = std::size_t;       ///< Unsigned integer type for sizes.
+      using difference_type = std::ptrdiff_t;    ///< Signed integer type for distances.
+      using allocator_type  = _Alloc;            ///< The allocator type given by the user.
+
+      using const_iterator         = rb_tree_path_iterator<_Val, _KeyOfValue, _Compare>; ///< Constant bidirectional iterator.
+      using iterator               = const_iterator;                                     ///< Constant bidirectional iterator.
+      using const_reverse_iterator = ft::reverse_iterator<const_iterator>;               ///< Constant reverse iterator.
+      using reverse_iterator       = const_reverse_iterator;                             ///< Constant reverse iterator.
+
+    private:
+      /// @brief The tree state: allocator, comparator, root and size.
+      struct persistent_rb_tree_impl
+        : public node_allocator,
+          public rb_tree_key_compare<_Compare>
+      {
+        base_ptr  m_root = nullptr; ///< The root of this version, or nullptr when empty.
+        size_type m_size = 0;       ///< The number of values.
+
+        persistent_rb_tree_impl()
+          : node_allocator{ }, rb_tree_key_compare<_Compare>{ } { }
+
+        persistent_rb_tree_impl(const _Compare& __comp, const node_allocator& __a)
+          : node_allocator(__a), rb_tree_key_compare<_Compare>(__comp) { }
+
+        persistent_rb_tree_impl(const persistent_rb_tree_impl& __x)
+          : node_allocator(__x), rb_tree_key_compare<_Compare>(__x.__key_compare()),
+            m_root{ __x.m_root }, m_size{ __x.m_size } { }
+
+        persistent_rb_tree_impl(persistent_rb_tree_impl&& __x) noexcept
+          : node_allocator(std::move(static_cast<node_allocator&>(__x))),
+            rb_tree_key_compare<_Compare>(std::move(static_cast<rb_tree_key_compare<_Compare>&>(__x))),
+            m_root{ __x.m_root }, m_size{ __x.m_size }
+        {
+          __x.m_root = nullptr;
+          __x.m_size = 0;
+        }
+      };
+
+      persistent_rb_tree_impl m_impl; ///< The allocator, comparator and root of this version.
+
+    public:
+      /// @brief Default constructor.
+      persistent_rb_tree() = default;
+
+      /// @brief Constructor with a comparator and an allocator.
+      persistent_rb_tree(const _Compare& __comp, const allocator_type& __a = allocator_type())
+        : m_impl(__comp, node_allocator(__a)) { }
+
+      /// @brief Copy constructor. O(1): the copy shares every node with __x.
+      persistent_rb_tree(const persistent_rb_tree& __x)
+        : m_impl(__x.m_impl)
+      {
+        __retain(m_impl.m_root);
+      }
+
+      /// @brief Move constructor.
+      persistent_rb_tree(persistent_rb_tree&&) = default;
+
+      /// @brief Destructor. Frees the nodes no other version links to.
+      ~persistent_rb_tree() noexcept { __release(m_impl.m_root); }
+
+      /// @brief Copy assignment operator. O(1), plus freeing the nodes only this version held.
+      persistent_rb_tree&
+      operator=(const persistent_rb_tree& __x)
+      {
+        persistent_rb_tree(__x).swap(*this);
+        return *this;
+      }
+
+      /// @brief Move assignment operator.
+      persistent_rb_tree&
+      operator=(persistent_rb_tree&& __x) noexcept(std::is_nothrow_move_assignable<_Compare>::value)
+      {
+        persistent_rb_tree(std::move(__x)).swap(*this);
+        return *this;
+      }
+
+      /// @brief Take a snapshot of the tree, in O(1).
+      /// @return A version that later updates of this tree leave unchanged.
+      persistent_rb_tree
+      snapshot() const { return persistent_rb_tree(*this); }
+
+    public:
+      /// @brief Get the key comparison function.
+      _Compare
+      key_comp() const { return m_impl.__key_compare(); }
+
+      /// @brief Get a copy of the allocator.
+      allocator_type
+      get_allocator() const noexcept { return allocator_type(__get_node_allocator()); }
+
+    public:
+      const_iterator
+      begin() const noexcept { return const_iterator(m_impl.m_root); }
+
+      const_iterator
+      end() const noexcept { return __make_iterator(nullptr); }
+
+      const_reverse_iterator
+      rbegin() const noexcept { return const_reverse_iterator(end()); }
+
+      const_reverse_iterator
+      rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    public:
+      bool
+      empty() const noexcept { return m_impl.m_size == 0; }
+
+      size_type
+      size() const noexcept { return m_impl.m_size; }
+
+      size_type
+      max_size() const noexcept { return node_alloc_traits::max_size(__get_node_allocator()); }
+
+    public:
+      /// @brief Insert a value if no element with an equivalent key exists.
+      /// @return An iterator to the element with the key of __v, and whether insertion took place.
+      pair<const_iterator, bool>
+      __insert_unique(const value_type& __v) { return __insert_unique_aux(_KeyOfValue()(__v), __v); }
+
+      pair<const_iterator, bool>
+      __insert_unique(value_type&& __v) { return __insert_unique_aux(_KeyOfValue()(__v), std::move(__v)); }
+
+      /// @brief Construct a value and insert it if its key is not present yet.
+      /// @details The value is built first to learn its key, then moved into its node.
+      template <typename... _Args>
+      pair<const_iterator, bool>
+      __emplace_unique(_Args&&... __args)
+      {
+        value_type __v(std::forward<_Args>(__args)...);
+        return __insert_unique_aux(_KeyOfValue()(__v), std::move(__v));
+      }
+
+      /// @brief Construct a value in a new node only if no element has the key __k.
+      /// @details Nothing is constructed, and no argument moved from, when the key exists.
+      template <typename... _Args>
+      pair<const_iterator, bool>
+      __try_emplace_unique(const key_type& __k, _Args&&... __args)
+      {
+        return __insert_unique_aux(__k, std::forward<_Args>(__args)...);
+      }
+
+      /// @brief Apply __fn to the value with key __k, in a node private to this version.
+      /// @return An iterator to the modified element, or end() if there is none.
+      /// @details The path to the element is copied first, so other versions keep the old
+      /// value. __fn must not change the key.
+      template <typename _Fn>
+      const_iterator
+      __modify_unique(const key_type& __k, _Fn&& __fn)
+      {
+        rb_tree_path __path;
+
+        if ( !__find_path(__k, __path) ) return end();
+        base_ptr __root = m_impl.m_root;
+
+        __update(__root, [&](__share_ops& __ops) {
+          rb_tree_path_copy(__root, __path, __ops);
+          std::forward<_Fn>(__fn)(*static_cast<link_type>(__path.m_nodes[__path.m_depth - 1])->__valptr());
+        }, nullptr);
+        return const_iterator(m_impl.m_root, __path);
+      }
+
+      /// @brief Insert every value of a range, skipping duplicate keys.
+      template <typename _InputIterator>
+      void
+      __insert_range_unique(_InputIterator __first, _InputIterator __last)
+      {
+        for ( ; __first != __last; ++__first )
+          __insert_unique(*__first);
+      }
+
+    public:
+      /// @brief Erase the element at a position.
+      /// @return An iterator to the element following the erased one, in the new version.
+      const_iterator
+      erase(const_iterator __position)
+      {
+        link_type __removed = __erase_aux(_KeyOfValue()(*__position));
+        // The copy of the erased node belongs to no version; its key still locates the next element.
+        const_iterator __next = upper_bound(__key(__removed));
+
+        __drop_node(__removed);
+        return __next;
+      }
+
+      /// @brief Erase the element with a key equivalent to __k, if any.
+      /// @return The number of erased elements.
+      size_type
+      erase(const key_type& __k)
+      {
+        link_type __removed = __erase_aux(__k);
+
+        if ( __removed == nullptr ) return 0;
+        __drop_node(__removed);
+        return 1;
+      }
+
+      /// @brief Erase every element of this version.
+      void
+      clear() noexcept
+      {
+        __release(m_impl.m_root);
+        m_impl.m_root = nullptr;
+        m_impl.m_size = 0;
+      }
+
+      /// @brief Swap the contents with another tree.
+      void
+      swap(persistent_rb_tree& __t) noexcept(std::is_nothrow_swappable<_Compare>::value)
+      {
+        std::swap(m_impl.m_root, __t.m_impl.m_root);
+        std::swap(m_impl.m_size, __t.m_impl.m_size);
+        std::swap(m_impl.__key_compare(), __t.m_impl.__key_compare());
+        std::swap(static_cast<node_allocator&>(m_impl), static_cast<node_allocator&>(__t.m_impl));
+      }
+
+    private:
+      /// @brief SFINAE helper accepting the key type, or any type if the comparator is transparent.
+      template <typename _Kt>
+      using __lookup_t = std::enable_if_t<std::is_same<_Kt, key_type>::value ||
+                                          is_transparent_compare<_Compare>::value>;
+
+    public:
+      /// @brief Find the element with a key equivalent to __k.
+      /// @return An iterator to the element, or end() if there is none.
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      const_iterator
+      find(const _Kt& __k) const
+      {
+        const_iterator __i = const_iterator::__lower_bound(m_impl.m_root, __k, m_impl.__key_compare());
+
+        return ( __i == end() || m_impl.__key_compare()(__k, __key(__i.m_node)) ) ? end() : __i;
+      }
+
+      /// @brief Count the elements with a key equivalent to __k, zero or one.
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      size_type
+      count(const _Kt& __k) const { return __contains(__k) ? 1 : 0; }
+
+      /// @brief Get the first element whose key is not less than __k.
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      const_iterator
+      lower_bound(const _Kt& __k) const { return const_iterator::__lower_bound(m_impl.m_root, __k, m_impl.__key_compare()); }
+
+      /// @brief Get the first element whose key is greater than __k.
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      const_iterator
+      upper_bound(const _Kt& __k) const { return const_iterator::__upper_bound(m_impl.m_root, __k, m_impl.__key_compare()); }
+
+      /// @brief Get the range of elements with a key equivalent to __k, of length zero or one.
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      pair<const_iterator, const_iterator>
+      equal_range(const _Kt& __k) const
+      {
+        const_iterator __i = lower_bound(__k);
+
+        if ( __i == end() || m_impl.__key_compare()(__k, _KeyOfValue()(*__i)) )
+          return pair<const_iterator, const_iterator>(__i, __i);
+        const_iterator __j = __i;
+        return pair<const_iterator, const_iterator>(__i, ++__j);
+      }
+
+    private:
+      /// @brief The hooks of the path-copying functions.
+      /// @details A copy takes a link to each child of its original. Dropping the links to
+      /// the originals is deferred until the update succeeds, so that an update that throws
+      /// can undo its copies and leave the tree untouched.
+      struct __share_ops
+      {
+        persistent_rb_tree&                    m_tree;
+        std::vector<pair<base_ptr, base_ptr>>& m_copies;   ///< Each copy with its original.
+        std::vector<base_ptr>&                 m_released; ///< The nodes whose link was dropped.
+
+        base_ptr
+        __clone(base_ptr __x)
+        {
+          m_copies.reserve(m_copies.size() + 1);
+          m_released.reserve(m_released.size() + 1);
+          link_type __c = m_tree.__create_node(*static_cast<const_link_type>(__x)->__valptr());
+
+          __c->__set_color(__x->__color());
+          __c->m_left  = __x->m_left;
+          __c->m_right = __x->m_right;
+          __retain(__c->m_left);
+          __retain(__c->m_right);
+          m_copies.push_back(pair<base_ptr, base_ptr>(__c, __x));
+          return __c;
+        }
+
+        void
+        __release(base_ptr __x) noexcept { m_released.push_back(__x); }
+      };
+
+      /// @brief Build a new version of this tree with __fn, starting from __root.
+      /// @param __z A fresh node __fn links in, freed too if __fn throws.
+      template <typename _Fn>
+      void
+      __update(base_ptr& __root, _Fn __fn, link_type __z)
+      {
+        std::vector<pair<base_ptr, base_ptr>> __copies;
+        std::vector<base_ptr>                 __released;
+
+        try {
+          __share_ops __ops{ *this, __copies, __released };
+
+          __fn(__ops);
+        } catch ( ... ) {
+          for ( const pair<base_ptr, base_ptr>& __c : __copies ) {
+            __unref(__c.second->m_left);
+            __unref(__c.second->m_right);
+            __drop_node(static_cast<link_type>(__c.first));
+          }
+          if ( __z != nullptr ) __drop_node(__z);
+          throw;
+        }
+        m_impl.m_root = __root;
+        for ( base_ptr __x : __released ) __release(__x);
+      }
+
+      template <typename... _Args>
+      pair<const_iterator, bool>
+      __insert_unique_aux(const key_type& __k, _Args&&... __args)
+      {
+        rb_tree_path __path;
+
+        if ( __find_path(__k, __path) )
+          return pair<const_iterator, bool>(const_iterator(m_impl.m_root, __path), false);
+        link_type __z    = __create_node(std::forward<_Args>(__args)...);
+        base_ptr  __root = m_impl.m_root;
+
+        __update(__root, [&](__share_ops& __ops) { rb_tree_path_insert(__root, __path, __z, __ops); }, __z);
+        ++m_impl.m_size;
+        return pair<const_iterator, bool>(__make_iterator(__z), true);
+      }
+
+      /// @brief Erase the element with key __k from this version.
+      /// @return The private copy of the erased node, still holding its value, which the
+      /// caller destroys; nullptr if there is no such element.
+      link_type
+      __erase_aux(const key_type& __k)
+      {
+        rb_tree_path __path;
+
+        if ( !__find_path(__k, __path) ) return nullptr;
+        base_ptr __root    = m_impl.m_root;
+        base_ptr __removed = nullptr;
+
+        __update(__root, [&](__share_ops& __ops) { __removed = rb_tree_path_erase(__root, __path, __ops); }, nullptr);
+        --m_impl.m_size;
+        return static_cast<link_type>(__removed);
+      }
+
+      /// @brief Record the path to the node of key __k, or to the free slot it would go to.
+      /// @return Whether the key was found; it is then the last node of __path.
+      template <typename _Kt>
+      bool
+      __find_path(const _Kt& __k, rb_tree_path& __path) const
+      {
+        const _Compare& __comp = m_impl.__key_compare();
+
+        for ( base_ptr __x = m_impl.m_root; __x != nullptr; ) {
+          if ( __comp(__k, __key(__x)) ) {
+            __path.__push(__x, false);
+            __x = __x->m_left;
+          } else if ( __comp(__key(__x), __k) ) {
+            __path.__push(__x, true);
+            __x = __x->m_right;
+          } else {
+            __path.__push(__x, false);
+            return true;
+          }
+        }
+        return false;
+      }
+
+      /// @brief Whether an element has a key equivalent to __k: one lower bound descent,
+      /// with a single comparison per level, and no iterator built.
+      template <typename _Kt>
+      bool
+      __contains(const _Kt& __k) const
+      {
+        const _Compare& __comp = m_impl.__key_compare();
+        const_base_ptr  __y    = nullptr;
+
+        for ( const_base_ptr __x = m_impl.m_root; __x != nullptr; ) {
+          if ( !__comp(__key(__x), __k) ) {
+            __y = __x;
+            __x = __x->m_left;
+          } else {
+            __x = __x->m_right;
+          }
+        }
+        return __y != nullptr && !__comp(__k, __key(__y));
+      }
+
+      const_iterator
+      __make_iterator(const_base_ptr __x) const
+      {
+        return const_iterator(m_impl.m_root, __x, &m_impl.__key_compare());
+      }
+
+      static decltype(auto)
+      __key(const_base_ptr __x) { return _KeyOfValue()(*static_cast<const_link_type>(__x)->__valptr()); }
+
+      node_allocator&
+      __get_node_allocator() noexcept { return m_impl; }
+
+      const node_allocator&
+      __get_node_allocator() const noexcept { return m_impl; }
+
+      template <typename... _Args>
+      link_type
+      __create_node(_Args&&... __args)
+      {
+        link_type __p = node_alloc_traits::allocate(__get_node_allocator(), 1);
+
+        try {
+          node_alloc_traits::construct(__get_node_allocator(), __p, std::in_place, std::forward<_Args>(__args)...);
+        } catch ( ... ) {
+          node_alloc_traits::deallocate(__get_node_allocator(), __p, 1);
+          throw;
+        }
+        return __p;
+      }
+
+      void
+      __drop_node(link_type __p) noexcept
+      {
+        node_alloc_traits::destroy(__get_node_allocator(), __p);
+        node_alloc_traits::deallocate(__get_node_allocator(), __p, 1);
+      }
+
+      /// @brief Take a link to __x.
+      static void
+      __retain(base_ptr __x) noexcept
+      {
+        if ( __x != nullptr ) static_cast<link_type>(__x)->m_refs.fetch_add(1, std::memory_order_relaxed);
+      }
+
+      /// @brief Drop a link to __x, which some other link is known to keep alive.
+      static void
+      __unref(base_ptr __x) noexcept
+      {
+        if ( __x != nullptr ) static_cast<link_type>(__x)->m_refs.fetch_sub(1, std::memory_order_relaxed);
+      }
+
+      /// @brief Drop a link to __x, freeing it and dropping its own links if it was the last.
+      void
+      __release(base_ptr __x) noexcept
+      {
+        while ( __x != nullptr
+                && static_cast<link_type>(__x)->m_refs.fetch_sub(1, std::memory_order_acq_rel) == 1 ) {
+          __release(__x->m_right);
+          base_ptr __l = __x->m_left;
+          __drop_node(static_cast<link_type>(__x));
+          __x = __l;
+        }
+      }
+  };
+
+  template <typename _Key, typename _Val, typename _KeyOfValue, typename _Compare, typename _Alloc>
+  inline bool
+  operator==(const persistent_rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>& __x,
+             const persistent_rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>& __y)
+  {
+    return __x.size() == __y.size() && ft::equal(__x.begin(), __x.end(), __y.begin());
+  }
+
+  template <typename _Key, typename _Val, typename _KeyOfValue, typename _Compare, typename _Alloc>
+  inline bool
+  operator<(const persistent_rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>& __x,
+            const persistent_rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>& __y)
+  {
+    return ft::lexicographical_compare(__x.begin(), __x.end(), __y.begin(), __y.end());
+  }
+
+} // namespace ft
+
+#endif // __FT_PERSISTENT_RB_TREE__
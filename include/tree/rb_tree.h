@@ -0,0 +1,2037 @@
+#ifndef   __FT_RB_TREE__
+# define  __FT_RB_TREE__
+
+# include <cstddef>     // For std::size_t, std::ptrdiff_t
+# include <iterator>    // For std::forward_iterator_tag, std::distance
+# include <memory>      // For std::allocator, std::allocator_traits
+# include <type_traits> // For std::true_type, std::false_type, std::integral_constant, std::enable_if_t, std::is_trivially_destructible, std::decay_t
+# include <utility>     // For std::move, std::forward, std::swap, std::in_place
+
+# include "../iterator/iterator.h"            // For ft::reverse_iterator, ft::distance
+# include "../utility/pair.h"                 // For ft::pair
+# include "../algorithm/algorithm.h"          // For ft::equal, ft::lexicographical_compare
+# include "../memory/bulk_release_traits.h"   // For bulk_release_traits
+# include "../memory/prefetch.h"              // For __prefetch
+# include "rb_tree_node.h"                    // For rb_tree_node
+# include "rb_tree_header.h"                  // For rb_tree_header
+# include "rb_tree_instrument.h"              // For rb_tree_stats, rb_tree_counters, FT_RB_TREE_COUNT_IN
+# include "rb_tree_key_compare.h"             // For rb_tree_key_compare
+# include "rb_tree_base_functions.h"          // For rb_tree_insert_and_rebalance, rb_tree_rebalance_for_erase
+# include "rb_tree_iterator.h"                // For rb_tree_iterator, rb_tree_const_iterator
+# include "node_handle.h"                     // For node_handle, node_insert_return
+
+namespace ft {
+
+  /// @brief The pool the parallel members of the front ends take, see "../parallel/work_stealing_pool.h".
+  class work_stealing_pool;
+
+  /// @brief The parallel algorithms of `rb_tree`, run on a `work_stealing_pool`.
+  /// @details Defined in "rb_tree_parallel.h", which only the code calling them includes,
+  /// so that the tree and its front ends do not pull in threads.
+  template <typename _Tree>
+  class rb_tree_parallel;
+
+  /// @brief Runs the two halves of a divide-and-conquer tree algorithm one after the other.
+  /// @details `__next()` is the policy for the calls below them. `rb_tree_parallel` passes
+  /// a policy with the same interface that forks the halves onto a pool instead.
+  struct rb_tree_sequential_fork
+  {
+    template <typename _Fn1, typename _Fn2>
+    void
+    operator()(_Fn1&& __f, _Fn2&& __g) const
+    {
+      __f();
+      __g();
+    }
+
+    rb_tree_sequential_fork
+    __next() const noexcept { return *this; }
+  };
+
+  /// @brief Red-black tree engine shared by the ordered associative containers.
+  /// @details The tree stores values of type `_Val` ordered by the key that `_KeyOfValue`
+  /// extracts from them, compared with `_Compare`. It supports both unique insertion
+  /// (map, set) and equal insertion (multimap, multiset); the front ends choose which.
+  ///
+  /// The header node stored in `rb_tree_header` doubles as the past-the-end node: its
+  /// parent is the root, its left child the leftmost (minimum) node and its right child
+  /// the rightmost (maximum) node, so `begin()` and `--end()` are O(1).
+  ///
+  /// With `FT_INSTRUMENT` defined, the tree counts the comparisons, rotations, recolorings,
+  /// allocations and node visits of its operations, read with `counters()`; otherwise the
+  /// counting compiles to nothing and the tree keeps its size.
+  template <
+    typename _Key,
+    typename _Val,
+    typename _KeyOfValue,
+    typename _Compare,
+    typename _Alloc = std::allocator<_Val>
+  > class rb_tree
+  {
+    protected:
+      using node_allocator    = typename std::allocator_traits<_Alloc>::template rebind_alloc<rb_tree_node<_Val>>;
+      using node_alloc_traits = std::allocator_traits<node_allocator>;
+
+      using base_ptr        = rb_tree_node_base*;
+      using const_base_ptr  = const rb_tree_node_base*;
+      using link_type       = rb_tree_node<_Val>*;
+      using const_link_type = const rb_tree_node<_Val>*;
+
+    public:
+      using key_type        = _Key;             ///< The type of the keys.
+      using value_type      = _Val;             ///< The type of the stored values.
+      using pointer         = value_type*;      ///< Pointer type to the value.
+      using const_pointer   = const value_type*;///< Const pointer type to the value.
+      using reference       = value_type&;      ///< Reference type to the value.
+      using const_reference = const value_type&;///< Const reference type to the value.
+      using size_type       = std::size_t;      ///< Unsigned integer type for sizes.
+      using difference_type = std::ptrdiff_t;   ///< Signed integer type for distances.
+      using allocator_type  = _Alloc;           ///< The allocator type given by the user.
+
+      using iterator               = rb_tree_iterator<value_type>;       ///< Bidirectional iterator.
+      using const_iterator         = rb_tree_const_iterator<value_type>; ///< Constant bidirectional iterator.
+      using reverse_iterator       = ft::reverse_iterator<iterator>;      ///< Reverse iterator.
+      using const_reverse_iterator = ft::reverse_iterator<const_iterator>;///< Constant reverse iterator.
+
+      using node_type          = node_handle<_Key, _Val, node_allocator>;  ///< Owner of an extracted node.
+      using insert_return_type = node_insert_return<iterator, node_type>; ///< Result of inserting a node_type.
+
+    private:
+      template <typename, typename, typename, typename, typename>
+      friend class rb_tree;
+
+      template <typename>
+      friend class rb_tree_parallel;
+
+    private:
+      /// @brief The tree state: node allocator, comparator and header.
+      /// @details Inheriting from the allocator lets stateless allocators take no space.
+      struct rb_tree_impl
+        : public node_allocator,
+          public rb_tree_key_compare<_Compare>,
+          public rb_tree_header
+      {
+        rb_tree_impl()
+          : node_allocator{ }, rb_tree_key_compare<_Compare>{ }, rb_tree_header{ } { }
+
+        rb_tree_impl(const _Compare& __comp, const node_allocator& __a)
+          : node_allocator(__a), rb_tree_key_compare<_Compare>(__comp), rb_tree_header{ } { }
+
+        rb_tree_impl(const rb_tree_impl& __x)
+          : node_allocator(node_alloc_traits::select_on_container_copy_construction(__x)),
+            rb_tree_key_compare<_Compare>(__x.__key_compare()),
+            rb_tree_header{ } { }
+
+        rb_tree_impl(rb_tree_impl&&) = default;
+      };
+
+      rb_tree_impl m_impl; ///< The allocator, comparator and header of the tree.
+# if defined(FT_INSTRUMENT)
+      mutable rb_tree_event_counters m_counters; ///< What the operations on the tree have done.
+# endif
+
+    public:
+      /// @brief Default constructor.
+      rb_tree() = default;
+
+      /// @brief Constructor with a comparator and an allocator.
+      /// @param __comp The key comparison function.
+      /// @param __a The allocator.
+      rb_tree(const _Compare& __comp, const allocator_type& __a = allocator_type())
+        : m_impl(__comp, node_allocator(__a)) { }
+
+      /// @brief Copy constructor.
+      /// @param __x The tree to copy from.
+      rb_tree(const rb_tree& __x)
+        : m_impl(__x.m_impl)
+      {
+        if ( __x.__root() != nullptr ) __set_root(__copy(__x));
+      }
+
+      /// @brief Move constructor.
+      /// @details Steals the nodes of __x, leaving it empty.
+      rb_tree(rb_tree&&) = default;
+
+      /// @brief Destructor.
+      ~rb_tree() noexcept { __erase_all(); }
+
+      /// @brief Copy assignment operator.
+      /// @param __x The tree to copy from.
+      /// @return A reference to this tree.
+      rb_tree&
+      operator=(const rb_tree& __x)
+      {
+        if ( this == &__x ) {
+          return *this;
+        }
+        clear();
+        __alloc_on_copy(__x, typename node_alloc_traits::propagate_on_container_copy_assignment());
+        m_impl.__key_compare() = __x.m_impl.__key_compare();
+        if ( __x.__root() != nullptr ) __set_root(__copy(__x));
+        return *this;
+      }
+
+      /// @brief Move assignment operator.
+      /// @param __x The tree to move from.
+      /// @return A reference to this tree.
+      /// @details Nodes are stolen when the allocators allow it; otherwise the values are copied.
+      rb_tree&
+      operator=(rb_tree&& __x)
+        noexcept(node_alloc_traits::is_always_equal::value &&
+                 std::is_nothrow_move_assignable<_Compare>::value)
+      {
+        m_impl.__key_compare() = std::move(__x.m_impl.__key_compare());
+        __move_assign(__x, std::integral_constant<bool,
+                             node_alloc_traits::propagate_on_container_move_assignment::value ||
+                             node_alloc_traits::is_always_equal::value>());
+        return *this;
+      }
+
+    public:
+      /// @brief Get the key comparison function.
+      _Compare
+      key_comp() const { return m_impl.__key_compare(); }
+
+      /// @brief Get a copy of the allocator.
+      allocator_type
+      get_allocator() const noexcept { return allocator_type(__get_node_allocator()); }
+
+    public:
+      iterator
+      begin() noexcept { return iterator(m_impl.m_header.m_left); }
+
+      const_iterator
+      begin() const noexcept { return const_iterator(m_impl.m_header.m_left); }
+
+      iterator
+      end() noexcept { return iterator(&m_impl.m_header); }
+
+      const_iterator
+      end() const noexcept { return const_iterator(&m_impl.m_header); }
+
+      reverse_iterator
+      rbegin() noexcept { return reverse_iterator(end()); }
+
+      const_reverse_iterator
+      rbegin() const noexcept { return const_reverse_iterator(end()); }
+
+      reverse_iterator
+      rend() noexcept { return reverse_iterator(begin()); }
+
+      const_reverse_iterator
+      rend() const noexcept { return const_reverse_iterator(begin()); }
+
+    public:
+      bool
+      empty() const noexcept { return m_impl.m_nodeCount == 0; }
+
+      size_type
+      size() const noexcept { return m_impl.m_nodeCount; }
+
+      size_type
+      max_size() const noexcept { return node_alloc_traits::max_size(__get_node_allocator()); }
+
+    public:
+      /// @brief Insert a value if no element with an equivalent key exists.
+      /// @param __v The value to insert.
+      /// @return An iterator to the element with the key of __v, and whether insertion took place.
+      /// @details The node is only created once the key is known to be absent.
+      pair<iterator, bool>
+      __insert_unique(const value_type& __v) { return __insert_unique_aux(__v); }
+
+      pair<iterator, bool>
+      __insert_unique(value_type&& __v) { return __insert_unique_aux(std::move(__v)); }
+
+      /// @brief Insert a value, after any elements with an equivalent key.
+      /// @param __v The value to insert.
+      /// @return An iterator to the new element.
+      iterator
+      __insert_equal(const value_type& __v) { return __insert_equal_aux(__v); }
+
+      iterator
+      __insert_equal(value_type&& __v) { return __insert_equal_aux(std::move(__v)); }
+
+      /// @brief Construct a value in place and insert it if its key is not present yet.
+      /// @param __args The arguments forwarded to the constructor of the value.
+      /// @return An iterator to the element with that key, and whether insertion took place.
+      /// @details The value is built directly in node storage; the node is destroyed again
+      /// if an element with an equivalent key already exists.
+      template <typename... _Args>
+      pair<iterator, bool>
+      __emplace_unique(_Args&&... __args)
+      {
+        link_type __z = __create_node(std::forward<_Args>(__args)...);
+
+        try {
+          pair<base_ptr, base_ptr> __res = __get_insert_unique_pos(__key(__z));
+
+          if ( __res.second != nullptr )
+            return pair<iterator, bool>(__insert_node(__res.first, __res.second, __z), true);
+          __drop_node(__z);
+          return pair<iterator, bool>(iterator(__res.first), false);
+        } catch ( ... ) {
+          __drop_node(__z);
+          throw;
+        }
+      }
+
+      /// @brief Construct a value in place and insert it after any equivalent elements.
+      /// @param __args The arguments forwarded to the constructor of the value.
+      /// @return An iterator to the new element.
+      template <typename... _Args>
+      iterator
+      __emplace_equal(_Args&&... __args)
+      {
+        link_type __z = __create_node(std::forward<_Args>(__args)...);
+
+        try {
+          pair<base_ptr, base_ptr> __res = __get_insert_equal_pos(__key(__z));
+          return __insert_node(__res.first, __res.second, __z);
+        } catch ( ... ) {
+          __drop_node(__z);
+          throw;
+        }
+      }
+
+      /// @brief Insert a value near a hint if no element with an equivalent key exists.
+      /// @param __pos A hint for the position of the new element.
+      /// @param __v The value to insert.
+      /// @return An iterator to the element with the key of __v.
+      /// @details The insertion is O(1) amortized when __v belongs right before __pos, or
+      /// right after it; otherwise it falls back to a full descent.
+      iterator
+      __insert_unique(const_iterator __pos, const value_type& __v) { return __insert_hint_unique_aux(__pos, __v); }
+
+      iterator
+      __insert_unique(const_iterator __pos, value_type&& __v) { return __insert_hint_unique_aux(__pos, std::move(__v)); }
+
+      /// @brief Insert a value near a hint, keeping duplicate keys.
+      /// @param __pos A hint for the position of the new element.
+      /// @param __v The value to insert.
+      /// @return An iterator to the new element.
+      iterator
+      __insert_equal(const_iterator __pos, const value_type& __v) { return __insert_hint_equal_aux(__pos, __v); }
+
+      iterator
+      __insert_equal(const_iterator __pos, value_type&& __v) { return __insert_hint_equal_aux(__pos, std::move(__v)); }
+
+      /// @brief Construct a value in place near a hint, refusing duplicate keys.
+      /// @param __pos A hint for the position of the new element.
+      /// @return An iterator to the element with the key of the new value.
+      template <typename... _Args>
+      iterator
+      __emplace_hint_unique(const_iterator __pos, _Args&&... __args)
+      {
+        link_type __z = __create_node(std::forward<_Args>(__args)...);
+
+        try {
+          pair<base_ptr, base_ptr> __res = __get_insert_hint_unique_pos(__pos, __key(__z));
+
+          if ( __res.second != nullptr )
+            return __insert_node(__res.first, __res.second, __z);
+          __drop_node(__z);
+          return iterator(__res.first);
+        } catch ( ... ) {
+          __drop_node(__z);
+          throw;
+        }
+      }
+
+      /// @brief Construct a value in place near a hint, keeping duplicate keys.
+      /// @param __pos A hint for the position of the new element.
+      /// @return An iterator to the new element.
+      template <typename... _Args>
+      iterator
+      __emplace_hint_equal(const_iterator __pos, _Args&&... __args)
+      {
+        link_type __z = __create_node(std::forward<_Args>(__args)...);
+
+        try {
+          pair<base_ptr, base_ptr> __res = __get_insert_hint_equal_pos(__pos, __key(__z));
+          return __insert_node(__res.first, __res.second, __z);
+        } catch ( ... ) {
+          __drop_node(__z);
+          throw;
+        }
+      }
+
+      /// @brief Construct a value in place only if no element has the key __k.
+      /// @param __k The key the new value will have.
+      /// @param __args The arguments forwarded to the constructor of the value.
+      /// @return An iterator to the element with key __k, and whether insertion took place.
+      /// @details The position is found from __k before any node is created, so nothing is
+      /// constructed, and no argument moved from, when the key already exists.
+      template <typename... _Args>
+      pair<iterator, bool>
+      __try_emplace_unique(const key_type& __k, _Args&&... __args)
+      {
+        pair<base_ptr, base_ptr> __res = __get_insert_unique_pos(__k);
+
+        if ( __res.second == nullptr )
+          return pair<iterator, bool>(iterator(__res.first), false);
+        return pair<iterator, bool>(__insert_node(__res.first, __res.second,
+                                                  __create_node(std::forward<_Args>(__args)...)), true);
+      }
+
+      /// @brief Like `__try_emplace_unique`, using __pos as a hint for the position.
+      template <typename... _Args>
+      iterator
+      __try_emplace_hint_unique(const_iterator __pos, const key_type& __k, _Args&&... __args)
+      {
+        pair<base_ptr, base_ptr> __res = __get_insert_hint_unique_pos(__pos, __k);
+
+        if ( __res.second == nullptr )
+          return iterator(__res.first);
+        return __insert_node(__res.first, __res.second, __create_node(std::forward<_Args>(__args)...));
+      }
+
+      /// @brief Insert every value of a range, skipping duplicate keys.
+      /// @details Every value is hinted at `end()`, so sorted input is appended in O(1)
+      /// amortized per element.
+      template <typename _InputIterator>
+      void
+      __insert_range_unique(_InputIterator __first, _InputIterator __last)
+      {
+        for ( ; __first != __last; ++__first )
+          __insert_unique(end(), *__first);
+      }
+
+      /// @brief Insert every value of a range, keeping duplicate keys.
+      /// @details Every value is hinted at `end()`, see `__insert_range_unique`.
+      template <typename _InputIterator>
+      void
+      __insert_range_equal(_InputIterator __first, _InputIterator __last)
+      {
+        for ( ; __first != __last; ++__first )
+          __insert_equal(end(), *__first);
+      }
+
+      /// @brief Replace the contents with the values of a sorted range, in linear time.
+      /// @param __first The beginning of the range.
+      /// @param __last The end of the range.
+      /// @details The range must be sorted by key and, for the unique front ends, free of
+      /// equivalent keys; this is not checked. The tree is built bottom-up as a perfectly
+      /// balanced tree whose colors are computed from the depth, so no comparison and no
+      /// rebalancing takes place. The length of the range is taken with `ft::distance`,
+      /// which is O(1) for random access iterators.
+      template <typename _ForwardIterator>
+      void
+      assign_sorted(_ForwardIterator __first, _ForwardIterator __last)
+      {
+        clear();
+        __build_sorted(__first, static_cast<size_type>(__range_length(__first, __last)));
+      }
+
+      /// @brief Replace the contents with the values of a range, skipping duplicate keys.
+      /// @details Forward ranges of `value_type` are checked for strictly increasing keys in
+      /// one pass and built in linear time when they are; other ranges are inserted one by one.
+      template <typename _InputIterator>
+      void
+      __assign_range_unique(_InputIterator __first, _InputIterator __last)
+      {
+        clear();
+        __assign_range(__first, __last, true, __sorted_build_t<_InputIterator>());
+      }
+
+      /// @brief Replace the contents with the values of a range, keeping duplicate keys.
+      /// @details Like `__assign_range_unique`, with non-decreasing keys accepted as sorted.
+      template <typename _InputIterator>
+      void
+      __assign_range_equal(_InputIterator __first, _InputIterator __last)
+      {
+        clear();
+        __assign_range(__first, __last, false, __sorted_build_t<_InputIterator>());
+      }
+
+      /// @brief Add the elements of __x whose keys are not present yet, leaving __x empty.
+      /// @param __x The other tree, ordered by an equivalent comparator.
+      /// @details With equal allocators the nodes of __x are relinked, never copied: the
+      /// smaller recursion splits __x around the root of this tree, unions the halves with
+      /// the two subtrees, and joins the results back around the root. Nodes of __x with a
+      /// key already present are destroyed. With unequal allocators the values of __x are
+      /// moved in one by one. The comparator must not throw.
+      void
+      __union_unique(rb_tree& __x) { __union_unique(__x, rb_tree_sequential_fork()); }
+
+      /// @brief Like `__union_unique`, with the two recursive calls, which touch disjoint
+      /// nodes, run by __fork; see `rb_tree_parallel` for the parallel policy.
+      template <typename _Fork>
+      void
+      __union_unique(rb_tree& __x, const _Fork& __fork)
+      {
+        if ( this == &__x ) return;
+        if ( !( __get_node_allocator() == __x.__get_node_allocator() ) ) {
+          for ( iterator __i = __x.begin(); __i != __x.end(); ++__i )
+            __insert_unique(std::move(*__i));
+          __x.clear();
+          return;
+        }
+
+        size_type __dropped = 0;
+        const size_type __n = size() + __x.size();
+        link_type __t = __union(__detach_root(), __x.__detach_root(), __dropped, __fork);
+        __attach_root(__t, __n - __dropped);
+      }
+
+      /// @brief Keep only the elements whose keys are also in __x, leaving __x empty.
+      /// @details Same scheme as `__union_unique`; a root without a match in __x is dropped
+      /// and its two subtrees are concatenated. Every node of __x is destroyed.
+      void
+      __intersect_unique(rb_tree& __x) { __intersect_unique(__x, rb_tree_sequential_fork()); }
+
+      template <typename _Fork>
+      void
+      __intersect_unique(rb_tree& __x, const _Fork& __fork)
+      {
+        if ( this == &__x ) return;
+        if ( !( __get_node_allocator() == __x.__get_node_allocator() ) ) {
+          for ( iterator __i = begin(); __i != end(); )
+            if ( __x.find(__key(__i.m_node)) == __x.end() ) erase(__i++);
+            else ++__i;
+          __x.clear();
+          return;
+        }
+
+        size_type __dropped = 0;
+        const size_type __n = size();
+        link_type __t = __intersect(__detach_root(), __x.__detach_root(), __dropped, __fork);
+        __attach_root(__t, __n - __dropped);
+      }
+
+      /// @brief Erase the elements whose keys are in __x, leaving __x empty.
+      /// @details This tree is split around the root of __x, the halves are reduced by its
+      /// subtrees and concatenated. Every node of __x is destroyed.
+      void
+      __difference_unique(rb_tree& __x) { __difference_unique(__x, rb_tree_sequential_fork()); }
+
+      template <typename _Fork>
+      void
+      __difference_unique(rb_tree& __x, const _Fork& __fork)
+      {
+        if ( this == &__x ) {
+          clear();
+          return;
+        }
+        if ( !( __get_node_allocator() == __x.__get_node_allocator() ) ) {
+          for ( iterator __i = __x.begin(); __i != __x.end(); ++__i )
+            erase(__key(__i.m_node));
+          __x.clear();
+          return;
+        }
+
+        size_type __dropped = 0;
+        const size_type __n = size();
+        link_type __t = __difference(__detach_root(), __x.__detach_root(), __dropped, __fork);
+        __attach_root(__t, __n - __dropped);
+      }
+
+    public:
+      /// @brief Unlink the element at __pos and hand its node over.
+      /// @return A node handle owning the node; no value is copied and no memory released.
+      node_type
+      __extract(const_iterator __pos)
+      {
+        FT_RB_TREE_COUNT_SCOPE(m_counters);
+        base_ptr __p = rb_tree_rebalance_for_erase(__pos.__const_cast().m_node, m_impl.m_header);
+
+        --m_impl.m_nodeCount;
+        return node_type(static_cast<link_type>(__p), __get_node_allocator());
+      }
+
+      /// @brief Unlink the first element with a key equivalent to __k.
+      /// @return A node handle owning its node, or an empty handle if there is none.
+      node_type
+      __extract(const key_type& __k)
+      {
+        iterator __i = find(__k);
+        return __i == end() ? node_type() : __extract(const_iterator(__i));
+      }
+
+      /// @brief Link the node of __nh if no element with an equivalent key exists.
+      /// @return The position of the element with that key, whether the node was inserted,
+      /// and the node handle back if it was not.
+      insert_return_type
+      __reinsert_node_unique(node_type&& __nh)
+      {
+        insert_return_type __ret;
+
+        if ( __nh.empty() ) {
+          __ret.position = end();
+          return __ret;
+        }
+
+        pair<base_ptr, base_ptr> __res = __get_insert_unique_pos(__key(__nh.__node()));
+        if ( __res.second != nullptr ) {
+          __ret.position = __insert_node_handle(__res.first, __res.second, __nh);
+          __ret.inserted = true;
+        } else {
+          __ret.position = iterator(__res.first);
+          __ret.node     = std::move(__nh);
+        }
+        return __ret;
+      }
+
+      /// @brief Link the node of __nh after any elements with an equivalent key.
+      /// @return An iterator to the inserted element, or end() if __nh is empty.
+      iterator
+      __reinsert_node_equal(node_type&& __nh)
+      {
+        if ( __nh.empty() ) return end();
+
+        pair<base_ptr, base_ptr> __res = __get_insert_equal_pos(__key(__nh.__node()));
+        return __insert_node_handle(__res.first, __res.second, __nh);
+      }
+
+      /// @brief Like `__reinsert_node_unique`, using __pos as a hint for the position.
+      /// @details __nh keeps its node if an element with an equivalent key exists.
+      iterator
+      __reinsert_node_hint_unique(const_iterator __pos, node_type&& __nh)
+      {
+        if ( __nh.empty() ) return end();
+
+        pair<base_ptr, base_ptr> __res = __get_insert_hint_unique_pos(__pos, __key(__nh.__node()));
+        if ( __res.second != nullptr )
+          return __insert_node_handle(__res.first, __res.second, __nh);
+        return iterator(__res.first);
+      }
+
+      /// @brief Like `__reinsert_node_equal`, using __pos as a hint for the position.
+      iterator
+      __reinsert_node_hint_equal(const_iterator __pos, node_type&& __nh)
+      {
+        if ( __nh.empty() ) return end();
+
+        pair<base_ptr, base_ptr> __res = __get_insert_hint_equal_pos(__pos, __key(__nh.__node()));
+        return __insert_node_handle(__res.first, __res.second, __nh);
+      }
+
+      /// @brief Move the elements of __src whose keys are not present here into this tree.
+      /// @param __src A tree of the same value type, ordered by any comparator.
+      /// @details With equal allocators the nodes are unlinked from __src and relinked here,
+      /// without copying values or touching the allocator. Otherwise the values are moved
+      /// into new nodes. Elements with a key already present stay in __src.
+      template <typename _Compare2>
+      void
+      __merge_unique(rb_tree<_Key, _Val, _KeyOfValue, _Compare2, _Alloc>& __src)
+      {
+        if ( static_cast<void*>(&__src) == static_cast<void*>(this) ) return;
+
+        for ( iterator __i = __src.begin(); __i != __src.end(); ) {
+          iterator __cur = __i++;
+          pair<base_ptr, base_ptr> __res = __get_insert_unique_pos(__key(__cur.m_node));
+
+          if ( __res.second != nullptr )
+            __insert_node(__res.first, __res.second, __take_node(__src, __cur));
+        }
+      }
+
+      /// @brief Move every element of __src into this tree, after any equivalent elements.
+      /// @details See `__merge_unique`.
+      template <typename _Compare2>
+      void
+      __merge_equal(rb_tree<_Key, _Val, _KeyOfValue, _Compare2, _Alloc>& __src)
+      {
+        if ( static_cast<void*>(&__src) == static_cast<void*>(this) ) return;
+
+        for ( iterator __i = __src.begin(); __i != __src.end(); ) {
+          iterator __cur = __i++;
+          pair<base_ptr, base_ptr> __res = __get_insert_equal_pos(__key(__cur.m_node));
+
+          __insert_node(__res.first, __res.second, __take_node(__src, __cur));
+        }
+      }
+
+    public:
+      /// @brief Erase the element at a position.
+      /// @return An iterator to the element following the erased one.
+      iterator
+      erase(const_iterator __position)
+      {
+        iterator __result(rb_tree_increment(__position.__const_cast().m_node));
+        __erase_aux(__position);
+        return __result;
+      }
+
+      /// @brief Erase the element at a position.
+      /// @return An iterator to the element following the erased one.
+      iterator
+      erase(iterator __position)
+      {
+        iterator __result(rb_tree_increment(__position.m_node));
+        __erase_aux(__position);
+        return __result;
+      }
+
+      /// @brief Erase every element with a key equivalent to __k.
+      /// @return The number of erased elements.
+      size_type
+      erase(const key_type& __k)
+      {
+        pair<iterator, iterator> __p = equal_range(__k);
+        const size_type __old_size = size();
+
+        __erase_aux(__p.first, __p.second);
+        return __old_size - size();
+      }
+
+      /// @brief Erase the elements in [__first, __last).
+      /// @return An iterator to the element following the last erased one.
+      iterator
+      erase(const_iterator __first, const_iterator __last)
+      {
+        __erase_aux(__first, __last);
+        return __last.__const_cast();
+      }
+
+      /// @brief Erase every element.
+      void
+      clear() noexcept
+      {
+        __erase_all();
+        m_impl.__reset();
+      }
+
+      /// @brief Swap the contents with another tree.
+      /// @param __t The tree to swap with.
+      void
+      swap(rb_tree& __t) noexcept(std::is_nothrow_swappable<_Compare>::value)
+      {
+        if ( __root() == nullptr ) {
+          if ( __t.__root() != nullptr ) m_impl.__move_data(__t.m_impl);
+        } else if ( __t.__root() == nullptr ) {
+          __t.m_impl.__move_data(m_impl);
+        } else {
+          base_ptr __r = __root();
+          __set_root(__t.__root());
+          __t.__set_root(__r);
+          std::swap(__leftmost(), __t.__leftmost());
+          std::swap(__rightmost(), __t.__rightmost());
+
+          __root()->__set_parent(__end());
+          __t.__root()->__set_parent(__t.__end());
+          std::swap(m_impl.m_nodeCount, __t.m_impl.m_nodeCount);
+          m_impl.__thread_ends();
+          __t.m_impl.__thread_ends();
+        }
+        std::swap(m_impl.__key_compare(), __t.m_impl.__key_compare());
+        __alloc_on_swap(__t, typename node_alloc_traits::propagate_on_container_swap());
+      }
+
+    private:
+      /// @brief SFINAE helper enabling the heterogeneous lookups, if the comparator is transparent.
+      /// @details Other comparators get the `const key_type&` overloads only, so that arguments
+      /// converting to the key type are accepted as they are by `std::map`.
+      template <typename _Kt>
+      using __lookup_t = has_is_transparent_t<_Compare, _Kt>;
+
+# if defined(FT_RB_TREE_ORDER_STATISTICS)
+    public:
+      /// @brief Get the number of elements before __pos.
+      /// @details O(log n); `size()` for `end()`.
+      size_type
+      rank(const_iterator __pos) const noexcept { return rb_tree_rank(__pos.m_node); }
+
+      /// @brief Get the element at position __k in key order, counted from zero.
+      /// @return An iterator to the element, or end() if __k is not less than size(). O(log n).
+      iterator
+      select(size_type __k) noexcept
+      {
+        base_ptr __x = rb_tree_select(__root(), __k);
+        return __x == nullptr ? end() : iterator(__x);
+      }
+
+      const_iterator
+      select(size_type __k) const noexcept
+      {
+        const_base_ptr __x = rb_tree_select(const_cast<base_ptr>(__root()), __k);
+        return __x == nullptr ? end() : const_iterator(__x);
+      }
+
+      /// @brief Count the elements whose keys lie in [__a, __b).
+      /// @details Two descents and two ranks, O(log n) whatever the size of the range.
+      size_type
+      count_range(const key_type& __a, const key_type& __b) const { return __count_range(__a, __b); }
+
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      size_type
+      count_range(const _Kt& __a, const _Kt& __b) const { return __count_range(__a, __b); }
+
+    private:
+      template <typename _Kt>
+      size_type
+      __count_range(const _Kt& __a, const _Kt& __b) const
+      {
+        if ( !__compare(__a, __b) ) return 0;
+        return rank(__lower_bound(__begin(), __end(), __b)) - rank(__lower_bound(__begin(), __end(), __a));
+      }
+# endif
+
+    public:
+      /// @brief Find an element with a key equivalent to __k.
+      /// @return An iterator to the element, or end() if there is none.
+      /// @details The template overloads of the lookups take any type the comparator
+      /// accepts, and are only available when it is transparent.
+      iterator
+      find(const key_type& __k) { return __find(__k); }
+
+      const_iterator
+      find(const key_type& __k) const { return __find(__k); }
+
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      iterator
+      find(const _Kt& __k) { return __find(__k); }
+
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      const_iterator
+      find(const _Kt& __k) const { return __find(__k); }
+
+      /// @brief Count the elements with a key equivalent to __k.
+      size_type
+      count(const key_type& __k) const { return __count(__k); }
+
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      size_type
+      count(const _Kt& __k) const { return __count(__k); }
+
+      /// @brief Get the first element whose key is not less than __k.
+      iterator
+      lower_bound(const key_type& __k) { return __lower_bound(__begin(), __end(), __k); }
+
+      const_iterator
+      lower_bound(const key_type& __k) const { return __lower_bound(__begin(), __end(), __k); }
+
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      iterator
+      lower_bound(const _Kt& __k) { return __lower_bound(__begin(), __end(), __k); }
+
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      const_iterator
+      lower_bound(const _Kt& __k) const { return __lower_bound(__begin(), __end(), __k); }
+
+      /// @brief Get the first element whose key is greater than __k.
+      iterator
+      upper_bound(const key_type& __k) { return __upper_bound(__begin(), __end(), __k); }
+
+      const_iterator
+      upper_bound(const key_type& __k) const { return __upper_bound(__begin(), __end(), __k); }
+
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      iterator
+      upper_bound(const _Kt& __k) { return __upper_bound(__begin(), __end(), __k); }
+
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      const_iterator
+      upper_bound(const _Kt& __k) const { return __upper_bound(__begin(), __end(), __k); }
+
+      /// @brief Get the range of elements with a key equivalent to __k.
+      pair<iterator, iterator>
+      equal_range(const key_type& __k) { return __equal_range(__k); }
+
+      pair<const_iterator, const_iterator>
+      equal_range(const key_type& __k) const { return __equal_range(__k); }
+
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      pair<iterator, iterator>
+      equal_range(const _Kt& __k) { return __equal_range(__k); }
+
+      template <typename _Kt, typename = __lookup_t<_Kt>>
+      pair<const_iterator, const_iterator>
+      equal_range(const _Kt& __k) const { return __equal_range(__k); }
+
+    private:
+      template <typename _Kt>
+      iterator
+      __find(const _Kt& __k)
+      {
+        iterator __j = __lower_bound(__begin(), __end(), __k);
+        return ( __j == end() || __compare(__k, __key(__j.m_node)) ) ? end() : __j;
+      }
+
+      template <typename _Kt>
+      const_iterator
+      __find(const _Kt& __k) const
+      {
+        const_iterator __j = __lower_bound(__begin(), __end(), __k);
+        return ( __j == end() || __compare(__k, __key(__j.m_node)) ) ? end() : __j;
+      }
+
+      template <typename _Kt>
+      size_type
+      __count(const _Kt& __k) const
+      {
+        pair<const_iterator, const_iterator> __p = __equal_range(__k);
+        return static_cast<size_type>(ft::distance(__p.first, __p.second));
+      }
+
+      /// @brief Get the range of elements with a key equivalent to __k.
+      /// @details The descent is shared until the first node equivalent to __k is found,
+      /// then the two bounds are searched in its left and right subtrees.
+      template <typename _Kt>
+      pair<iterator, iterator>
+      __equal_range(const _Kt& __k)
+      {
+        link_type __x = __begin();
+        base_ptr  __y = __end();
+
+        while ( __x != nullptr ) {
+          if ( __compare(__key(__x), __k) ) {
+            __x = __right(__x);
+          } else if ( __compare(__k, __key(__x)) ) {
+            __y = __x;
+            __x = __left(__x);
+          } else {
+            link_type __xu = __right(__x);
+            base_ptr  __yu = __y;
+            __y = __x;
+            __x = __left(__x);
+            return pair<iterator, iterator>(__lower_bound(__x, __y, __k), __upper_bound(__xu, __yu, __k));
+          }
+        }
+        return pair<iterator, iterator>(iterator(__y), iterator(__y));
+      }
+
+      template <typename _Kt>
+      pair<const_iterator, const_iterator>
+      __equal_range(const _Kt& __k) const
+      {
+        const_link_type __x = __begin();
+        const_base_ptr  __y = __end();
+
+        while ( __x != nullptr ) {
+          if ( __compare(__key(__x), __k) ) {
+            __x = __right(__x);
+          } else if ( __compare(__k, __key(__x)) ) {
+            __y = __x;
+            __x = __left(__x);
+          } else {
+            const_link_type __xu = __right(__x);
+            const_base_ptr  __yu = __y;
+            __y = __x;
+            __x = __left(__x);
+            return pair<const_iterator, const_iterator>(__lower_bound(__x, __y, __k), __upper_bound(__xu, __yu, __k));
+          }
+        }
+        return pair<const_iterator, const_iterator>(const_iterator(__y), const_iterator(__y));
+      }
+
+    public:
+      /// @brief The number of descents `find_many` and `lower_bound_many` run side by side.
+      static constexpr std::size_t batch_lookup_width = 8;
+
+      /// @brief Look up a batch of keys, writing `find(__k)` for each of them to __out.
+      /// @param __first The beginning of the range of keys.
+      /// @param __last The end of the range of keys.
+      /// @param __out Receives one iterator per key, in the order of the keys.
+      /// @return __out past the last iterator written.
+      /// @details A single lookup in a large tree waits on one cache miss per level, since
+      /// each child pointer is only known once its parent is loaded. Here the keys are
+      /// searched `batch_lookup_width` at a time and their descents advance one level each
+      /// in turn, prefetching the next node of every descent, so the misses of the batch
+      /// overlap instead of adding up. The results are those of repeated `find`.
+      template <typename _ForwardIterator, typename _OutputIterator>
+      _OutputIterator
+      find_many(_ForwardIterator __first, _ForwardIterator __last, _OutputIterator __out)
+      {
+        __descend_many(__first, __last, [this, &__out](const auto& __k, const_base_ptr __y) {
+          *__out++ = __is_match(__y, __k) ? iterator(const_cast<base_ptr>(__y)) : end();
+        });
+        return __out;
+      }
+
+      template <typename _ForwardIterator, typename _OutputIterator>
+      _OutputIterator
+      find_many(_ForwardIterator __first, _ForwardIterator __last, _OutputIterator __out) const
+      {
+        __descend_many(__first, __last, [this, &__out](const auto& __k, const_base_ptr __y) {
+          *__out++ = __is_match(__y, __k) ? const_iterator(__y) : end();
+        });
+        return __out;
+      }
+
+      /// @brief Look up a batch of keys, writing `lower_bound(__k)` for each of them to __out.
+      /// @details See `find_many`.
+      template <typename _ForwardIterator, typename _OutputIterator>
+      _OutputIterator
+      lower_bound_many(_ForwardIterator __first, _ForwardIterator __last, _OutputIterator __out)
+      {
+        __descend_many(__first, __last, [&__out](const auto&, const_base_ptr __y) {
+          *__out++ = iterator(const_cast<base_ptr>(__y));
+        });
+        return __out;
+      }
+
+      template <typename _ForwardIterator, typename _OutputIterator>
+      _OutputIterator
+      lower_bound_many(_ForwardIterator __first, _ForwardIterator __last, _OutputIterator __out) const
+      {
+        __descend_many(__first, __last, [&__out](const auto&, const_base_ptr __y) {
+          *__out++ = const_iterator(__y);
+        });
+        return __out;
+      }
+
+    public:
+      /// @brief Measure the shape of the tree.
+      /// @details One walk over every node, O(n) time and O(height) extra space.
+      rb_tree_stats
+      stats() const
+      {
+        using __entry = ft::pair<const_base_ptr, size_type>; // A node and its depth.
+
+        rb_tree_stats __s;
+        __entry       __stack[2 * sizeof(size_type) * 8 + 1]; // Red-black height is below 2 log2(n + 1).
+        size_type     __top = 0;
+
+        __s.node_count   = m_impl.m_nodeCount;
+        __s.black_height = rb_tree_black_height(__root());
+        __s.bytes        = sizeof(*this) + m_impl.m_nodeCount * sizeof(rb_tree_node<_Val>);
+        if ( __root() != nullptr ) __stack[__top++] = __entry(__root(), 0);
+        while ( __top != 0 ) {
+          const __entry __n = __stack[--__top];
+
+          if ( __s.depth_histogram.size() <= __n.second ) __s.depth_histogram.resize(__n.second + 1, 0);
+          ++__s.depth_histogram[__n.second];
+          if ( __n.first->m_left != nullptr ) __stack[__top++] = __entry(__n.first->m_left, __n.second + 1);
+          if ( __n.first->m_right != nullptr ) __stack[__top++] = __entry(__n.first->m_right, __n.second + 1);
+        }
+        __s.height = __s.depth_histogram.size();
+        return __s;
+      }
+
+# if defined(FT_INSTRUMENT)
+      /// @brief Get what the operations on the tree have done since it was built or reset.
+      rb_tree_counters
+      counters() const noexcept { return m_counters.__snapshot(); }
+
+      /// @brief Set the counts of `counters()` back to zero.
+      void
+      reset_counters() noexcept { m_counters.__reset(); }
+# endif
+
+      /// @brief Check the red-black invariants and the header links.
+      /// @return True if the tree is a valid red-black tree.
+      /// @details Intended for debugging; runs in O(n).
+      bool
+      __rb_verify() const
+      {
+        if ( m_impl.m_nodeCount == 0 || begin() == end() ) {
+          return m_impl.m_nodeCount == 0 && begin() == end()
+              && m_impl.m_header.m_left == __end() && m_impl.m_header.m_right == __end();
+        }
+
+        const unsigned int __len = rb_tree_black_count(__leftmost(), __root());
+# if defined(FT_RB_TREE_THREADED_NODE)
+        size_type __visited = 0;
+        if ( m_impl.m_header.m_next != __leftmost() || m_impl.m_header.m_prev != __rightmost() ) return false;
+# endif
+        for ( const_iterator __it = begin(); __it != end(); ++__it ) {
+          const_link_type __x = static_cast<const_link_type>(__it.m_node);
+          const_link_type __L = __left(__x);
+          const_link_type __R = __right(__x);
+# if defined(FT_RB_TREE_THREADED_NODE)
+          // The thread must agree with the structural successor.
+          const_base_ptr __s = __R;
+          if ( __s != nullptr ) {
+            __s = rb_tree_node_base::minimum(__R);
+          } else {
+            const_base_ptr __c = __x;
+            __s = __x->__parent();
+            while ( __s != __end() && __c == __s->m_right ) {
+              __c = __s;
+              __s = __s->__parent();
+            }
+          }
+          if ( __x->m_next != __s || __s->m_prev != __x || ++__visited > m_impl.m_nodeCount ) return false;
+# endif
+
+          if ( __x->__color() == rb_tree_color::red ) {
+            if ( (__L != nullptr && __L->__color() == rb_tree_color::red) ||
+                 (__R != nullptr && __R->__color() == rb_tree_color::red) )
+              return false;
+          }
+          if ( __L != nullptr && __compare(__key(__x), __key(__L)) ) return false;
+          if ( __R != nullptr && __compare(__key(__R), __key(__x)) ) return false;
+          if ( __L == nullptr && __R == nullptr && rb_tree_black_count(__x, __root()) != __len )
+            return false;
+# if defined(FT_RB_TREE_ORDER_STATISTICS)
+          if ( __x->m_size != rb_tree_subtree_size(__L) + rb_tree_subtree_size(__R) + 1 ) return false;
+# endif
+        }
+
+        if ( __leftmost() != rb_tree_node_base::minimum(__root()) ) return false;
+        if ( __rightmost() != rb_tree_node_base::maximum(__root()) ) return false;
+# if defined(FT_RB_TREE_ORDER_STATISTICS)
+        if ( rb_tree_subtree_size(__root()) != m_impl.m_nodeCount ) return false;
+# endif
+# if defined(FT_RB_TREE_THREADED_NODE)
+        if ( __visited != m_impl.m_nodeCount ) return false;
+# endif
+        return true;
+      }
+
+    protected:
+      node_allocator&
+      __get_node_allocator() noexcept { return m_impl; }
+
+      const node_allocator&
+      __get_node_allocator() const noexcept { return m_impl; }
+
+      base_ptr
+      __root() noexcept { return m_impl.m_header.__parent(); }
+
+      const_base_ptr
+      __root() const noexcept { return m_impl.m_header.__parent(); }
+
+      void
+      __set_root(base_ptr __x) noexcept { m_impl.m_header.__set_parent(__x); }
+
+      base_ptr&
+      __leftmost() noexcept { return m_impl.m_header.m_left; }
+
+      const_base_ptr
+      __leftmost() const noexcept { return m_impl.m_header.m_left; }
+
+      base_ptr&
+      __rightmost() noexcept { return m_impl.m_header.m_right; }
+
+      const_base_ptr
+      __rightmost() const noexcept { return m_impl.m_header.m_right; }
+
+      link_type
+      __begin() noexcept { return static_cast<link_type>(m_impl.m_header.__parent()); }
+
+      const_link_type
+      __begin() const noexcept { return static_cast<const_link_type>(m_impl.m_header.__parent()); }
+
+      base_ptr
+      __end() noexcept { return &m_impl.m_header; }
+
+      const_base_ptr
+      __end() const noexcept { return &m_impl.m_header; }
+
+      /// @brief Read the key of a node, counted as a node visit when instrumented.
+      const _Key&
+      __key(const_base_ptr __x) const
+      {
+        FT_RB_TREE_COUNT_IN(m_counters, node_visit);
+        return _KeyOfValue()(*static_cast<const_link_type>(__x)->__valptr());
+      }
+
+      /// @brief Compare two keys with the comparator of the tree, counted when instrumented.
+      template <typename _K1, typename _K2>
+      bool
+      __compare(const _K1& __a, const _K2& __b) const
+      {
+        FT_RB_TREE_COUNT_IN(m_counters, comparison);
+        return m_impl.__key_compare()(__a, __b);
+      }
+
+      static link_type
+      __left(base_ptr __x) noexcept { return static_cast<link_type>(__x->m_left); }
+
+      static const_link_type
+      __left(const_base_ptr __x) noexcept { return static_cast<const_link_type>(__x->m_left); }
+
+      static link_type
+      __right(base_ptr __x) noexcept { return static_cast<link_type>(__x->m_right); }
+
+      static const_link_type
+      __right(const_base_ptr __x) noexcept { return static_cast<const_link_type>(__x->m_right); }
+
+    protected:
+      /// @brief Allocate memory for one node.
+      link_type
+      __get_node()
+      {
+        FT_RB_TREE_COUNT_IN(m_counters, allocation);
+        return node_alloc_traits::allocate(__get_node_allocator(), 1);
+      }
+
+      /// @brief Release the memory of one node.
+      void
+      __put_node(link_type __p) noexcept
+      {
+        FT_RB_TREE_COUNT_IN(m_counters, deallocation);
+        node_alloc_traits::deallocate(__get_node_allocator(), __p, 1);
+      }
+
+      /// @brief Allocate a node and construct its value in place from __args.
+      /// @details The memory is released again if the value constructor throws.
+      template <typename... _Args>
+      link_type
+      __create_node(_Args&&... __args)
+      {
+        link_type __tmp = __get_node();
+        try {
+          node_alloc_traits::construct(__get_node_allocator(), __tmp, std::in_place, std::forward<_Args>(__args)...);
+        } catch ( ... ) {
+          __put_node(__tmp);
+          throw;
+        }
+        return __tmp;
+      }
+
+      /// @brief Destroy a node and release its memory.
+      void
+      __drop_node(link_type __p) noexcept
+      {
+        node_alloc_traits::destroy(__get_node_allocator(), __p);
+        __put_node(__p);
+      }
+
+      /// @brief Create a detached copy of a node, keeping its color.
+      link_type
+      __clone_node(const_link_type __x)
+      {
+        link_type __tmp = __create_node(*__x->__valptr());
+        __tmp->__set_color(__x->__color());
+# if defined(FT_RB_TREE_ORDER_STATISTICS)
+        __tmp->m_size = __x->m_size;
+# endif
+        __tmp->m_left  = nullptr;
+        __tmp->m_right = nullptr;
+        return __tmp;
+      }
+
+    private:
+      template <typename _Arg>
+      pair<iterator, bool>
+      __insert_unique_aux(_Arg&& __v)
+      {
+        pair<base_ptr, base_ptr> __res = __get_insert_unique_pos(_KeyOfValue()(__v));
+
+        if ( __res.second != nullptr )
+          return pair<iterator, bool>(__insert_node(__res.first, __res.second,
+                                                    __create_node(std::forward<_Arg>(__v))), true);
+        return pair<iterator, bool>(iterator(__res.first), false);
+      }
+
+      template <typename _Arg>
+      iterator
+      __insert_equal_aux(_Arg&& __v)
+      {
+        pair<base_ptr, base_ptr> __res = __get_insert_equal_pos(_KeyOfValue()(__v));
+        return __insert_node(__res.first, __res.second, __create_node(std::forward<_Arg>(__v)));
+      }
+
+      template <typename _Arg>
+      iterator
+      __insert_hint_unique_aux(const_iterator __pos, _Arg&& __v)
+      {
+        pair<base_ptr, base_ptr> __res = __get_insert_hint_unique_pos(__pos, _KeyOfValue()(__v));
+
+        if ( __res.second != nullptr )
+          return __insert_node(__res.first, __res.second, __create_node(std::forward<_Arg>(__v)));
+        return iterator(__res.first);
+      }
+
+      template <typename _Arg>
+      iterator
+      __insert_hint_equal_aux(const_iterator __pos, _Arg&& __v)
+      {
+        pair<base_ptr, base_ptr> __res = __get_insert_hint_equal_pos(__pos, _KeyOfValue()(__v));
+        return __insert_node(__res.first, __res.second, __create_node(std::forward<_Arg>(__v)));
+      }
+
+      /// @brief Link the node held by __nh under __p and empty the handle.
+      /// @details A node from an unequal allocator cannot be adopted: its value is moved into
+      /// a new node and the handle destroys the old one.
+      iterator
+      __insert_node_handle(base_ptr __x, base_ptr __p, node_type& __nh)
+      {
+        if ( __nh.__node_allocator() == __get_node_allocator() ) {
+          iterator __it = __insert_node(__x, __p, __nh.__node());
+          __nh.__release();
+          return __it;
+        }
+
+        iterator __it = __insert_node(__x, __p, __create_node(std::move(*__nh.__node()->__valptr())));
+        __nh = node_type();
+        return __it;
+      }
+
+      /// @brief Unlink the element at __pos from __src and return a node of this tree holding it.
+      /// @details The node itself when the allocators are equal, otherwise a new node the
+      /// value is moved into; the old node is then destroyed by __src.
+      template <typename _Compare2>
+      link_type
+      __take_node(rb_tree<_Key, _Val, _KeyOfValue, _Compare2, _Alloc>& __src, iterator __pos)
+      {
+        FT_RB_TREE_COUNT_SCOPE(__src.m_counters);
+        const bool __adopt = ( __src.__get_node_allocator() == __get_node_allocator() );
+        link_type  __z     = __adopt ? nullptr : __create_node(std::move(*__pos));
+        base_ptr   __p     = rb_tree_rebalance_for_erase(__pos.m_node, __src.m_impl.m_header);
+
+        --__src.m_impl.m_nodeCount;
+        if ( __adopt ) return static_cast<link_type>(__p);
+        __src.__drop_node(static_cast<link_type>(__p));
+        return __z;
+      }
+
+      /// @brief Find where a node with key __k would be inserted, refusing duplicates.
+      /// @return (x, p) to insert under p, or (node, nullptr) if an equivalent key exists.
+      pair<base_ptr, base_ptr>
+      __get_insert_unique_pos(const key_type& __k)
+      {
+        link_type __x    = __begin();
+        base_ptr  __y    = __end();
+        bool      __comp = true;
+
+        while ( __x != nullptr ) {
+          __y    = __x;
+          __comp = __compare(__k, __key(__x));
+          __x    = __comp ? __left(__x) : __right(__x);
+        }
+
+        iterator __j = iterator(__y);
+        if ( __comp ) {
+          if ( __j == begin() )
+            return pair<base_ptr, base_ptr>(__x, __y);
+          --__j;
+        }
+        if ( __compare(__key(__j.m_node), __k) )
+          return pair<base_ptr, base_ptr>(__x, __y);
+        return pair<base_ptr, base_ptr>(__j.m_node, nullptr);
+      }
+
+      /// @brief Find where a node with key __k would be inserted, after its equivalents.
+      pair<base_ptr, base_ptr>
+      __get_insert_equal_pos(const key_type& __k)
+      {
+        link_type __x = __begin();
+        base_ptr  __y = __end();
+
+        while ( __x != nullptr ) {
+          __y = __x;
+          __x = __compare(__k, __key(__x)) ? __left(__x) : __right(__x);
+        }
+        return pair<base_ptr, base_ptr>(__x, __y);
+      }
+
+      /// @brief Find where a node with key __k would be inserted near __pos, refusing duplicates.
+      /// @return Same as `__get_insert_unique_pos`.
+      /// @details Only the hint and one neighbour are compared when __k fits between them.
+      /// Appending past the rightmost node, the common case for sorted input, needs a
+      /// single comparison.
+      pair<base_ptr, base_ptr>
+      __get_insert_hint_unique_pos(const_iterator __position, const key_type& __k)
+      {
+        iterator __pos = __position.__const_cast();
+
+        if ( __pos.m_node == __end() ) {
+          if ( size() > 0 && __compare(__key(__rightmost()), __k) )
+            return pair<base_ptr, base_ptr>(nullptr, __rightmost());
+          return __get_insert_unique_pos(__k);
+        }
+        if ( __compare(__k, __key(__pos.m_node)) ) {
+          if ( __pos.m_node == __leftmost() )
+            return pair<base_ptr, base_ptr>(__leftmost(), __leftmost());
+
+          iterator __before = __pos;
+          --__before;
+          if ( __compare(__key(__before.m_node), __k) ) {
+            if ( __before.m_node->m_right == nullptr )
+              return pair<base_ptr, base_ptr>(nullptr, __before.m_node);
+            return pair<base_ptr, base_ptr>(__pos.m_node, __pos.m_node);
+          }
+          return __get_insert_unique_pos(__k);
+        }
+        if ( __compare(__key(__pos.m_node), __k) ) {
+          if ( __pos.m_node == __rightmost() )
+            return pair<base_ptr, base_ptr>(nullptr, __rightmost());
+
+          iterator __after = __pos;
+          ++__after;
+          if ( __compare(__k, __key(__after.m_node)) ) {
+            if ( __pos.m_node->m_right == nullptr )
+              return pair<base_ptr, base_ptr>(nullptr, __pos.m_node);
+            return pair<base_ptr, base_ptr>(__after.m_node, __after.m_node);
+          }
+          return __get_insert_unique_pos(__k);
+        }
+        return pair<base_ptr, base_ptr>(__pos.m_node, nullptr);
+      }
+
+      /// @brief Find where a node with key __k would be inserted near __pos, keeping duplicates.
+      /// @details Like `__get_insert_hint_unique_pos`, with equivalent keys accepted on either
+      /// side of the hint.
+      pair<base_ptr, base_ptr>
+      __get_insert_hint_equal_pos(const_iterator __position, const key_type& __k)
+      {
+        iterator __pos = __position.__const_cast();
+
+        if ( __pos.m_node == __end() ) {
+          if ( size() > 0 && !__compare(__k, __key(__rightmost())) )
+            return pair<base_ptr, base_ptr>(nullptr, __rightmost());
+          return __get_insert_equal_pos(__k);
+        }
+        if ( !__compare(__key(__pos.m_node), __k) ) {
+          if ( __pos.m_node == __leftmost() )
+            return pair<base_ptr, base_ptr>(__leftmost(), __leftmost());
+
+          iterator __before = __pos;
+          --__before;
+          if ( !__compare(__k, __key(__before.m_node)) ) {
+            if ( __before.m_node->m_right == nullptr )
+              return pair<base_ptr, base_ptr>(nullptr, __before.m_node);
+            return pair<base_ptr, base_ptr>(__pos.m_node, __pos.m_node);
+          }
+          return __get_insert_equal_pos(__k);
+        }
+        if ( __pos.m_node == __rightmost() )
+          return pair<base_ptr, base_ptr>(nullptr, __rightmost());
+
+        iterator __after = __pos;
+        ++__after;
+        if ( !__compare(__key(__after.m_node), __k) ) {
+          if ( __pos.m_node->m_right == nullptr )
+            return pair<base_ptr, base_ptr>(nullptr, __pos.m_node);
+          return pair<base_ptr, base_ptr>(__after.m_node, __after.m_node);
+        }
+        return __get_insert_equal_pos(__k);
+      }
+
+      /// @brief Link a constructed node under __p and rebalance.
+      iterator
+      __insert_node(base_ptr __x, base_ptr __p, link_type __z)
+      {
+        const bool __insert_left = ( __x != nullptr || __p == __end()
+                                  || __compare(__key(__z), __key(__p)) );
+
+        FT_RB_TREE_COUNT_SCOPE(m_counters);
+        rb_tree_insert_and_rebalance(__insert_left, __z, __p, m_impl.m_header);
+        ++m_impl.m_nodeCount;
+        return iterator(__z);
+      }
+
+      template <typename _Kt>
+      iterator
+      __lower_bound(link_type __x, base_ptr __y, const _Kt& __k)
+      {
+        while ( __x != nullptr ) {
+          if ( !__compare(__key(__x), __k) ) {
+            __y = __x;
+            __x = __left(__x);
+          } else {
+            __x = __right(__x);
+          }
+        }
+        return iterator(__y);
+      }
+
+      template <typename _Kt>
+      const_iterator
+      __lower_bound(const_link_type __x, const_base_ptr __y, const _Kt& __k) const
+      {
+        while ( __x != nullptr ) {
+          if ( !__compare(__key(__x), __k) ) {
+            __y = __x;
+            __x = __left(__x);
+          } else {
+            __x = __right(__x);
+          }
+        }
+        return const_iterator(__y);
+      }
+
+      /// @brief Whether __y, the lower bound of __k, holds a key equivalent to __k.
+      template <typename _Kt>
+      bool
+      __is_match(const_base_ptr __y, const _Kt& __k) const
+      {
+        return __y != __end() && !__compare(__k, __key(__y));
+      }
+
+      /// @brief Run the lower-bound descents of a range of keys interleaved, see `find_many`.
+      /// @param __emit Called with each key and its lower bound, in the order of the keys.
+      template <typename _ForwardIterator, typename _Emit>
+      void
+      __descend_many(_ForwardIterator __first, _ForwardIterator __last, _Emit __emit) const
+      {
+        _ForwardIterator __keys[batch_lookup_width];
+        const_link_type  __x[batch_lookup_width];
+        const_base_ptr   __y[batch_lookup_width];
+
+        while ( __first != __last ) {
+          std::size_t __n = 0;
+
+          for ( ; __n < batch_lookup_width && __first != __last; ++__n, ++__first ) {
+            __keys[__n] = __first;
+            __x[__n]    = __begin();
+            __y[__n]    = __end();
+          }
+          for ( std::size_t __live = __n; __live != 0; ) {
+            __live = 0;
+            for ( std::size_t __i = 0; __i < __n; ++__i ) {
+              if ( __x[__i] == nullptr ) continue;
+              if ( !__compare(__key(__x[__i]), *__keys[__i]) ) {
+                __y[__i] = __x[__i];
+                __x[__i] = __left(__x[__i]);
+              } else {
+                __x[__i] = __right(__x[__i]);
+              }
+              if ( __x[__i] != nullptr ) {
+                ft::__prefetch(__x[__i]->__valptr());
+                ++__live;
+              }
+            }
+          }
+          for ( std::size_t __i = 0; __i < __n; ++__i )
+            __emit(*__keys[__i], __y[__i]);
+        }
+      }
+
+      template <typename _Kt>
+      iterator
+      __upper_bound(link_type __x, base_ptr __y, const _Kt& __k)
+      {
+        while ( __x != nullptr ) {
+          if ( __compare(__k, __key(__x)) ) {
+            __y = __x;
+            __x = __left(__x);
+          } else {
+            __x = __right(__x);
+          }
+        }
+        return iterator(__y);
+      }
+
+      template <typename _Kt>
+      const_iterator
+      __upper_bound(const_link_type __x, const_base_ptr __y, const _Kt& __k) const
+      {
+        while ( __x != nullptr ) {
+          if ( __compare(__k, __key(__x)) ) {
+            __y = __x;
+            __x = __left(__x);
+          } else {
+            __x = __right(__x);
+          }
+        }
+        return const_iterator(__y);
+      }
+
+      /// @brief Unlink and destroy the node at __position.
+      void
+      __erase_aux(const_iterator __position) noexcept
+      {
+        FT_RB_TREE_COUNT_SCOPE(m_counters);
+        link_type __y = static_cast<link_type>(
+          rb_tree_rebalance_for_erase(__position.__const_cast().m_node, m_impl.m_header));
+        __drop_node(__y);
+        --m_impl.m_nodeCount;
+      }
+
+      /// @brief Unlink and destroy the nodes in [__first, __last).
+      void
+      __erase_aux(const_iterator __first, const_iterator __last) noexcept
+      {
+        if ( __first == begin() && __last == end() ) {
+          clear();
+        } else {
+          while ( __first != __last ) __erase_aux(__first++);
+        }
+      }
+
+      /// @brief Whether a range can be scanned for sortedness and then built in linear time:
+      /// it must be multi-pass and yield the value type itself.
+      template <typename _Iter>
+      using __sorted_build_t = std::integral_constant<bool,
+        ( std::is_convertible<iterator_category_t<_Iter>, forward_iterator_tag>::value ||
+          std::is_convertible<iterator_category_t<_Iter>, std::forward_iterator_tag>::value ) &&
+        std::is_same<std::decay_t<reference_t<_Iter>>, value_type>::value>;
+
+      template <typename _ForwardIterator>
+      void
+      __assign_range(_ForwardIterator __first, _ForwardIterator __last, bool __unique, std::true_type)
+      {
+        size_type __n = 0;
+
+        if ( __is_sorted_range(__first, __last, __unique, __n) )
+          __build_sorted(__first, __n);
+        else if ( __unique )
+          __insert_range_unique(__first, __last);
+        else
+          __insert_range_equal(__first, __last);
+      }
+
+      template <typename _InputIterator>
+      void
+      __assign_range(_InputIterator __first, _InputIterator __last, bool __unique, std::false_type)
+      {
+        if ( __unique )
+          __insert_range_unique(__first, __last);
+        else
+          __insert_range_equal(__first, __last);
+      }
+
+      /// @brief Check that the keys of a range increase, strictly if __unique.
+      /// @param __n Set to the length of the range when it is sorted.
+      template <typename _ForwardIterator>
+      bool
+      __is_sorted_range(_ForwardIterator __first, _ForwardIterator __last, bool __unique, size_type& __n)
+      {
+        if ( __first == __last ) return true;
+
+        size_type        __count = 1;
+        _ForwardIterator __next  = __first;
+
+        for ( ; ++__next != __last; __first = __next, ++__count ) {
+          const key_type& __a = _KeyOfValue()(*__first);
+          const key_type& __b = _KeyOfValue()(*__next);
+
+          if ( __unique ? !__compare(__a, __b) : __compare(__b, __a) )
+            return false;
+        }
+        __n = __count;
+        return true;
+      }
+
+      /// @brief Length of a range, using `ft::distance` for iterators tagged with the ft
+      /// categories and `std::distance` for the standard ones.
+      template <typename _Iter>
+      static difference_type
+      __range_length(_Iter __first, _Iter __last)
+      {
+        return __range_length(__first, __last,
+                              std::is_convertible<iterator_category_t<_Iter>, input_iterator_tag>());
+      }
+
+      template <typename _Iter>
+      static difference_type
+      __range_length(_Iter __first, _Iter __last, std::true_type) { return ft::distance(__first, __last); }
+
+      template <typename _Iter>
+      static difference_type
+      __range_length(_Iter __first, _Iter __last, std::false_type) { return std::distance(__first, __last); }
+
+      /// @brief Link the next __n values of __first into this empty tree, in linear time.
+      /// @details The tree is split at the median at every level, so all empty links sit on
+      /// the two lowest levels. The nodes on the last, incomplete level are red and every
+      /// other node black, which gives every path the same number of black nodes.
+      template <typename _ForwardIterator>
+      void
+      __build_sorted(_ForwardIterator __first, size_type __n)
+      {
+        if ( __n == 0 ) return;
+
+        __attach_root(__build_balanced(__first, __n, 0, __red_depth(__n)), __n);
+# if defined(FT_RB_TREE_THREADED_NODE)
+        rb_tree_rethread(__root(), m_impl.m_header);
+# endif
+      }
+
+      /// @brief Build a balanced subtree from the next __n values of __first.
+      /// @param __depth The depth of the subtree root.
+      /// @param __red_depth The depth of the last, incomplete level.
+      /// @return The root of the subtree. Partially built subtrees are destroyed on exception.
+      template <typename _ForwardIterator>
+      link_type
+      __build_balanced(_ForwardIterator& __first, size_type __n, size_type __depth, size_type __red_depth)
+      {
+        if ( __n == 0 ) return nullptr;
+
+        const size_type __left_n = ( __n - 1 ) / 2;
+        link_type       __l      = __build_balanced(__first, __left_n, __depth + 1, __red_depth);
+        link_type       __z      = nullptr;
+
+        try {
+          __z = __create_node(*__first);
+        } catch ( ... ) {
+          __erase(__l);
+          throw;
+        }
+        ++__first;
+
+        __z->__set_color(__depth == __red_depth ? rb_tree_color::red : rb_tree_color::black);
+        __z->m_left  = __l;
+        __z->m_right = nullptr;
+        if ( __l != nullptr ) __l->__set_parent(__z);
+
+        try {
+          __z->m_right = __build_balanced(__first, __n - 1 - __left_n, __depth + 1, __red_depth);
+        } catch ( ... ) {
+          __erase(__z);
+          throw;
+        }
+        if ( __z->m_right != nullptr ) __z->m_right->__set_parent(__z);
+        rb_tree_update_size(__z);
+        return __z;
+      }
+
+      /// @brief The depth of the last, incomplete level of a perfectly balanced tree of __n nodes.
+      static size_type
+      __red_depth(size_type __n) noexcept
+      {
+        size_type __d = 0;
+
+        while ( ( size_type(2) << __d ) - 1 <= __n ) ++__d;
+        return __d;
+      }
+
+      /// @brief Take the nodes out of the tree, leaving it empty.
+      /// @return The detached root, with no parent, or nullptr.
+      link_type
+      __detach_root() noexcept
+      {
+        link_type __t = __begin();
+
+        if ( __t != nullptr ) __t->__set_parent(nullptr);
+        m_impl.__reset();
+        return __t;
+      }
+
+      /// @brief Make a detached subtree of __n nodes the contents of this empty tree.
+      void
+      __attach_root(link_type __t, size_type __n) noexcept
+      {
+        if ( __t == nullptr ) return;
+
+        __t->__set_parent(__end());
+        __t->__set_color(rb_tree_color::black);
+        __set_root(__t);
+        __leftmost()       = rb_tree_node_base::minimum(__t);
+        __rightmost()      = rb_tree_node_base::maximum(__t);
+        m_impl.m_nodeCount = __n;
+        m_impl.__thread_ends();
+      }
+
+      /// @brief A detached subtree split around a key.
+      struct split_result
+      {
+        link_type    m_less;          ///< The nodes with smaller keys.
+        link_type    m_match;         ///< The node with an equivalent key, detached, or nullptr.
+        link_type    m_greater;       ///< The nodes with greater keys.
+        unsigned int m_lessHeight;    ///< The black height of m_less, counting its root as black.
+        unsigned int m_greaterHeight; ///< The black height of m_greater, counting its root as black.
+      };
+
+      /// @brief The black height of a child of a node of black height __h, counting both roots as black.
+      static unsigned int
+      __child_height(const_base_ptr __c, unsigned int __h) noexcept
+      {
+        return __c != nullptr && __c->__color() == rb_tree_color::red ? __h : __h - 1;
+      }
+
+      /// @brief Split the detached subtree __t around the key __k.
+      split_result
+      __split(link_type __t, const key_type& __k) noexcept
+      {
+        const bool __red = __t != nullptr && __t->__color() == rb_tree_color::red;
+
+        return __split(__t, rb_tree_black_height(__t) + ( __red ? 1 : 0 ), __k);
+      }
+
+      /// @brief Split the detached subtree __t, of black height __h counting its root as black.
+      /// @details Walks down the search path of __k; the subtrees hanging off the path are
+      /// joined back on their side with the path nodes as pivots. The black heights are
+      /// carried along rather than measured, so each join costs the difference of the
+      /// heights it joins, and the whole split is proportional to the height of __t.
+      split_result
+      __split(link_type __t, unsigned int __h, const key_type& __k) noexcept
+      {
+        if ( __t == nullptr ) return split_result{ nullptr, nullptr, nullptr, 0, 0 };
+
+        link_type          __l  = __left(__t);
+        link_type          __r  = __right(__t);
+        const unsigned int __hl = __child_height(__l, __h);
+        const unsigned int __hr = __child_height(__r, __h);
+
+        if ( __l != nullptr ) __l->__set_parent(nullptr);
+        if ( __r != nullptr ) __r->__set_parent(nullptr);
+
+        if ( __compare(__k, __key(__t)) ) {
+          split_result __s = __split(__l, __hl, __k);
+          __s.m_greater = __join(__s.m_greater, __s.m_greaterHeight, __t, __r, __hr, __s.m_greaterHeight);
+          return __s;
+        }
+        if ( __compare(__key(__t), __k) ) {
+          split_result __s = __split(__r, __hr, __k);
+          __s.m_less = __join(__l, __hl, __t, __s.m_less, __s.m_lessHeight, __s.m_lessHeight);
+          return __s;
+        }
+        __t->m_left  = nullptr;
+        __t->m_right = nullptr;
+        return split_result{ __l, __t, __r, __hl, __hr };
+      }
+
+      /// @brief Detach the two subtrees of the detached node __t.
+      static void
+      __unlink_children(link_type __t, link_type& __l, link_type& __r) noexcept
+      {
+        __l = __left(__t);
+        __r = __right(__t);
+        if ( __l != nullptr ) __l->__set_parent(nullptr);
+        if ( __r != nullptr ) __r->__set_parent(nullptr);
+      }
+
+      /// @brief Union of two detached subtrees; __dropped counts the destroyed duplicates.
+      /// The two recursive calls are run by __fork, and the calls below them by its `__next()`.
+      template <typename _Fork>
+      link_type
+      __union(link_type __t1, link_type __t2, size_type& __dropped, const _Fork& __fork) noexcept
+      {
+        if ( __t1 == nullptr ) return __t2;
+        if ( __t2 == nullptr ) return __t1;
+
+        link_type __l1, __r1;
+        __unlink_children(__t1, __l1, __r1);
+
+        split_result __s = __split(__t2, __key(__t1));
+        if ( __s.m_match != nullptr ) {
+          __drop_node(__s.m_match);
+          ++__dropped;
+        }
+
+        link_type       __l, __r;
+        size_type       __dropped_r = 0;
+        const _Fork     __next      = __fork.__next();
+
+        __fork([&] { __l = __union(__l1, __s.m_less, __dropped, __next); },
+               [&] { __r = __union(__r1, __s.m_greater, __dropped_r, __next); });
+        __dropped += __dropped_r;
+        return __join(__l, __t1, __r);
+      }
+
+      /// @brief Intersection of two detached subtrees; __dropped counts the nodes of __t1 destroyed.
+      template <typename _Fork>
+      link_type
+      __intersect(link_type __t1, link_type __t2, size_type& __dropped, const _Fork& __fork) noexcept
+      {
+        if ( __t1 == nullptr ) {
+          __erase(__t2);
+          return nullptr;
+        }
+        if ( __t2 == nullptr ) {
+          __dropped += __erase(__t1);
+          return nullptr;
+        }
+
+        link_type __l1, __r1;
+        __unlink_children(__t1, __l1, __r1);
+
+        split_result    __s = __split(__t2, __key(__t1));
+        link_type       __l, __r;
+        size_type       __dropped_r = 0;
+        const _Fork     __next      = __fork.__next();
+
+        __fork([&] { __l = __intersect(__l1, __s.m_less, __dropped, __next); },
+               [&] { __r = __intersect(__r1, __s.m_greater, __dropped_r, __next); });
+        __dropped += __dropped_r;
+
+        if ( __s.m_match != nullptr ) {
+          __drop_node(__s.m_match);
+          return __join(__l, __t1, __r);
+        }
+        __drop_node(__t1);
+        ++__dropped;
+        return __join(__l, __r);
+      }
+
+      /// @brief Difference of two detached subtrees; __dropped counts the nodes of __t1 destroyed.
+      template <typename _Fork>
+      link_type
+      __difference(link_type __t1, link_type __t2, size_type& __dropped, const _Fork& __fork) noexcept
+      {
+        if ( __t1 == nullptr ) {
+          __erase(__t2);
+          return nullptr;
+        }
+        if ( __t2 == nullptr ) return __t1;
+
+        link_type __l2, __r2;
+        __unlink_children(__t2, __l2, __r2);
+
+        split_result __s = __split(__t1, __key(__t2));
+        if ( __s.m_match != nullptr ) {
+          __drop_node(__s.m_match);
+          ++__dropped;
+        }
+
+        link_type       __l, __r;
+        size_type       __dropped_r = 0;
+        const _Fork     __next      = __fork.__next();
+
+        __fork([&] { __l = __difference(__s.m_less, __l2, __dropped, __next); },
+               [&] { __r = __difference(__s.m_greater, __r2, __dropped_r, __next); });
+        __dropped += __dropped_r;
+        __drop_node(__t2);
+        return __join(__l, __r);
+      }
+
+      /// @brief `rb_tree_join` of detached subtrees around the pivot __k, counted into this tree.
+      link_type
+      __join(link_type __l, link_type __k, link_type __r) noexcept
+      {
+        FT_RB_TREE_COUNT_SCOPE(m_counters);
+        return static_cast<link_type>(rb_tree_join(__l, __k, __r));
+      }
+
+      /// @brief `rb_tree_join` of detached subtrees of known black heights, counted into this tree.
+      link_type
+      __join(link_type __l, unsigned int __hl, link_type __k, link_type __r, unsigned int __hr,
+             unsigned int& __height) noexcept
+      {
+        FT_RB_TREE_COUNT_SCOPE(m_counters);
+        return static_cast<link_type>(rb_tree_join(__l, __hl, __k, __r, __hr, __height));
+      }
+
+      /// @brief `rb_tree_join` of detached subtrees, counted into this tree.
+      link_type
+      __join(link_type __l, link_type __r) noexcept
+      {
+        FT_RB_TREE_COUNT_SCOPE(m_counters);
+        return static_cast<link_type>(rb_tree_join(__l, __r));
+      }
+
+      /// @brief Destroy the subtree rooted at __x without rebalancing.
+      /// @return The number of destroyed nodes.
+      /// @details Recurses on right children and loops on left children, so the
+      /// recursion depth is bounded by the tree height.
+      size_type
+      __erase(link_type __x) noexcept
+      {
+        size_type __n = 0;
+
+        while ( __x != nullptr ) {
+          __n += __erase(__right(__x));
+          link_type __y = __left(__x);
+          __drop_node(__x);
+          __x = __y;
+          ++__n;
+        }
+        return __n;
+      }
+
+      /// @brief Destroy every node of the tree without rebalancing.
+      /// @details When the node allocator can drop all its memory at once, only the values
+      /// that need it are destroyed and the memory is released in bulk; otherwise every
+      /// node is destroyed and deallocated one by one.
+      void
+      __erase_all() noexcept
+      {
+        if ( bulk_release_traits<node_allocator>::can_release(__get_node_allocator()) ) {
+          __destroy_values(__begin(), std::is_trivially_destructible<value_type>());
+          bulk_release_traits<node_allocator>::release(__get_node_allocator());
+        } else {
+          __erase(__begin());
+        }
+      }
+
+      /// @brief Destroy the nodes of a subtree without releasing their memory.
+      void
+      __destroy_values(link_type __x, std::false_type) noexcept
+      {
+        while ( __x != nullptr ) {
+          __destroy_values(__right(__x), std::false_type());
+          link_type __y = __left(__x);
+          node_alloc_traits::destroy(__get_node_allocator(), __x);
+          __x = __y;
+        }
+      }
+
+      void
+      __destroy_values(link_type, std::true_type) noexcept { }
+
+      /// @brief Structurally copy the subtree rooted at __x under __p.
+      /// @return The root of the copy. Partially built copies are destroyed on exception.
+      link_type
+      __copy(const_link_type __x, base_ptr __p)
+      {
+        link_type __top = __clone_node(__x);
+        __top->__set_parent(__p);
+
+        try {
+          if ( __x->m_right != nullptr )
+            __top->m_right = __copy(__right(__x), __top);
+          __p = __top;
+          __x = __left(__x);
+
+          while ( __x != nullptr ) {
+            link_type __y = __clone_node(__x);
+            __p->m_left   = __y;
+            __y->__set_parent(__p);
+            if ( __x->m_right != nullptr )
+              __y->m_right = __copy(__right(__x), __y);
+            __p = __y;
+            __x = __left(__x);
+          }
+        } catch ( ... ) {
+          __erase(__top);
+          throw;
+        }
+        return __top;
+      }
+
+      /// @brief Copy the nodes of __x into this (empty) tree and fix the header links.
+      link_type
+      __copy(const rb_tree& __x)
+      {
+        link_type __top = __copy(__x.__begin(), __end());
+
+        __leftmost()       = rb_tree_node_base::minimum(__top);
+        __rightmost()      = rb_tree_node_base::maximum(__top);
+        m_impl.m_nodeCount = __x.m_impl.m_nodeCount;
+# if defined(FT_RB_TREE_THREADED_NODE)
+        rb_tree_rethread(__top, m_impl.m_header);
+# endif
+        return __top;
+      }
+
+      void
+      __move_assign(rb_tree& __x, std::true_type)
+      {
+        clear();
+        if ( __x.__root() != nullptr ) m_impl.__move_data(__x.m_impl);
+        __alloc_on_move(__x, typename node_alloc_traits::propagate_on_container_move_assignment());
+      }
+
+      void
+      __move_assign(rb_tree& __x, std::false_type)
+      {
+        if ( __get_node_allocator() == __x.__get_node_allocator() ) {
+          __move_assign(__x, std::true_type());
+          return;
+        }
+        clear();
+        if ( __x.__root() != nullptr ) __set_root(__copy(__x));
+      }
+
+      void
+      __alloc_on_copy(const rb_tree& __x, std::true_type) { __get_node_allocator() = __x.__get_node_allocator(); }
+
+      void
+      __alloc_on_copy(const rb_tree&, std::false_type) { }
+
+      void
+      __alloc_on_move(rb_tree& __x, std::true_type) { __get_node_allocator() = std::move(__x.__get_node_allocator()); }
+
+      void
+      __alloc_on_move(rb_tree&, std::false_type) { }
+
+      void
+      __alloc_on_swap(rb_tree& __x, std::true_type) { std::swap(__get_node_allocator(), __x.__get_node_allocator()); }
+
+      void
+      __alloc_on_swap(rb_tree&, std::false_type) { }
+  };
+
+  template <typename _Key, typename _Val, typename _KeyOfValue, typename _Compare, typename _Alloc>
+  inline bool
+  operator==(const rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>& __x,
+             const rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>& __y)
+  {
+    return __x.size() == __y.size() && ft::equal(__x.begin(), __x.end(), __y.begin());
+  }
+
+  template <typename _Key, typename _Val, typename _KeyOfValue, typename _Compare, typename _Alloc>
+  inline bool
+  operator<(const rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>& __x,
+            const rb_tree<_Key, _Val, _KeyOfValue, _Compare, _Alloc>& __y)
+  {
+    return ft::lexicographical_compare(__x.begin(), __x.end(), __y.begin(), __y.end());
+  }
+
+} // namespace ft
+
+#endif // __FT_RB_TREE__
@@ -0,0 +1,734 @@
+#ifndef   __FT_RB_TREE_BASE_FUNCS__
+# define  __FT_RB_TREE_BASE_FUNCS__
+
+# include <cstddef> // For std::size_t, std::ptrdiff_t
+
+# include "rb_tree_instrument.h" // For FT_RB_TREE_COUNT, FT_RB_TREE_COUNT_IF
+# include "rb_tree_node_base.h"  // For rb_tree_node_base, rb_tree_color
+
+namespace ft {
+
+  /// @brief Get the in-order successor of a node.
+  /// @param __x Pointer to the node whose successor is requested.
+  /// @return Pointer to the next node in order, or the header if __x is the rightmost node.
+  /// @details
+  /// If the node has a right subtree, the successor is the leftmost node of that subtree.
+  /// Otherwise we climb until we leave a left subtree. The final check handles the
+  /// case where the tree has a single node and __x is the header's parent.
+  inline rb_tree_node_base*
+  rb_tree_increment(rb_tree_node_base* __x) noexcept
+  {
+# if defined(FT_RB_TREE_THREADED_NODE)
+    return __x->m_next;
+# else
+    if ( __x->m_right != nullptr ) {
+      __x = __x->m_right;
+      while ( __x->m_left != nullptr ) __x = __x->m_left;
+      return __x;
+    }
+
+    rb_tree_node_base* __y = __x->__parent();
+    while ( __x == __y->m_right ) {
+      __x = __y;
+      __y = __y->__parent();
+    }
+    if ( __x->m_right != __y ) __x = __y;
+    return __x;
+# endif
+  }
+
+  /// @brief Get the in-order successor of a node (const version).
+  inline const rb_tree_node_base*
+  rb_tree_increment(const rb_tree_node_base* __x) noexcept
+  {
+    return rb_tree_increment(const_cast<rb_tree_node_base*>(__x));
+  }
+
+  /// @brief Get the in-order predecessor of a node.
+  /// @param __x Pointer to the node whose predecessor is requested.
+  /// @return Pointer to the previous node in order.
+  /// @details
+  /// Decrementing the header (the end iterator) yields the rightmost node. The header
+  /// is recognised as the only red node whose grandparent is itself.
+  inline rb_tree_node_base*
+  rb_tree_decrement(rb_tree_node_base* __x) noexcept
+  {
+# if defined(FT_RB_TREE_THREADED_NODE)
+    return __x->m_prev;
+# else
+    if ( __x->__color() == rb_tree_color::red && __x->__parent()->__parent() == __x )
+      return __x->m_right;
+
+    if ( __x->m_left != nullptr ) {
+      rb_tree_node_base* __y = __x->m_left;
+      while ( __y->m_right != nullptr ) __y = __y->m_right;
+      return __y;
+    }
+
+    rb_tree_node_base* __y = __x->__parent();
+    while ( __x == __y->m_left ) {
+      __x = __y;
+      __y = __y->__parent();
+    }
+    return __y;
+# endif
+  }
+
+  /// @brief Get the in-order predecessor of a node (const version).
+  inline const rb_tree_node_base*
+  rb_tree_decrement(const rb_tree_node_base* __x) noexcept
+  {
+    return rb_tree_decrement(const_cast<rb_tree_node_base*>(__x));
+  }
+
+# if defined(FT_RB_TREE_ORDER_STATISTICS)
+  /// @brief Get the number of nodes in a subtree.
+  /// @param __x The root of the subtree, or nullptr.
+  inline std::size_t
+  rb_tree_subtree_size(const rb_tree_node_base* __x) noexcept { return __x == nullptr ? 0 : __x->m_size; }
+# endif
+
+  /// @brief Recompute the subtree size of __x from its children.
+  /// @details Does nothing unless `FT_RB_TREE_ORDER_STATISTICS` is defined.
+  inline void
+  rb_tree_update_size(rb_tree_node_base* __x) noexcept
+  {
+# if defined(FT_RB_TREE_ORDER_STATISTICS)
+    __x->m_size = rb_tree_subtree_size(__x->m_left) + rb_tree_subtree_size(__x->m_right) + 1;
+# else
+    (void)__x;
+# endif
+  }
+
+  /// @brief Add __delta to the subtree sizes of __x and of its ancestors.
+  /// @param __stop Where the walk ends: the header, or nullptr for a detached tree.
+  /// @details Does nothing unless `FT_RB_TREE_ORDER_STATISTICS` is defined.
+  inline void
+  rb_tree_adjust_path_size(rb_tree_node_base* __x, const rb_tree_node_base* __stop, std::ptrdiff_t __delta) noexcept
+  {
+# if defined(FT_RB_TREE_ORDER_STATISTICS)
+    for ( ; __x != __stop; __x = __x->__parent() )
+      __x->m_size += static_cast<std::size_t>(__delta);
+# else
+    (void)__x;
+    (void)__stop;
+    (void)__delta;
+# endif
+  }
+
+  /// @brief Thread a new node next to its parent: before it if it is a left child, after it otherwise.
+  /// @details Does nothing unless `FT_RB_TREE_THREADED_NODE` is defined.
+  inline void
+  rb_tree_thread_insert(const bool __insert_left,
+                        rb_tree_node_base* __x,
+                        rb_tree_node_base* __p) noexcept
+  {
+# if defined(FT_RB_TREE_THREADED_NODE)
+    if ( __insert_left ) {
+      __x->m_next = __p;
+      __x->m_prev = __p->m_prev;
+    } else {
+      __x->m_prev = __p;
+      __x->m_next = __p->m_next;
+    }
+    __x->m_prev->m_next = __x;
+    __x->m_next->m_prev = __x;
+# else
+    (void)__insert_left;
+    (void)__x;
+    (void)__p;
+# endif
+  }
+
+  /// @brief Link two nodes as in-order neighbours.
+  /// @details Does nothing unless `FT_RB_TREE_THREADED_NODE` is defined.
+  inline void
+  rb_tree_thread_link(rb_tree_node_base* __a, rb_tree_node_base* __b) noexcept
+  {
+# if defined(FT_RB_TREE_THREADED_NODE)
+    __a->m_next = __b;
+    __b->m_prev = __a;
+# else
+    (void)__a;
+    (void)__b;
+# endif
+  }
+
+# if defined(FT_RB_TREE_THREADED_NODE)
+  /// @brief Rebuild every thread link of a tree from its structure, in O(n).
+  /// @param __root The root of the tree, whose parent must be __header.
+  /// @param __header The tree header, which closes the thread list.
+  /// @details Used after operations that build a whole tree at once, like copying.
+  inline void
+  rb_tree_rethread(rb_tree_node_base* __root, rb_tree_node_base& __header) noexcept
+  {
+    rb_tree_node_base* __prev = &__header;
+    rb_tree_node_base* __x    = rb_tree_node_base::minimum(__root);
+
+    while ( __x != nullptr ) {
+      rb_tree_thread_link(__prev, __x);
+      __prev = __x;
+
+      if ( __x->m_right != nullptr ) {
+        __x = rb_tree_node_base::minimum(__x->m_right);
+      } else {
+        rb_tree_node_base* __y = __x->__parent();
+        while ( __y != &__header && __x == __y->m_right ) {
+          __x = __y;
+          __y = __y->__parent();
+        }
+        __x = __y == &__header ? nullptr : __y;
+      }
+    }
+    rb_tree_thread_link(__prev, &__header);
+  }
+# endif
+
+  /// @brief Set the color of a linked node, counted as a recoloring when instrumented.
+  inline void
+  rb_tree_recolor(rb_tree_node_base* const __x, const rb_tree_color __c) noexcept
+  {
+    FT_RB_TREE_COUNT_IF(__x->__color() != __c, recoloring);
+    __x->__set_color(__c);
+  }
+
+  /// @brief Rotate the subtree rooted at __x to the left.
+  /// @param __x The node to rotate; its right child takes its place.
+  /// @param __header The tree header, whose root link is updated if __x was the root.
+  inline void
+  rb_tree_rotate_left(rb_tree_node_base* const __x, rb_tree_node_base& __header) noexcept
+  {
+    FT_RB_TREE_COUNT(rotation);
+
+    rb_tree_node_base* const __y = __x->m_right;
+
+    __x->m_right = __y->m_left;
+    if ( __y->m_left != nullptr ) __y->m_left->__set_parent(__x);
+    __y->__set_parent(__x->__parent());
+
+    if ( __x == __header.__parent() )
+      __header.__set_parent(__y);
+    else if ( __x == __x->__parent()->m_left )
+      __x->__parent()->m_left = __y;
+    else
+      __x->__parent()->m_right = __y;
+
+    __y->m_left   = __x;
+    __x->__set_parent(__y);
+
+    rb_tree_update_size(__x);
+    rb_tree_update_size(__y);
+  }
+
+  /// @brief Rotate the subtree rooted at __x to the right.
+  /// @param __x The node to rotate; its left child takes its place.
+  /// @param __header The tree header, whose root link is updated if __x was the root.
+  inline void
+  rb_tree_rotate_right(rb_tree_node_base* const __x, rb_tree_node_base& __header) noexcept
+  {
+    FT_RB_TREE_COUNT(rotation);
+
+    rb_tree_node_base* const __y = __x->m_left;
+
+    __x->m_left = __y->m_right;
+    if ( __y->m_right != nullptr ) __y->m_right->__set_parent(__x);
+    __y->__set_parent(__x->__parent());
+
+    if ( __x == __header.__parent() )
+      __header.__set_parent(__y);
+    else if ( __x == __x->__parent()->m_right )
+      __x->__parent()->m_right = __y;
+    else
+      __x->__parent()->m_left = __y;
+
+    __y->m_right  = __x;
+    __x->__set_parent(__y);
+
+    rb_tree_update_size(__x);
+    rb_tree_update_size(__y);
+  }
+
+  /// @brief Restore the red-black invariants after a red node has been linked in.
+  /// @param __x The red node; its subtrees must have equal black heights.
+  /// @param __header The tree header, whose root link is updated by the rotations.
+  /// @details
+  /// __x does not have to be a leaf, which lets `rb_tree_join` reuse the insertion fix-up
+  /// when it links a pivot with two subtrees into the spine of a taller tree.
+  /// @return Whether the recoloring reached the root, so that the black height grew by one.
+  inline bool
+  rb_tree_insert_fixup(rb_tree_node_base* __x, rb_tree_node_base& __header) noexcept
+  {
+    while ( __x != __header.__parent() && __x->__parent()->__color() == rb_tree_color::red ) {
+      rb_tree_node_base* const __xpp = __x->__parent()->__parent();
+
+      if ( __x->__parent() == __xpp->m_left ) {
+        rb_tree_node_base* const __y = __xpp->m_right;
+
+        if ( __y != nullptr && __y->__color() == rb_tree_color::red ) {
+          rb_tree_recolor(__x->__parent(), rb_tree_color::black);
+          rb_tree_recolor(__y, rb_tree_color::black);
+          rb_tree_recolor(__xpp, rb_tree_color::red);
+          __x = __xpp;
+        } else {
+          if ( __x == __x->__parent()->m_right ) {
+            __x = __x->__parent();
+            rb_tree_rotate_left(__x, __header);
+          }
+          rb_tree_recolor(__x->__parent(), rb_tree_color::black);
+          rb_tree_recolor(__xpp, rb_tree_color::red);
+          rb_tree_rotate_right(__xpp, __header);
+        }
+      } else {
+        rb_tree_node_base* const __y = __xpp->m_left;
+
+        if ( __y != nullptr && __y->__color() == rb_tree_color::red ) {
+          rb_tree_recolor(__x->__parent(), rb_tree_color::black);
+          rb_tree_recolor(__y, rb_tree_color::black);
+          rb_tree_recolor(__xpp, rb_tree_color::red);
+          __x = __xpp;
+        } else {
+          if ( __x == __x->__parent()->m_left ) {
+            __x = __x->__parent();
+            rb_tree_rotate_right(__x, __header);
+          }
+          rb_tree_recolor(__x->__parent(), rb_tree_color::black);
+          rb_tree_recolor(__xpp, rb_tree_color::red);
+          rb_tree_rotate_left(__xpp, __header);
+        }
+      }
+    }
+
+    const bool __grown = __header.__parent()->__color() == rb_tree_color::red;
+
+    rb_tree_recolor(__header.__parent(), rb_tree_color::black);
+    return __grown;
+  }
+
+  /// @brief Link a new node into the tree and restore the red-black invariants.
+  /// @param __insert_left Whether __x becomes the left child of __p.
+  /// @param __x The new node, which must not be linked yet.
+  /// @param __p The parent under which __x is attached (the header for an empty tree).
+  /// @param __header The tree header; its leftmost/rightmost links are kept up to date.
+  /// @details
+  /// The rebalancing loop recolors while the uncle is red and finishes with at most
+  /// two rotations, so the amortized restructuring work per insertion is O(1).
+  inline void
+  rb_tree_insert_and_rebalance(const bool __insert_left,
+                               rb_tree_node_base* __x,
+                               rb_tree_node_base* __p,
+                               rb_tree_node_base& __header) noexcept
+  {
+    __x->__set_parent(__p);
+    __x->m_left   = nullptr;
+    __x->m_right  = nullptr;
+    __x->__set_color(rb_tree_color::red);
+    rb_tree_update_size(__x);
+    rb_tree_adjust_path_size(__p, &__header, 1);
+    rb_tree_thread_insert(__insert_left, __x, __p);
+
+    if ( __insert_left ) {
+      __p->m_left = __x; // Also makes leftmost = __x when __p == &__header
+
+      if ( __p == &__header ) {
+        __header.__set_parent(__x);
+        __header.m_right = __x;
+      } else if ( __p == __header.m_left ) {
+        __header.m_left = __x; // Maintain leftmost pointing to min node
+      }
+    } else {
+      __p->m_right = __x;
+
+      if ( __p == __header.m_right )
+        __header.m_right = __x; // Maintain rightmost pointing to max node
+    }
+
+    rb_tree_insert_fixup(__x, __header);
+  }
+
+  /// @brief Unlink a node from the tree and restore the red-black invariants.
+  /// @param __z The node to remove.
+  /// @param __header The tree header; its root/leftmost/rightmost links are kept up to date.
+  /// @return The unlinked node, ready to be destroyed by the caller.
+  /// @details
+  /// A node with two children is swapped (by relinking, not by copying values) with its
+  /// successor, so iterators to other elements stay valid. The fix-up loop performs at
+  /// most three rotations.
+  inline rb_tree_node_base*
+  rb_tree_rebalance_for_erase(rb_tree_node_base* const __z, rb_tree_node_base& __header) noexcept
+  {
+    rb_tree_node_base*& __leftmost  = __header.m_left;
+    rb_tree_node_base*& __rightmost = __header.m_right;
+
+    rb_tree_node_base* __y        = __z;
+    rb_tree_node_base* __x        = nullptr;
+    rb_tree_node_base* __x_parent = nullptr;
+
+    if ( __y->m_left == nullptr ) {        // __z has at most one non-null child. __y == __z.
+      __x = __y->m_right;                  // __x might be null.
+    } else if ( __y->m_right == nullptr ) { // __z has exactly one non-null child. __y == __z.
+      __x = __y->m_left;                   // __x is not null.
+    } else {                               // __z has two non-null children. Set __y to
+      __y = __y->m_right;                  //   __z's successor. __x might be null.
+      while ( __y->m_left != nullptr ) __y = __y->m_left;
+      __x = __y->m_right;
+    }
+    rb_tree_adjust_path_size(__y->__parent(), &__header, -1);
+# if defined(FT_RB_TREE_THREADED_NODE)
+    rb_tree_thread_link(__z->m_prev, __z->m_next); // __z keeps its own links for the ends below
+# endif
+
+    if ( __y != __z ) {
+      // Relink __y in place of __z. __y is __z's successor.
+      __z->m_left->__set_parent(__y);
+      __y->m_left = __z->m_left;
+
+      if ( __y != __z->m_right ) {
+        __x_parent = __y->__parent();
+        if ( __x != nullptr ) __x->__set_parent(__y->__parent());
+        __y->__parent()->m_left = __x;    // __y must be a child of m_left
+        __y->m_right = __z->m_right;
+        __z->m_right->__set_parent(__y);
+      } else {
+        __x_parent = __y;
+      }
+
+      if ( __header.__parent() == __z )
+        __header.__set_parent(__y);
+      else if ( __z->__parent()->m_left == __z )
+        __z->__parent()->m_left = __y;
+      else
+        __z->__parent()->m_right = __y;
+
+      __y->__set_parent(__z->__parent());
+# if defined(FT_RB_TREE_ORDER_STATISTICS)
+      __y->m_size = __z->m_size;
+# endif
+
+      rb_tree_color __tmp = __y->__color();
+      __y->__set_color(__z->__color());
+      __z->__set_color(__tmp);
+      __y = __z;                          // __y now points to the node to be actually deleted
+    } else {                              // __y == __z
+      __x_parent = __y->__parent();
+      if ( __x != nullptr ) __x->__set_parent(__y->__parent());
+
+      if ( __header.__parent() == __z )
+        __header.__set_parent(__x);
+      else if ( __z->__parent()->m_left == __z )
+        __z->__parent()->m_left = __x;
+      else
+        __z->__parent()->m_right = __x;
+
+# if defined(FT_RB_TREE_THREADED_NODE)
+      if ( __leftmost == __z )  __leftmost  = __z->m_next; // The header if __z was the only node
+      if ( __rightmost == __z ) __rightmost = __z->m_prev;
+# else
+      if ( __leftmost == __z ) {
+        if ( __z->m_right == nullptr )    // __z->m_left must be null also
+          __leftmost = __z->__parent();     // makes __leftmost == &__header if __z == __root
+        else
+          __leftmost = rb_tree_node_base::minimum(__x);
+      }
+      if ( __rightmost == __z ) {
+        if ( __z->m_left == nullptr )     // __z->m_right must be null also
+          __rightmost = __z->__parent();    // makes __rightmost == &__header if __z == __root
+        else                              // __x == __z->m_left
+          __rightmost = rb_tree_node_base::maximum(__x);
+      }
+# endif
+    }
+
+    if ( __y->__color() != rb_tree_color::red ) {
+      while ( __x != __header.__parent() && (__x == nullptr || __x->__color() == rb_tree_color::black) ) {
+        if ( __x == __x_parent->m_left ) {
+          rb_tree_node_base* __w = __x_parent->m_right;
+
+          if ( __w->__color() == rb_tree_color::red ) {
+            rb_tree_recolor(__w, rb_tree_color::black);
+            rb_tree_recolor(__x_parent, rb_tree_color::red);
+            rb_tree_rotate_left(__x_parent, __header);
+            __w = __x_parent->m_right;
+          }
+          if ( (__w->m_left  == nullptr || __w->m_left->__color()  == rb_tree_color::black) &&
+               (__w->m_right == nullptr || __w->m_right->__color() == rb_tree_color::black) ) {
+            rb_tree_recolor(__w, rb_tree_color::red);
+            __x          = __x_parent;
+            __x_parent   = __x_parent->__parent();
+          } else {
+            if ( __w->m_right == nullptr || __w->m_right->__color() == rb_tree_color::black ) {
+              rb_tree_recolor(__w->m_left, rb_tree_color::black);
+              rb_tree_recolor(__w, rb_tree_color::red);
+              rb_tree_rotate_right(__w, __header);
+              __w = __x_parent->m_right;
+            }
+            rb_tree_recolor(__w, __x_parent->__color());
+            rb_tree_recolor(__x_parent, rb_tree_color::black);
+            if ( __w->m_right != nullptr ) rb_tree_recolor(__w->m_right, rb_tree_color::black);
+            rb_tree_rotate_left(__x_parent, __header);
+            break;
+          }
+        } else {
+          // Same as above, with m_right <-> m_left.
+          rb_tree_node_base* __w = __x_parent->m_left;
+
+          if ( __w->__color() == rb_tree_color::red ) {
+            rb_tree_recolor(__w, rb_tree_color::black);
+            rb_tree_recolor(__x_parent, rb_tree_color::red);
+            rb_tree_rotate_right(__x_parent, __header);
+            __w = __x_parent->m_left;
+          }
+          if ( (__w->m_right == nullptr || __w->m_right->__color() == rb_tree_color::black) &&
+               (__w->m_left  == nullptr || __w->m_left->__color()  == rb_tree_color::black) ) {
+            rb_tree_recolor(__w, rb_tree_color::red);
+            __x          = __x_parent;
+            __x_parent   = __x_parent->__parent();
+          } else {
+            if ( __w->m_left == nullptr || __w->m_left->__color() == rb_tree_color::black ) {
+              rb_tree_recolor(__w->m_right, rb_tree_color::black);
+              rb_tree_recolor(__w, rb_tree_color::red);
+              rb_tree_rotate_left(__w, __header);
+              __w = __x_parent->m_left;
+            }
+            rb_tree_recolor(__w, __x_parent->__color());
+            rb_tree_recolor(__x_parent, rb_tree_color::black);
+            if ( __w->m_left != nullptr ) rb_tree_recolor(__w->m_left, rb_tree_color::black);
+            rb_tree_rotate_right(__x_parent, __header);
+            break;
+          }
+        }
+      }
+      if ( __x != nullptr ) rb_tree_recolor(__x, rb_tree_color::black);
+    }
+    return __y;
+  }
+
+  /// @brief Get the black height of a subtree.
+  /// @param __x The root of the subtree, or nullptr.
+  /// @return The number of black nodes on any path from __x down to an empty link.
+  inline unsigned int
+  rb_tree_black_height(const rb_tree_node_base* __x) noexcept
+  {
+    unsigned int __h = 0;
+
+    for ( ; __x != nullptr; __x = __x->m_left )
+      if ( __x->__color() == rb_tree_color::black ) ++__h;
+    return __h;
+  }
+
+  /// @brief Join two detached trees of known black heights around a pivot node.
+  /// @param __l The root of a tree whose keys all order before the pivot, or nullptr.
+  /// @param __hl The black height of __l, counting its root as black.
+  /// @param __k The pivot node, which must not be linked.
+  /// @param __r The root of a tree whose keys all order after the pivot, or nullptr.
+  /// @param __hr The black height of __r, counting its root as black.
+  /// @param __height Set to the black height of the joined tree.
+  /// @return The root of the joined tree; it is black and has no parent.
+  /// @details
+  /// The roots of __l and __r are blackened first, which is always valid. If their black
+  /// heights differ, the pivot replaces the first black node of matching height on the
+  /// inner spine of the taller tree, as a red node adopting that node and the shorter
+  /// tree, and the insertion fix-up repairs a possible red-red violation above it.
+  /// The detached trees are given a temporary header so the rotations can move the root.
+  /// With threaded nodes the pivot is linked between the maximum of __l and the minimum of
+  /// __r; the outer links of a detached tree are left dangling until it is attached.
+  ///
+  /// The cost is proportional to the difference of the black heights, which is what keeps
+  /// a split made of successive joins in O(log n).
+  inline rb_tree_node_base*
+  rb_tree_join(rb_tree_node_base* __l, unsigned int __hl, rb_tree_node_base* __k,
+               rb_tree_node_base* __r, unsigned int __hr, unsigned int& __height) noexcept
+  {
+# if defined(FT_RB_TREE_THREADED_NODE)
+    if ( __l != nullptr ) rb_tree_thread_link(rb_tree_node_base::maximum(__l), __k);
+    if ( __r != nullptr ) rb_tree_thread_link(__k, rb_tree_node_base::minimum(__r));
+# endif
+    if ( __l != nullptr ) rb_tree_recolor(__l, rb_tree_color::black);
+    if ( __r != nullptr ) rb_tree_recolor(__r, rb_tree_color::black);
+
+    if ( __hl == __hr ) {
+      __k->m_left  = __l;
+      __k->m_right = __r;
+      __k->__set_parent(nullptr);
+      __k->__set_color(rb_tree_color::black);
+      if ( __l != nullptr ) __l->__set_parent(__k);
+      if ( __r != nullptr ) __r->__set_parent(__k);
+      rb_tree_update_size(__k);
+      __height = __hl + 1;
+      return __k;
+    }
+
+    rb_tree_node_base  __header{};
+    rb_tree_node_base* __top = __hl > __hr ? __l : __r;
+    rb_tree_node_base* __p   = nullptr;
+    rb_tree_node_base* __c   = __top;
+    unsigned int       __h   = __hl > __hr ? __hl : __hr;
+    const unsigned int __to  = __hl > __hr ? __hr : __hl;
+
+    __height = __h;
+    while ( __c != nullptr && !( __c->__color() == rb_tree_color::black && __h == __to ) ) {
+      if ( __c->__color() == rb_tree_color::black ) --__h;
+      __p = __c;
+      __c = __hl > __hr ? __c->m_right : __c->m_left;
+    }
+
+    if ( __hl > __hr ) {
+      __k->m_left     = __c;
+      __k->m_right    = __r;
+      __p->m_right    = __k;
+      if ( __r != nullptr ) __r->__set_parent(__k);
+    } else {
+      __k->m_left     = __l;
+      __k->m_right    = __c;
+      __p->m_left     = __k;
+      if ( __l != nullptr ) __l->__set_parent(__k);
+    }
+    if ( __c != nullptr ) __c->__set_parent(__k);
+    __k->__set_parent(__p);
+    __k->__set_color(rb_tree_color::red);
+    rb_tree_update_size(__k);
+# if defined(FT_RB_TREE_ORDER_STATISTICS)
+    rb_tree_adjust_path_size(__p, nullptr,
+                             static_cast<std::ptrdiff_t>(rb_tree_subtree_size(__k) - rb_tree_subtree_size(__c)));
+# endif
+
+    __header.__set_parent(__top);
+    __top->__set_parent(&__header);
+    if ( rb_tree_insert_fixup(__k, __header) ) ++__height;
+
+    __top = __header.__parent();
+    __top->__set_parent(nullptr);
+    return __top;
+  }
+
+  /// @brief Join two detached trees around a pivot node.
+  /// @details Like the overload above, measuring the black heights along the left spines.
+  inline rb_tree_node_base*
+  rb_tree_join(rb_tree_node_base* __l, rb_tree_node_base* __k, rb_tree_node_base* __r) noexcept
+  {
+    unsigned int __height;
+
+    if ( __l != nullptr ) rb_tree_recolor(__l, rb_tree_color::black);
+    if ( __r != nullptr ) rb_tree_recolor(__r, rb_tree_color::black);
+    return rb_tree_join(__l, rb_tree_black_height(__l), __k, __r, rb_tree_black_height(__r), __height);
+  }
+
+  /// @brief Concatenate two detached trees.
+  /// @param __l The root of a tree whose keys all order before those of __r, or nullptr.
+  /// @param __r The root of the other tree, or nullptr.
+  /// @return The root of the concatenated tree; it has no parent.
+  /// @details The maximum of __l is unlinked and used as the pivot of `rb_tree_join`.
+  inline rb_tree_node_base*
+  rb_tree_join(rb_tree_node_base* __l, rb_tree_node_base* __r) noexcept
+  {
+    if ( __l == nullptr ) return __r;
+    if ( __r == nullptr ) return __l;
+
+    rb_tree_node_base __header{};
+
+    __header.__set_parent(__l);
+    __header.m_left  = rb_tree_node_base::minimum(__l);
+    __header.m_right = rb_tree_node_base::maximum(__l);
+    __l->__set_parent(&__header);
+    rb_tree_thread_link(&__header, __header.m_left);
+    rb_tree_thread_link(__header.m_right, &__header);
+
+    rb_tree_node_base* const __k = rb_tree_rebalance_for_erase(__header.m_right, __header);
+
+    __l = __header.__parent();
+    if ( __l != nullptr ) __l->__set_parent(nullptr);
+    return rb_tree_join(__l, __k, __r);
+  }
+
+# if defined(FT_RB_TREE_ORDER_STATISTICS)
+  /// @brief Whether __x is the header of a tree, i.e. its past-the-end node.
+  /// @details Nodes of a tree always have a parent; only the header of an empty tree has
+  /// none. Otherwise the header is the only red node whose grandparent is itself.
+  inline bool
+  rb_tree_is_header(const rb_tree_node_base* __x) noexcept
+  {
+    return __x->__parent() == nullptr ||
+           ( __x->__color() == rb_tree_color::red && __x->__parent()->__parent() == __x );
+  }
+
+  /// @brief Get the header of the tree __x belongs to, by climbing the parent links.
+  inline const rb_tree_node_base*
+  rb_tree_header_of(const rb_tree_node_base* __x) noexcept
+  {
+    while ( !rb_tree_is_header(__x) ) __x = __x->__parent();
+    return __x;
+  }
+
+  /// @brief Get the in-order position of a node.
+  /// @param __x A node of a tree, or its header.
+  /// @return The number of nodes before __x; the size of the tree for the header.
+  /// @details Climbs from __x to the root, adding the left subtree and the node itself
+  /// whenever the path comes up from a right child. O(log n).
+  inline std::size_t
+  rb_tree_rank(const rb_tree_node_base* __x) noexcept
+  {
+    if ( rb_tree_is_header(__x) ) return rb_tree_subtree_size(__x->__parent());
+
+    std::size_t __r = rb_tree_subtree_size(__x->m_left);
+    for ( const rb_tree_node_base* __p = __x->__parent(); !rb_tree_is_header(__p); __x = __p, __p = __p->__parent() )
+      if ( __x == __p->m_right ) __r += rb_tree_subtree_size(__p->m_left) + 1;
+    return __r;
+  }
+
+  /// @brief Find the node at a given in-order position.
+  /// @param __root The root of the tree, or nullptr.
+  /// @param __k The position, counted from zero.
+  /// @return The node, or nullptr if __k is not less than the size of the tree. O(log n).
+  inline rb_tree_node_base*
+  rb_tree_select(rb_tree_node_base* __root, std::size_t __k) noexcept
+  {
+    while ( __root != nullptr ) {
+      const std::size_t __l = rb_tree_subtree_size(__root->m_left);
+
+      if ( __k < __l ) {
+        __root = __root->m_left;
+      } else if ( __k == __l ) {
+        return __root;
+      } else {
+        __k   -= __l + 1;
+        __root = __root->m_right;
+      }
+    }
+    return nullptr;
+  }
+
+  /// @brief Move __n positions from __x, forwards or backwards.
+  /// @param __x A node of a tree, or its header.
+  /// @return The node __n positions away, or the header when that is one past the last node.
+  inline rb_tree_node_base*
+  rb_tree_advance(rb_tree_node_base* __x, std::ptrdiff_t __n) noexcept
+  {
+    rb_tree_node_base* const __header = const_cast<rb_tree_node_base*>(rb_tree_header_of(__x));
+    const std::size_t        __k      = rb_tree_rank(__x) + static_cast<std::size_t>(__n);
+    rb_tree_node_base* const __y      = rb_tree_select(__header->__parent(), __k);
+
+    return __y == nullptr ? __header : __y;
+  }
+# endif
+
+  /// @brief Count the black nodes on the path from __node up to __root.
+  /// @param __node The node at which the path starts.
+  /// @param __root The root at which the path ends.
+  /// @return The number of black nodes on the path, used to verify the tree invariants.
+  inline unsigned int
+  rb_tree_black_count(const rb_tree_node_base* __node, const rb_tree_node_base* __root) noexcept
+  {
+    if ( __node == nullptr ) return 0;
+
+    unsigned int __sum = 0;
+    do {
+      if ( __node->__color() == rb_tree_color::black ) ++__sum;
+      if ( __node == __root ) break;
+      __node = __node->__parent();
+    } while ( true );
+
+    return __sum;
+  }
+
+} // namespace ft
+
+#endif // __FT_RB_TREE_BASE_FUNCS__
@@ -21,18 +21,20 @@ namespace ft {
       : m_header{ },
         m_nodeCount{ 0 }
     {
-      m_header.m_color = rb_tree_color::red; // Set the header color to red
+      m_header.__set_color(rb_tree_color::red); // Set the header color to red
       __reset();
     }
 
     /// @brief Move constructor.
     /// @details Moves the data from another rb_tree_header instance.
     rb_tree_header(rb_tree_header&& __x) noexcept
+      : m_header{ },
+        m_nodeCount{ 0 }
     {
-      if ( __x.m_header.m_parent != nullptr ) {
+      if ( __x.m_header.__parent() != nullptr ) {
         __move_data(__x);
       } else {
-        m_header.m_color = rb_tree_color::red; // Set the header color to red
+        m_header.__set_color(rb_tree_color::red); // Set the header color to red
         __reset();
       }
     }
@@ -42,13 +44,14 @@ namespace ft {
     void
     __move_data(rb_tree_header& __from) noexcept
     {
-      m_header.m_color  = __from.m_header.m_color ;
-      m_header.m_parent = __from.m_header.m_parent;
-      m_header.m_left   = __from.m_header.m_left  ;
-      m_header.m_right  = __from.m_header.m_right ;
+      m_header.__set_color(__from.m_header.__color());
+      m_header.__set_parent(__from.m_header.__parent());
+      m_header.m_left  = __from.m_header.m_left;
+      m_header.m_right = __from.m_header.m_right;
 
-      m_header.m_parent->m_parent = &m_header; // Update parent pointer
+      m_header.__parent()->__set_parent(&m_header); // Update parent pointer
       m_nodeCount = __from.m_nodeCount;
+      __thread_ends();
 
       __from.__reset(); // Reset the source header
     }
@@ -58,10 +61,31 @@ namespace ft {
     void
     __reset() noexcept
     {
-      m_header.m_parent = nullptr;   // No parent node
-      m_header.m_left   = &m_header; // Leftmost node points to itself
-      m_header.m_right  = &m_header; // Rightmost node points to itself
-      m_nodeCount       = 0;         // No nodes in the tree
+      m_header.__set_parent(nullptr); // No parent node
+      m_header.m_left  = &m_header;   // Leftmost node points to itself
+      m_header.m_right = &m_header;   // Rightmost node points to itself
+      m_nodeCount      = 0;           // No nodes in the tree
+# if defined(FT_RB_TREE_ORDER_STATISTICS)
+      m_header.m_size  = 0;           // The header belongs to no subtree
+# endif
+# if defined(FT_RB_TREE_THREADED_NODE)
+      m_header.m_next  = &m_header;   // The thread list is empty
+      m_header.m_prev  = &m_header;
+# endif
+    }
+
+    /// @brief Close the thread list through the header, from the leftmost and rightmost links.
+    /// @details Only the two end links change; the links between nodes must already be set.
+    /// Does nothing unless `FT_RB_TREE_THREADED_NODE` is defined.
+    void
+    __thread_ends() noexcept
+    {
+# if defined(FT_RB_TREE_THREADED_NODE)
+      m_header.m_next = m_header.m_left;
+      m_header.m_prev = m_header.m_right;
+      m_header.m_left->m_prev  = &m_header;
+      m_header.m_right->m_next = &m_header;
+# endif
     }
   };
 
@@ -0,0 +1,190 @@
+#ifndef   __FT_RB_TREE_INSTRUMENT__
+# define  __FT_RB_TREE_INSTRUMENT__
+
+# include <cstddef> // For std::size_t
+# include <cstdint> // For std::uint64_t
+# include <vector>  // For std::vector
+
+# if defined(FT_INSTRUMENT)
+#  include <atomic> // For std::atomic, std::memory_order_relaxed
+# endif
+
+namespace ft {
+
+  /// @brief What the operations on one tree have done, as returned by `counters()`.
+  /// @details Only available when `FT_INSTRUMENT` is defined. The counts accumulate over
+  /// the life of the tree, so the cost of one operation is the difference of the counts
+  /// taken around it:
+  /// ```cpp
+  /// const ft::rb_tree_counters __before = __m.counters();
+  /// __m.insert(__v);
+  /// const ft::rb_tree_counters __cost = __m.counters() - __before;
+  /// ```
+  struct rb_tree_counters
+  {
+    std::uint64_t comparisons   = 0; ///< Calls of the key comparison function.
+    std::uint64_t rotations     = 0; ///< Single rotations done by rebalancing, splits and joins.
+    std::uint64_t recolorings   = 0; ///< Color changes of linked nodes.
+    std::uint64_t allocations   = 0; ///< Nodes allocated.
+    std::uint64_t deallocations = 0; ///< Nodes deallocated one by one; a bulk release counts none.
+    std::uint64_t node_visits   = 0; ///< Nodes whose key was read, mostly on search paths.
+
+    friend rb_tree_counters
+    operator-(const rb_tree_counters& __x, const rb_tree_counters& __y) noexcept
+    {
+      rb_tree_counters __r;
+
+      __r.comparisons   = __x.comparisons - __y.comparisons;
+      __r.rotations     = __x.rotations - __y.rotations;
+      __r.recolorings   = __x.recolorings - __y.recolorings;
+      __r.allocations   = __x.allocations - __y.allocations;
+      __r.deallocations = __x.deallocations - __y.deallocations;
+      __r.node_visits   = __x.node_visits - __y.node_visits;
+      return __r;
+    }
+  };
+
+  /// @brief The shape of a tree, as returned by `stats()`.
+  /// @details Computed by a walk over every node when asked for, so it costs nothing
+  /// otherwise and is available whether or not `FT_INSTRUMENT` is defined.
+  struct rb_tree_stats
+  {
+    std::size_t              node_count   = 0; ///< The number of elements, from `rb_tree_header::m_nodeCount`.
+    std::size_t              height       = 0; ///< The number of levels; 0 for an empty tree.
+    std::size_t              black_height = 0; ///< The number of black nodes on every path from the root down.
+    std::size_t              bytes        = 0; ///< The tree object and its nodes, not counting memory the values own.
+    std::vector<std::size_t> depth_histogram;  ///< The number of nodes at each depth, the root at depth 0.
+  };
+
+# if defined(FT_INSTRUMENT)
+
+  /// @brief The kinds of events counted by `rb_tree_event_counters`.
+  enum class rb_tree_event
+  {
+    comparison,
+    rotation,
+    recoloring,
+    allocation,
+    deallocation,
+    node_visit,
+    __count
+  };
+
+  /// @brief The live event counts of one tree.
+  /// @details The counts are relaxed atomics, as the parallel algorithms and concurrent
+  /// readers of one tree may count at once. A copied tree counts from zero; a moved tree
+  /// keeps its counts; assignment leaves the counts of the target alone.
+  class rb_tree_event_counters
+  {
+    public:
+      rb_tree_event_counters() noexcept : m_counts{ } { }
+
+      rb_tree_event_counters(const rb_tree_event_counters&) noexcept : m_counts{ } { }
+
+      rb_tree_event_counters(rb_tree_event_counters&& __x) noexcept
+        : m_counts{ }
+      {
+        for ( std::size_t __i = 0; __i < __size; ++__i )
+          m_counts[__i].store(__x.m_counts[__i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+      }
+
+      rb_tree_event_counters& operator=(const rb_tree_event_counters&) noexcept { return *this; }
+
+      void
+      __add(rb_tree_event __e) noexcept
+      {
+        m_counts[static_cast<std::size_t>(__e)].fetch_add(1, std::memory_order_relaxed);
+      }
+
+      rb_tree_counters
+      __snapshot() const noexcept
+      {
+        rb_tree_counters __r;
+
+        __r.comparisons   = __get(rb_tree_event::comparison);
+        __r.rotations     = __get(rb_tree_event::rotation);
+        __r.recolorings   = __get(rb_tree_event::recoloring);
+        __r.allocations   = __get(rb_tree_event::allocation);
+        __r.deallocations = __get(rb_tree_event::deallocation);
+        __r.node_visits   = __get(rb_tree_event::node_visit);
+        return __r;
+      }
+
+      void
+      __reset() noexcept
+      {
+        for ( std::atomic<std::uint64_t>& __c : m_counts ) __c.store(0, std::memory_order_relaxed);
+      }
+
+    private:
+      static constexpr std::size_t __size = static_cast<std::size_t>(rb_tree_event::__count);
+
+      std::uint64_t
+      __get(rb_tree_event __e) const noexcept
+      {
+        return m_counts[static_cast<std::size_t>(__e)].load(std::memory_order_relaxed);
+      }
+
+    private:
+      std::atomic<std::uint64_t> m_counts[__size]; ///< One count per event kind.
+  };
+
+  /// @brief The counters that the free tree algorithms of the calling thread report to.
+  /// @details Rotations and recolorings happen in functions that do not know their tree;
+  /// a tree points this at its counters for the duration of the calls that rebalance.
+  inline rb_tree_event_counters*&
+  __rb_tree_active_counters() noexcept
+  {
+    static thread_local rb_tree_event_counters* __active = nullptr;
+    return __active;
+  }
+
+  /// @brief Make a tree's counters the active ones of the calling thread until destroyed.
+  class rb_tree_count_scope
+  {
+    public:
+      explicit
+      rb_tree_count_scope(rb_tree_event_counters& __c) noexcept
+        : m_previous{ __rb_tree_active_counters() }
+      {
+        __rb_tree_active_counters() = &__c;
+      }
+
+      ~rb_tree_count_scope() { __rb_tree_active_counters() = m_previous; }
+
+      rb_tree_count_scope(const rb_tree_count_scope&) = delete;
+      rb_tree_count_scope& operator=(const rb_tree_count_scope&) = delete;
+
+    private:
+      rb_tree_event_counters* m_previous; ///< The counters active before, restored on exit.
+  };
+
+/// Count an event into the active counters of the calling thread, if any.
+#  define FT_RB_TREE_COUNT(__event) \
+     do { \
+       if ( ::ft::rb_tree_event_counters* __ft_c = ::ft::__rb_tree_active_counters() ) \
+         __ft_c->__add(::ft::rb_tree_event::__event); \
+     } while ( 0 )
+
+/// Count an event into the active counters if __cond holds; __cond is not evaluated otherwise.
+#  define FT_RB_TREE_COUNT_IF(__cond, __event) \
+     do { if ( ::ft::__rb_tree_active_counters() != nullptr && ( __cond ) ) FT_RB_TREE_COUNT(__event); } while ( 0 )
+
+/// Count an event into the given counters.
+#  define FT_RB_TREE_COUNT_IN(__counters, __event) ( ( __counters ).__add(::ft::rb_tree_event::__event) )
+
+/// Make the given counters active for the rest of the enclosing block.
+#  define FT_RB_TREE_COUNT_SCOPE(__counters) const ::ft::rb_tree_count_scope __ft_count_scope(__counters)
+
+# else
+
+#  define FT_RB_TREE_COUNT(__event)                ((void)0)
+#  define FT_RB_TREE_COUNT_IF(__cond, __event)     ((void)0)
+#  define FT_RB_TREE_COUNT_IN(__counters, __event) ((void)0)
+#  define FT_RB_TREE_COUNT_SCOPE(__counters)       ((void)0)
+
+# endif
+
+} // namespace ft
+
+#endif // __FT_RB_TREE_INSTRUMENT__
@@ -0,0 +1,219 @@
+#ifndef   __FT_RB_TREE_ITERATOR__
+# define  __FT_RB_TREE_ITERATOR__
+
+# include <cstddef> // For std::ptrdiff_t
+
+# include "../iterator/iterator_base_types.h" // For bidirectional_iterator_tag, order_statistic_iterator_tag
+# include "rb_tree_node.h"                    // For rb_tree_node
+# include "rb_tree_base_functions.h"          // For rb_tree_increment, rb_tree_decrement, rb_tree_rank
+
+namespace ft {
+
+  /// @brief Bidirectional iterator over the values of a red-black tree.
+  /// @details The iterator holds a pointer to a node base; the header node plays the
+  /// role of the past-the-end position, so `--end()` yields the rightmost node.
+  template <typename _Tp>
+  struct rb_tree_iterator
+  {
+    using value_type        = _Tp;                        ///< The type of the value pointed to by the iterator.
+    using reference         = _Tp&;                       ///< Reference type to the value.
+    using pointer           = _Tp*;                       ///< Pointer type to the value.
+    using iterator_category = bidirectional_iterator_tag; ///< The category of the iterator.
+    using difference_type   = std::ptrdiff_t;             ///< The type used for representing the difference between two iterators.
+
+    using self      = rb_tree_iterator<_Tp>;
+    using base_ptr  = rb_tree_node_base::base_ptr;
+    using link_type = rb_tree_node<_Tp>*;
+
+    base_ptr m_node; ///< The node the iterator points to.
+
+# if defined(FT_RB_TREE_ORDER_STATISTICS)
+    using order_statistic_category = order_statistic_iterator_tag; ///< Makes `ft::distance` and `ft::advance` O(log n).
+
+    static difference_type
+    __order_distance(const self& __first, const self& __last) noexcept
+    {
+      return static_cast<difference_type>(rb_tree_rank(__last.m_node)) -
+             static_cast<difference_type>(rb_tree_rank(__first.m_node));
+    }
+
+    static void
+    __order_advance(self& __i, difference_type __n) noexcept
+    {
+      __i.m_node = rb_tree_advance(__i.m_node, __n);
+    }
+# endif
+
+    /// @brief Default constructor.
+    rb_tree_iterator() noexcept
+      : m_node{ } { }
+
+    /// @brief Constructor from a node.
+    /// @param __x The node to point to.
+    explicit
+    rb_tree_iterator(base_ptr __x) noexcept
+      : m_node{ __x } { }
+
+    /// @brief Dereference operator.
+    /// @return A reference to the value stored in the node.
+    reference
+    operator*() const noexcept { return *static_cast<link_type>(m_node)->__valptr(); }
+
+    /// @brief Arrow operator.
+    /// @return A pointer to the value stored in the node.
+    pointer
+    operator->() const noexcept { return static_cast<link_type>(m_node)->__valptr(); }
+
+    /// @brief Pre-increment operator.
+    self&
+    operator++() noexcept
+    {
+      m_node = rb_tree_increment(m_node);
+      return *this;
+    }
+
+    /// @brief Post-increment operator.
+    self
+    operator++(int) noexcept
+    {
+      self __tmp = *this;
+      m_node = rb_tree_increment(m_node);
+      return __tmp;
+    }
+
+    /// @brief Pre-decrement operator.
+    self&
+    operator--() noexcept
+    {
+      m_node = rb_tree_decrement(m_node);
+      return *this;
+    }
+
+    /// @brief Post-decrement operator.
+    self
+    operator--(int) noexcept
+    {
+      self __tmp = *this;
+      m_node = rb_tree_decrement(m_node);
+      return __tmp;
+    }
+
+    friend bool
+    operator==(const self& __x, const self& __y) noexcept { return __x.m_node == __y.m_node; }
+
+    friend bool
+    operator!=(const self& __x, const self& __y) noexcept { return __x.m_node != __y.m_node; }
+  };
+
+  /// @brief Constant bidirectional iterator over the values of a red-black tree.
+  /// @details Implicitly constructible from the mutable iterator, and comparable with it.
+  template <typename _Tp>
+  struct rb_tree_const_iterator
+  {
+    using value_type        = _Tp;                        ///< The type of the value pointed to by the iterator.
+    using reference         = const _Tp&;                 ///< Reference type to the value.
+    using pointer           = const _Tp*;                 ///< Pointer type to the value.
+    using iterator_category = bidirectional_iterator_tag; ///< The category of the iterator.
+    using difference_type   = std::ptrdiff_t;             ///< The type used for representing the difference between two iterators.
+
+    using iterator  = rb_tree_iterator<_Tp>;
+    using self      = rb_tree_const_iterator<_Tp>;
+    using base_ptr  = rb_tree_node_base::const_base_ptr;
+    using link_type = const rb_tree_node<_Tp>*;
+
+    base_ptr m_node; ///< The node the iterator points to.
+
+# if defined(FT_RB_TREE_ORDER_STATISTICS)
+    using order_statistic_category = order_statistic_iterator_tag; ///< Makes `ft::distance` and `ft::advance` O(log n).
+
+    static difference_type
+    __order_distance(const self& __first, const self& __last) noexcept
+    {
+      return static_cast<difference_type>(rb_tree_rank(__last.m_node)) -
+             static_cast<difference_type>(rb_tree_rank(__first.m_node));
+    }
+
+    static void
+    __order_advance(self& __i, difference_type __n) noexcept
+    {
+      __i.m_node = rb_tree_advance(const_cast<rb_tree_node_base*>(__i.m_node), __n);
+    }
+# endif
+
+    /// @brief Default constructor.
+    rb_tree_const_iterator() noexcept
+      : m_node{ } { }
+
+    /// @brief Constructor from a node.
+    /// @param __x The node to point to.
+    explicit
+    rb_tree_const_iterator(base_ptr __x) noexcept
+      : m_node{ __x } { }
+
+    /// @brief Converting constructor from a mutable iterator.
+    /// @param __it The iterator to convert.
+    rb_tree_const_iterator(const iterator& __it) noexcept
+      : m_node{ __it.m_node } { }
+
+    /// @brief Get a mutable iterator to the same node.
+    /// @details Used by the tree to implement erase and hinted insertion on const iterators.
+    iterator
+    __const_cast() const noexcept
+    {
+      return iterator(const_cast<typename iterator::base_ptr>(m_node));
+    }
+
+    /// @brief Dereference operator.
+    /// @return A const reference to the value stored in the node.
+    reference
+    operator*() const noexcept { return *static_cast<link_type>(m_node)->__valptr(); }
+
+    /// @brief Arrow operator.
+    /// @return A const pointer to the value stored in the node.
+    pointer
+    operator->() const noexcept { return static_cast<link_type>(m_node)->__valptr(); }
+
+    /// @brief Pre-increment operator.
+    self&
+    operator++() noexcept
+    {
+      m_node = rb_tree_increment(m_node);
+      return *this;
+    }
+
+    /// @brief Post-increment operator.
+    self
+    operator++(int) noexcept
+    {
+      self __tmp = *this;
+      m_node = rb_tree_increment(m_node);
+      return __tmp;
+    }
+
+    /// @brief Pre-decrement operator.
+    self&
+    operator--() noexcept
+    {
+      m_node = rb_tree_decrement(m_node);
+      return *this;
+    }
+
+    /// @brief Post-decrement operator.
+    self
+    operator--(int) noexcept
+    {
+      self __tmp = *this;
+      m_node = rb_tree_decrement(m_node);
+      return __tmp;
+    }
+
+    friend bool
+    operator==(const self& __x, const self& __y) noexcept { return __x.m_node == __y.m_node; }
+
+    friend bool
+    operator!=(const self& __x, const self& __y) noexcept { return __x.m_node != __y.m_node; }
+  };
+
+} // namespace ft
+
+#endif // __FT_RB_TREE_ITERATOR__
@@ -1,16 +1,38 @@
 #ifndef   __FT_RB_TREE_KEY_COMPARE__
 # define  __FT_RB_TREE_KEY_COMPARE__
 
-# include <type_traits>  // For std::is_nothrow_default_constructible, std::is_nothrow_move_constructible
+# include <type_traits>  // For std::is_nothrow_default_constructible, std::is_nothrow_move_constructible, std::is_empty, std::enable_if_t
 # include <utility>      // For std::move
 
 namespace ft {
 
+  /// @brief Detect whether a comparator accepts arguments of types other than the key type.
+  /// @details A comparator opts into heterogeneous lookup by declaring a nested
+  /// `is_transparent` type, as `std::less<void>` does. Lookups can then take any type the
+  /// comparator can compare against keys, without constructing a temporary key.
+  template <typename _Compare, typename = void>
+  struct is_transparent_compare : std::false_type { };
+
+  /// @brief Specialization for comparators declaring `is_transparent`.
+  template <typename _Compare>
+  struct is_transparent_compare<_Compare, std::void_t<typename _Compare::is_transparent>>
+    : std::true_type { };
+
+  /// @brief SFINAE helper, well-formed only if `_Compare` is transparent.
+  /// @details Used to enable the heterogeneous lookup overloads of the containers.
+  template <typename _Compare, typename _Kt>
+  using has_is_transparent_t = std::enable_if_t<is_transparent_compare<_Compare>::value, _Kt>;
+
   /// @brief A key comparison class for red-black trees.
   /// @details This class provides a way to compare keys in a red-black tree.
   /// It is used to maintain the order of elements in the tree.
   /// The class is designed to be default constructible and copyable.
-  template<typename KeyCompare>
+  ///
+  /// The comparator is reached through `__key_compare()`. Stateless comparators such as
+  /// `std::less<K>` are held as a base class instead of a member (see the specialization
+  /// below), so they take no space in the tree object.
+  template<typename KeyCompare,
+           bool = std::is_empty<KeyCompare>::value && !std::is_final<KeyCompare>::value>
   struct rb_tree_key_compare
   {
     KeyCompare m_keyCompare; ///< The key comparison function.
@@ -32,6 +54,47 @@ namespace ft {
     /// @param __x The instance to move from.
     rb_tree_key_compare(rb_tree_key_compare&& __x) noexcept(std::is_nothrow_move_constructible<KeyCompare>::value)
       : m_keyCompare{ std::move(__x.m_keyCompare) } {}
+
+    /// @brief Get the key comparison function.
+    KeyCompare&
+    __key_compare() noexcept { return m_keyCompare; }
+
+    /// @brief Get the key comparison function (const version).
+    const KeyCompare&
+    __key_compare() const noexcept { return m_keyCompare; }
+  };
+
+  /// @brief Specialization for empty comparators, stored through the empty-base optimization.
+  /// @details The comparator is a private base, so it shares the address of the other
+  /// empty bases of the tree and adds nothing to its size.
+  template<typename KeyCompare>
+  struct rb_tree_key_compare<KeyCompare, true> : private KeyCompare
+  {
+    /// @brief Default constructor.
+    rb_tree_key_compare() noexcept(std::is_nothrow_default_constructible<KeyCompare>::value)
+      : KeyCompare() {}
+
+    /// @brief Constructor with a key comparison function.
+    /// @param __comp The key comparison function to use.
+    rb_tree_key_compare(const KeyCompare& __comp)
+      : KeyCompare(__comp) {}
+
+    /// @brief Copy constructor.
+    /// @param __x The instance to copy from.
+    rb_tree_key_compare(const rb_tree_key_compare& __x) = default;
+
+    /// @brief Move constructor.
+    /// @param __x The instance to move from.
+    rb_tree_key_compare(rb_tree_key_compare&& __x) noexcept(std::is_nothrow_move_constructible<KeyCompare>::value)
+      : KeyCompare(std::move(__x.__key_compare())) {}
+
+    /// @brief Get the key comparison function.
+    KeyCompare&
+    __key_compare() noexcept { return *this; }
+
+    /// @brief Get the key comparison function (const version).
+    const KeyCompare&
+    __key_compare() const noexcept { return *this; }
   };
 
 } // namespace ft
@@ -1,7 +1,9 @@
 #ifndef   __FT_RB_TREE_NODE__
 # define  __FT_RB_TREE_NODE__
 
-# include <memory> // For std::addressof
+# include <memory>      // For std::addressof
+# include <type_traits> // For std::is_nothrow_default_constructible, std::is_nothrow_copy_constructible
+# include <utility>     // For std::in_place_t, std::forward
 
 # include "rb_tree_node_base.h" // For rb_tree_node_base, rb_tree_color
 
@@ -21,13 +23,22 @@ namespace ft {
 
     /// @brief Default constructor.
     /// @details Initializes the node with default values.
-    rb_tree_node() noexcept
+    rb_tree_node() noexcept(std::is_nothrow_default_constructible<ValueType>::value)
       : rb_tree_node_base{ }, m_valueField{ } {}
     
     /// @brief Constructor with a value.
     /// @param value The value to initialize the node with.
-    rb_tree_node(const ValueType& value) noexcept
+    rb_tree_node(const ValueType& value) noexcept(std::is_nothrow_copy_constructible<ValueType>::value)
       : rb_tree_node_base{ }, m_valueField{ value } {}
+
+    /// @brief In-place constructor.
+    /// @param __args The arguments forwarded to the constructor of the value.
+    /// @details The value is built directly in the node storage, without a temporary.
+    template <typename... _Args>
+    explicit
+    rb_tree_node(std::in_place_t, _Args&&... __args)
+      noexcept(std::is_nothrow_constructible<ValueType, _Args&&...>::value)
+      : rb_tree_node_base{ }, m_valueField(std::forward<_Args>(__args)...) {}
     
     /// @brief Pointer to the value field.
     /// @return A pointer to the value stored in the node.
@@ -1,6 +1,9 @@
 #ifndef   __FT_RB_TREE_NODE_BASE__
 # define  __FT_RB_TREE_NODE_BASE__
 
+# include <cstddef> // For std::size_t
+# include <cstdint> // For std::uintptr_t
+
 namespace ft {
 
   /// @brief Enum class representing the color of a red-black tree node.
@@ -61,14 +64,94 @@ namespace ft {
   /// It is designed to be used in conjunction with other components of the `ft` library, such as iterators and algorithms.
   ///
 
+  ///
+  /// Compact layout:
+  /// Defining `FT_RB_TREE_COMPACT_NODE` before including any ft header removes the separate
+  /// color field and stores the color in the low bit of the parent pointer instead, which
+  /// node alignment always leaves clear. This shrinks the node base from four words to
+  /// three. The parent and the color must then be accessed through `__parent()`,
+  /// `__set_parent()`, `__color()` and `__set_color()`, which every tree algorithm does
+  /// regardless of the layout.
+  ///
+  /// Order statistics:
+  /// Defining `FT_RB_TREE_ORDER_STATISTICS` adds the size of the subtree rooted at every
+  /// node, kept up to date by insertion, erasure and rotations. It costs one word per node
+  /// and O(log n) extra writes per update, and makes ranks, selection by rank, and
+  /// `ft::distance` / `ft::advance` on tree iterators O(log n).
+  ///
+  /// Threaded layout:
+  /// Defining `FT_RB_TREE_THREADED_NODE` adds in-order predecessor and successor links,
+  /// forming a circular list through the header. Incrementing or decrementing an iterator
+  /// is then a single load instead of a climb through parent links, at the cost of two
+  /// words per node and a few extra writes per insertion and erasure. Rotations do not
+  /// change the order, so they leave the links alone.
+  ///
+
   struct rb_tree_node_base {
     using base_ptr       =       rb_tree_node_base*; ///< Pointer to base node type.
     using const_base_ptr = const rb_tree_node_base*; ///< Const pointer to base node type.
-    
+
+# if defined(FT_RB_TREE_COMPACT_NODE)
+    std::uintptr_t m_parentColor; ///< Pointer to the parent node, with the color in bit 0.
+# else
     rb_tree_color m_color ; ///< Color of the node (red or black).
     base_ptr      m_parent; ///< Pointer to the parent node.
+# endif
     base_ptr      m_left  ; ///< Pointer to the left child node.
     base_ptr      m_right ; ///< Pointer to the right child node.
+# if defined(FT_RB_TREE_ORDER_STATISTICS)
+    std::size_t   m_size  ; ///< Number of nodes in the subtree rooted here; zero in the header.
+# endif
+# if defined(FT_RB_TREE_THREADED_NODE)
+    base_ptr      m_prev  ; ///< In-order predecessor; the header for the leftmost node.
+    base_ptr      m_next  ; ///< In-order successor; the header for the rightmost node.
+# endif
+
+# if defined(FT_RB_TREE_COMPACT_NODE)
+    /// @brief Get the parent node.
+    base_ptr
+    __parent() const noexcept
+    {
+      return reinterpret_cast<base_ptr>(m_parentColor & ~static_cast<std::uintptr_t>(1));
+    }
+
+    /// @brief Set the parent node, keeping the color.
+    void
+    __set_parent(base_ptr __p) noexcept
+    {
+      m_parentColor = reinterpret_cast<std::uintptr_t>(__p) | (m_parentColor & 1);
+    }
+
+    /// @brief Get the color of the node.
+    rb_tree_color
+    __color() const noexcept
+    {
+      return static_cast<rb_tree_color>(m_parentColor & 1);
+    }
+
+    /// @brief Set the color of the node, keeping the parent.
+    void
+    __set_color(rb_tree_color __c) noexcept
+    {
+      m_parentColor = (m_parentColor & ~static_cast<std::uintptr_t>(1)) | static_cast<std::uintptr_t>(__c);
+    }
+# else
+    /// @brief Get the parent node.
+    base_ptr
+    __parent() const noexcept { return m_parent; }
+
+    /// @brief Set the parent node, keeping the color.
+    void
+    __set_parent(base_ptr __p) noexcept { m_parent = __p; }
+
+    /// @brief Get the color of the node.
+    rb_tree_color
+    __color() const noexcept { return m_color; }
+
+    /// @brief Set the color of the node, keeping the parent.
+    void
+    __set_color(rb_tree_color __c) noexcept { m_color = __c; }
+# endif
 
     /// @brief Get the minimum node in the subtree rooted at x.
     /// @param x Pointer to the node from which to start searching for the minimum.
@@ -125,6 +208,19 @@ namespace ft {
     }
   };
 
+# if defined(FT_RB_TREE_COMPACT_NODE)
+  static_assert(alignof(rb_tree_node_base) >= 2,
+                "ft::rb_tree_node_base: the compact layout needs a free low bit in node addresses");
+  static_assert(sizeof(rb_tree_node_base) == 3 * sizeof(void*)
+# if defined(FT_RB_TREE_ORDER_STATISTICS)
+                                             + sizeof(std::size_t)
+# endif
+# if defined(FT_RB_TREE_THREADED_NODE)
+                                             + 2 * sizeof(void*)
+# endif
+                , "ft::rb_tree_node_base: the compact layout should be three pointers wide");
+# endif
+
 } // namespace ft
 
 #endif // _FT_RB_TREE_NODE_BASE__
\ No newline at end of file
@@ -0,0 +1,235 @@
+#ifndef   __FT_RB_TREE_PARALLEL__
+# define  __FT_RB_TREE_PARALLEL__
+
+# include <iterator>    // For std::random_access_iterator_tag
+# include <type_traits> // For std::true_type, std::false_type, std::integral_constant, std::is_convertible, std::is_same, std::decay_t
+
+# include "../iterator/iterator.h"            // For random_access_iterator_tag, iterator_category_t, reference_t
+# include "../parallel/work_stealing_pool.h"  // For work_stealing_pool, default_work_stealing_pool
+# include "rb_tree.h"                         // For rb_tree, rb_tree_parallel
+
+namespace ft {
+
+  /// @brief Forks the two halves of a divide-and-conquer tree algorithm onto a pool for
+  /// its top `m_levels` levels, and runs them one after the other below.
+  /// @details The parallel counterpart of `rb_tree_sequential_fork`.
+  struct rb_tree_pool_fork
+  {
+    work_stealing_pool* m_pool;   ///< The pool the halves run on.
+    unsigned int        m_levels; ///< The number of levels still to fork.
+
+    template <typename _Fn1, typename _Fn2>
+    void
+    operator()(_Fn1&& __f, _Fn2&& __g) const
+    {
+      if ( m_levels != 0 ) {
+        m_pool->invoke(__f, __g);
+      } else {
+        __f();
+        __g();
+      }
+    }
+
+    rb_tree_pool_fork
+    __next() const noexcept { return rb_tree_pool_fork{ m_pool, m_levels != 0 ? m_levels - 1 : 0 }; }
+  };
+
+  /// @brief The parallel algorithms of `rb_tree`, run on a `work_stealing_pool`.
+  /// @details The sorted build and the walk split the tree at the roots of its top
+  /// `fork_depth()` levels; the set algebra of the tree runs with a `rb_tree_pool_fork`.
+  /// The parallel members of `map`, `multimap`, `set` and `multiset` forward here, so code
+  /// calling them includes this header; the containers themselves do not, and need no
+  /// threads.
+  template <typename _Tree>
+  class rb_tree_parallel
+  {
+    private:
+      using tree            = _Tree;
+      using value_type      = typename tree::value_type;
+      using size_type       = typename tree::size_type;
+      using difference_type = typename tree::difference_type;
+      using link_type       = typename tree::link_type;
+
+    public:
+      /// @brief Replace the contents of __t with the values of a sorted range, building the
+      /// subtrees on the threads of __pool.
+      /// @details Like `rb_tree::assign_sorted`; every node is placed by its index in the
+      /// range, so the two halves below each of the top `fork_depth()` levels are built in
+      /// parallel and linked under their median. The allocator must be safe to use from
+      /// several threads.
+      template <typename _RandomAccessIterator>
+      static void
+      assign_sorted(tree& __t, _RandomAccessIterator __first, _RandomAccessIterator __last, work_stealing_pool& __pool)
+      {
+        __t.clear();
+        __build_sorted(__t, __first, static_cast<size_type>(tree::__range_length(__first, __last)), __pool);
+      }
+
+      /// @brief Like `rb_tree::__assign_range_unique`, with a sorted random access range
+      /// built on the threads of __pool. Other ranges are assigned sequentially.
+      template <typename _InputIterator>
+      static void
+      __assign_range_unique(tree& __t, _InputIterator __first, _InputIterator __last, work_stealing_pool& __pool)
+      {
+        __t.clear();
+        __assign_range(__t, __first, __last, true, __pool, __parallel_build_t<_InputIterator>());
+      }
+
+      /// @brief Like `rb_tree::__assign_range_equal`, with a sorted random access range
+      /// built on the threads of __pool. Other ranges are assigned sequentially.
+      template <typename _InputIterator>
+      static void
+      __assign_range_equal(tree& __t, _InputIterator __first, _InputIterator __last, work_stealing_pool& __pool)
+      {
+        __t.clear();
+        __assign_range(__t, __first, __last, false, __pool, __parallel_build_t<_InputIterator>());
+      }
+
+      /// @brief Call __f on every element of __t, on the threads of __pool.
+      /// @details The top `fork_depth()` levels of the tree are split at their roots; each
+      /// remaining subtree is walked in order by one thread. Calls happen in no particular
+      /// order and concurrently, so __f must be safe to call from several threads on distinct
+      /// elements. The tree must not be modified meanwhile. If __f throws, the exception is
+      /// rethrown once every started walk has finished.
+      template <typename _Function>
+      static void
+      __parallel_for_each(tree& __t, _Function& __f, work_stealing_pool& __pool = default_work_stealing_pool())
+      {
+        __for_each_subtree(__t.__begin(), __f, __pool, __pool.fork_depth());
+      }
+
+      template <typename _Function>
+      static void
+      __parallel_for_each(const tree& __t, _Function& __f, work_stealing_pool& __pool = default_work_stealing_pool())
+      {
+        __for_each_subtree(__t.__begin(), __f, __pool, __pool.fork_depth());
+      }
+
+      /// @brief `rb_tree::__union_unique`, `__intersect_unique` and `__difference_unique`
+      /// with the independent halves of the recursion run on the threads of __pool.
+      /// @details The allocator must be safe to use from several threads.
+      static void
+      __union_unique(tree& __t, tree& __x, work_stealing_pool& __pool) { __t.__union_unique(__x, __fork(__pool)); }
+
+      static void
+      __intersect_unique(tree& __t, tree& __x, work_stealing_pool& __pool) { __t.__intersect_unique(__x, __fork(__pool)); }
+
+      static void
+      __difference_unique(tree& __t, tree& __x, work_stealing_pool& __pool) { __t.__difference_unique(__x, __fork(__pool)); }
+
+    private:
+      /// @brief Below this many nodes a subtree is built by one thread.
+      static constexpr size_type __parallel_grain = 1024;
+
+      /// @brief The policy forking the top `fork_depth()` levels of the set algebra onto __pool.
+      static rb_tree_pool_fork
+      __fork(work_stealing_pool& __pool) noexcept { return rb_tree_pool_fork{ &__pool, __pool.fork_depth() }; }
+
+      /// @brief Whether a range can be built in parallel: it must be random access and yield
+      /// the value type itself.
+      template <typename _Iter>
+      using __parallel_build_t = std::integral_constant<bool,
+        ( std::is_convertible<iterator_category_t<_Iter>, random_access_iterator_tag>::value ||
+          std::is_convertible<iterator_category_t<_Iter>, std::random_access_iterator_tag>::value ) &&
+        std::is_same<std::decay_t<reference_t<_Iter>>, value_type>::value>;
+
+      template <typename _RandomAccessIterator>
+      static void
+      __assign_range(tree& __t, _RandomAccessIterator __first, _RandomAccessIterator __last, bool __unique,
+                     work_stealing_pool& __pool, std::true_type)
+      {
+        size_type __n = 0;
+
+        if ( __t.__is_sorted_range(__first, __last, __unique, __n) )
+          __build_sorted(__t, __first, __n, __pool);
+        else if ( __unique )
+          __t.__insert_range_unique(__first, __last);
+        else
+          __t.__insert_range_equal(__first, __last);
+      }
+
+      template <typename _InputIterator>
+      static void
+      __assign_range(tree& __t, _InputIterator __first, _InputIterator __last, bool __unique,
+                     work_stealing_pool&, std::false_type)
+      {
+        __t.__assign_range(__first, __last, __unique, typename tree::template __sorted_build_t<_InputIterator>());
+      }
+
+      /// @brief Like `rb_tree::__build_sorted`, with the subtrees of the top levels built in parallel.
+      template <typename _RandomAccessIterator>
+      static void
+      __build_sorted(tree& __t, _RandomAccessIterator __first, size_type __n, work_stealing_pool& __pool)
+      {
+        if ( __n == 0 ) return;
+
+        __t.__attach_root(__build_parallel(__t, __first, __n, 0, tree::__red_depth(__n), __pool, __pool.fork_depth()), __n);
+# if defined(FT_RB_TREE_THREADED_NODE)
+        rb_tree_rethread(__t.__root(), __t.m_impl.m_header);
+# endif
+      }
+
+      /// @brief Build a balanced subtree from the __n values at __first, forking the two
+      /// halves onto __pool for the first __levels levels.
+      /// @details Each half is built from its own position in the range, so the nodes and
+      /// colors are the same as those of `rb_tree::__build_balanced`. If either half throws,
+      /// the other is destroyed once it has been built, and the exception is rethrown.
+      template <typename _RandomAccessIterator>
+      static link_type
+      __build_parallel(tree& __t, _RandomAccessIterator __first, size_type __n, size_type __depth, size_type __red_depth,
+                       work_stealing_pool& __pool, unsigned int __levels)
+      {
+        if ( __levels == 0 || __n < __parallel_grain ) return __t.__build_balanced(__first, __n, __depth, __red_depth);
+
+        const size_type       __left_n = ( __n - 1 ) / 2;
+        _RandomAccessIterator __mid    = __first + static_cast<difference_type>(__left_n);
+        link_type             __l      = nullptr;
+        link_type             __r      = nullptr;
+        link_type             __z      = nullptr;
+
+        try {
+          __pool.invoke(
+            [&] { __l = __build_parallel(__t, __first, __left_n, __depth + 1, __red_depth, __pool, __levels - 1); },
+            [&] { __r = __build_parallel(__t, __mid + 1, __n - 1 - __left_n, __depth + 1, __red_depth, __pool, __levels - 1); });
+          __z = __t.__create_node(*__mid);
+        } catch ( ... ) {
+          __t.__erase(__l);
+          __t.__erase(__r);
+          throw;
+        }
+
+        __z->__set_color(__depth == __red_depth ? rb_tree_color::red : rb_tree_color::black);
+        __z->m_left  = __l;
+        __z->m_right = __r;
+        __l->__set_parent(__z);
+        __r->__set_parent(__z);
+        rb_tree_update_size(__z);
+        return __z;
+      }
+
+      /// @brief Call __f on every element of the subtree __x, see `__parallel_for_each`.
+      template <typename _Link, typename _Function>
+      static void
+      __for_each_subtree(_Link __x, _Function& __f, work_stealing_pool& __pool, unsigned int __levels)
+      {
+        if ( __x == nullptr ) return;
+        if ( __levels == 0 ) {
+          _Link __last = static_cast<_Link>(rb_tree_node_base::maximum(__x));
+
+          for ( __x = static_cast<_Link>(rb_tree_node_base::minimum(__x)); ; __x = static_cast<_Link>(rb_tree_increment(__x)) ) {
+            __f(*__x->__valptr());
+            if ( __x == __last ) return;
+          }
+        }
+        __pool.invoke(
+          [&] { __for_each_subtree(static_cast<_Link>(__x->m_left), __f, __pool, __levels - 1); },
+          [&] {
+            __f(*__x->__valptr());
+            __for_each_subtree(static_cast<_Link>(__x->m_right), __f, __pool, __levels - 1);
+          });
+      }
+  };
+
+} // namespace ft
+
+#endif // __FT_RB_TREE_PARALLEL__
@@ -0,0 +1,268 @@
+#ifndef   __FT_RB_TREE_PATH_COPY__
+# define  __FT_RB_TREE_PATH_COPY__
+
+# include <climits> // For CHAR_BIT
+# include <cstddef> // For std::size_t
+
+# include "rb_tree_node_base.h" // For rb_tree_node_base, rb_tree_color
+
+namespace ft {
+
+  /// @brief The path from the root of a red-black tree down to a node.
+  /// @details Path-copying trees never mutate a node that may be shared with another
+  /// version, and they keep no parent links, so an update first records the nodes it
+  /// descends through and the side it leaves each of them by, then copies exactly those.
+  ///
+  /// A red-black tree holding n nodes is at most 2 log2(n + 1) high, so the fixed capacity
+  /// covers any tree that fits in memory.
+  struct rb_tree_path
+  {
+    using base_ptr = rb_tree_node_base*; ///< Pointer to base node type.
+
+    static constexpr std::size_t max_height = 2 * sizeof(std::size_t) * CHAR_BIT; ///< The capacity of the path.
+
+    base_ptr    m_nodes[max_height + 1]; ///< The nodes on the path, starting from the root.
+    bool        m_right[max_height + 1]; ///< Whether the path leaves each node by its right child.
+    std::size_t m_depth = 0;             ///< The number of nodes on the path.
+
+    /// @brief Append a node and the side the path leaves it by.
+    void
+    __push(base_ptr __x, bool __right) noexcept
+    {
+      m_nodes[m_depth] = __x;
+      m_right[m_depth] = __right;
+      ++m_depth;
+    }
+  };
+
+  /// @brief Whether a node is red; null leaves are black.
+  inline bool
+  __rb_is_red(const rb_tree_node_base* __x) noexcept
+  {
+    return __x != nullptr && __x->__color() == rb_tree_color::red;
+  }
+
+  /// @brief Get the child of __x on the given side.
+  inline rb_tree_node_base*&
+  __rb_child(rb_tree_node_base* __x, bool __right) noexcept
+  {
+    return __right ? __x->m_right : __x->m_left;
+  }
+
+  /// @brief Point the link that held the node at depth __k of __path to __x.
+  /// @details The link is the child pointer of the node above, or the root for __k == 0.
+  inline void
+  __rb_path_relink(rb_tree_path& __path, std::size_t __k, rb_tree_node_base*& __root, rb_tree_node_base* __x) noexcept
+  {
+    if ( __k == 0 ) __root = __x;
+    else            __rb_child(__path.m_nodes[__k - 1], __path.m_right[__k - 1]) = __x;
+  }
+
+  /// @brief Rotate the subtree rooted at __x.
+  /// @param __toward_right Whether __x moves down to the right, lifting its left child, or
+  /// down to the left, lifting its right child.
+  /// @return The new root of the subtree. Neither __x nor the lifted child may be shared.
+  inline rb_tree_node_base*
+  __rb_path_rotate(rb_tree_node_base* __x, bool __toward_right) noexcept
+  {
+    rb_tree_node_base* const __y = __rb_child(__x, !__toward_right);
+
+    __rb_child(__x, !__toward_right) = __rb_child(__y, __toward_right);
+    __rb_child(__y, __toward_right)  = __x;
+    return __y;
+  }
+
+  /// @brief Replace a possibly shared node by a private copy.
+  /// @details `__ops.__clone(x)` returns a copy of x with the same value, color and
+  /// children; `__ops.__release(x)` is then told that the link to x was dropped. The caller
+  /// stores the copy wherever the link to x was.
+  template <typename _Ops>
+  inline rb_tree_node_base*
+  __rb_path_cow(rb_tree_node_base* __x, _Ops& __ops)
+  {
+    rb_tree_node_base* const __c = __ops.__clone(__x);
+
+    __ops.__release(__x);
+    return __c;
+  }
+
+  /// @brief Replace every node of __path by a private copy, linked to each other.
+  /// @param __root The root of the tree; set to the copy of the first node of the path.
+  /// @details Afterwards the nodes of __path are the copies, so the caller may change them
+  /// freely before publishing __root; the rest of the tree is shared with the old version.
+  template <typename _Ops>
+  inline void
+  rb_tree_path_copy(rb_tree_node_base*& __root, rb_tree_path& __path, _Ops& __ops)
+  {
+    for ( std::size_t __i = 0; __i < __path.m_depth; ++__i ) {
+      __path.m_nodes[__i] = __rb_path_cow(__path.m_nodes[__i], __ops);
+      __rb_path_relink(__path, __i, __root, __path.m_nodes[__i]);
+    }
+  }
+
+  /// @brief Insert a node into a path-copied red-black tree and rebalance.
+  /// @param __root The root of the tree, updated to the root of the new version.
+  /// @param __path The path from the root to the parent of the free slot __z goes to,
+  /// leaving the parent by the side of that slot.
+  /// @param __z The new node; not shared, with no children.
+  /// @details The nodes on the path are copied, as are the uncles that rebalancing
+  /// recolors, so the old version stays intact and readable: O(log n) new nodes in all.
+  template <typename _Ops>
+  inline void
+  rb_tree_path_insert(rb_tree_node_base*& __root, rb_tree_path& __path, rb_tree_node_base* __z, _Ops& __ops)
+  {
+    using base_ptr = rb_tree_node_base*;
+
+    rb_tree_path_copy(__root, __path, __ops);
+    __z->m_left  = nullptr;
+    __z->m_right = nullptr;
+    __z->__set_color(rb_tree_color::red);
+    __rb_path_relink(__path, __path.m_depth, __root, __z);
+
+    base_ptr    __x = __z;
+    std::size_t __k = __path.m_depth;
+
+    // The parent of __x is __path.m_nodes[__k - 1]; a red parent is never the root.
+    while ( __k > 1 && __rb_is_red(__path.m_nodes[__k - 1]) ) {
+      base_ptr   __p       = __path.m_nodes[__k - 1];
+      base_ptr   __g       = __path.m_nodes[__k - 2];
+      const bool __p_right = __path.m_right[__k - 2];
+      base_ptr   __u       = __rb_child(__g, !__p_right);
+
+      if ( __rb_is_red(__u) ) {
+        __u = __rb_path_cow(__u, __ops);
+        __rb_child(__g, !__p_right) = __u;
+        __p->__set_color(rb_tree_color::black);
+        __u->__set_color(rb_tree_color::black);
+        __g->__set_color(rb_tree_color::red);
+        __x  = __g;
+        __k -= 2;
+        continue;
+      }
+      if ( __path.m_right[__k - 1] != __p_right ) {
+        // __x is an inner grandchild: turn it into an outer one.
+        __rb_child(__g, __p_right) = __rb_path_rotate(__p, __p_right);
+        __p = __x;
+      }
+      __p->__set_color(rb_tree_color::black);
+      __g->__set_color(rb_tree_color::red);
+      __rb_path_relink(__path, __k - 2, __root, __rb_path_rotate(__g, !__p_right));
+      break;
+    }
+    __root->__set_color(rb_tree_color::black);
+  }
+
+  /// @brief Erase a node from a path-copied red-black tree and rebalance.
+  /// @param __root The root of the tree, updated to the root of the new version.
+  /// @param __path The path from the root to the node to erase, which is the last node.
+  /// @return The private copy of the erased node, unlinked from the new version, whose
+  /// children belong to the new version. The caller destroys it.
+  /// @details As for insertion, only the path, the successor path of a node with two
+  /// children and the few siblings that rebalancing changes are copied.
+  template <typename _Ops>
+  inline rb_tree_node_base*
+  rb_tree_path_erase(rb_tree_node_base*& __root, rb_tree_path& __path, _Ops& __ops)
+  {
+    using base_ptr = rb_tree_node_base*;
+
+    const std::size_t __zi = __path.m_depth - 1;
+    base_ptr          __z  = __path.m_nodes[__zi];
+
+    // A node with two children trades places with its successor, so extend the path to it.
+    if ( __z->m_left != nullptr && __z->m_right != nullptr ) {
+      __path.m_right[__zi] = true;
+      for ( base_ptr __y = __z->m_right; __y != nullptr; __y = __y->m_left )
+        __path.__push(__y, false);
+    }
+    rb_tree_path_copy(__root, __path, __ops);
+    __z = __path.m_nodes[__zi];
+
+    const std::size_t __yi = __path.m_depth - 1;
+    base_ptr          __y  = __path.m_nodes[__yi];
+    base_ptr          __x;
+    rb_tree_color     __removed;
+
+    if ( __y != __z ) {
+      __removed = __y->__color();
+      __x       = __y->m_right;
+      if ( __yi > __zi + 1 ) {
+        __path.m_nodes[__yi - 1]->m_left = __x;
+        __y->m_right = __z->m_right;
+      }
+      __y->m_left = __z->m_left;
+      __y->__set_color(__z->__color());
+      __path.m_nodes[__zi] = __y;
+      __rb_path_relink(__path, __zi, __root, __y);
+    } else {
+      __removed = __z->__color();
+      __x       = __z->m_left != nullptr ? __z->m_left : __z->m_right;
+      __rb_path_relink(__path, __zi, __root, __x);
+    }
+    // The hole left behind sits below the node before the last one on the path.
+    std::size_t __k = __yi;
+
+    if ( __removed == rb_tree_color::red ) return __z;
+
+    bool __x_private = false;
+
+    while ( __k > 0 && !__rb_is_red(__x) ) {
+      base_ptr   __p     = __path.m_nodes[__k - 1];
+      const bool __right = __path.m_right[__k - 1];
+      base_ptr   __w     = __rb_path_cow(__rb_child(__p, !__right), __ops);
+
+      __rb_child(__p, !__right) = __w;
+      if ( __rb_is_red(__w) ) {
+        // Red sibling: rotate it above the parent, which moves one level down the path.
+        __w->__set_color(rb_tree_color::black);
+        __p->__set_color(rb_tree_color::red);
+        __rb_path_relink(__path, __k - 1, __root, __rb_path_rotate(__p, __right));
+        __path.m_nodes[__k] = __p;
+        __path.m_right[__k] = __right;
+        __path.m_nodes[__k - 1] = __w;
+        __path.m_right[__k - 1] = __right;
+        ++__k;
+        __w = __rb_path_cow(__rb_child(__p, !__right), __ops);
+        __rb_child(__p, !__right) = __w;
+      }
+      if ( !__rb_is_red(__w->m_left) && !__rb_is_red(__w->m_right) ) {
+        __w->__set_color(rb_tree_color::red);
+        __x         = __p;
+        __x_private = true;
+        --__k;
+        continue;
+      }
+      base_ptr __far;
+
+      if ( !__rb_is_red(__rb_child(__w, !__right)) ) {
+        // Only the near child is red: rotate it up so it becomes the far one.
+        base_ptr __near = __rb_path_cow(__rb_child(__w, __right), __ops);
+
+        __rb_child(__w, __right) = __near;
+        __near->__set_color(rb_tree_color::black);
+        __w->__set_color(rb_tree_color::red);
+        __rb_child(__p, !__right) = __rb_path_rotate(__w, !__right);
+        __far = __w;
+        __w   = __near;
+      } else {
+        __far = __rb_path_cow(__rb_child(__w, !__right), __ops);
+        __rb_child(__w, !__right) = __far;
+      }
+      __w->__set_color(__p->__color());
+      __p->__set_color(rb_tree_color::black);
+      __far->__set_color(rb_tree_color::black);
+      __rb_path_relink(__path, __k - 1, __root, __rb_path_rotate(__p, __right));
+      return __z;
+    }
+    if ( __x != nullptr && __x->__color() != rb_tree_color::black ) {
+      if ( !__x_private ) {
+        __x = __rb_path_cow(__x, __ops);
+        __rb_path_relink(__path, __k, __root, __x);
+      }
+      __x->__set_color(rb_tree_color::black);
+    }
+    return __z;
+  }
+
+} // namespace ft
+
+#endif // __FT_RB_TREE_PATH_COPY__
@@ -0,0 +1,218 @@
+#ifndef   __FT_RB_TREE_PATH_ITERATOR__
+# define  __FT_RB_TREE_PATH_ITERATOR__
+
+# include <cstddef> // For std::ptrdiff_t, std::size_t
+
+# include "../iterator/iterator_base_types.h" // For bidirectional_iterator_tag
+# include "rb_tree_node.h"                    // For rb_tree_node
+# include "rb_tree_path_copy.h"               // For rb_tree_path
+
+namespace ft {
+
+  /// @brief Constant bidirectional iterator over one version of a path-copied red-black tree.
+  /// @details Path-copied nodes are shared between versions, so they carry no parent links.
+  /// The iterator keeps the ancestors of its node on a stack instead, bounded like
+  /// `rb_tree_path` by the largest possible height, and climbs it where a tree with parent
+  /// links would follow them. A full traversal thus touches each node O(1) times, and a
+  /// single step costs O(1) amortized.
+  ///
+  /// The bound lookups stack the ancestors during their own descent, and an `rb_tree_path`
+  /// already holds them; only positioning on a bare node searches its key from the root
+  /// again, so the keys must be unique. Copies only copy the used part of the stack.
+  /// The past-the-end position has a null node and an empty stack, so `--end()` yields the
+  /// maximum.
+  template <typename _Val, typename _KeyOfValue, typename _Compare>
+  struct rb_tree_path_iterator
+  {
+    using value_type        = _Val;                       ///< The type of the value pointed to by the iterator.
+    using reference         = const _Val&;                ///< Reference type to the value.
+    using pointer           = const _Val*;                ///< Pointer type to the value.
+    using iterator_category = bidirectional_iterator_tag; ///< The category of the iterator.
+    using difference_type   = std::ptrdiff_t;             ///< The type used for representing the difference between two iterators.
+
+    using self            = rb_tree_path_iterator<_Val, _KeyOfValue, _Compare>;
+    using const_base_ptr  = const rb_tree_node_base*;
+    using const_link_type = const rb_tree_node<_Val>*;
+
+    const_base_ptr m_root;                           ///< The root of the version iterated over.
+    const_base_ptr m_node;                           ///< The current node, or nullptr past the end.
+    std::size_t    m_depth;                          ///< The number of ancestors of m_node on the stack.
+    const_base_ptr m_path[rb_tree_path::max_height]; ///< The ancestors of m_node, starting from the root.
+
+    /// @brief Default constructor.
+    rb_tree_path_iterator() noexcept
+      : m_root{ }, m_node{ }, m_depth{ 0 } { }
+
+    /// @brief Constructor at the minimum of a version, or past the end if it is empty.
+    explicit
+    rb_tree_path_iterator(const_base_ptr __root) noexcept
+      : m_root{ __root }, m_node{ __root }, m_depth{ 0 }
+    {
+      if ( m_node != nullptr ) __descend_left();
+    }
+
+    /// @brief Constructor from the root of a version, a node of it and the comparator.
+    /// @details Rebuilds the ancestors of __x by searching its key from the root.
+    rb_tree_path_iterator(const_base_ptr __root, const_base_ptr __x, const _Compare* __comp)
+      : m_root{ __root }, m_node{ __x }, m_depth{ 0 }
+    {
+      if ( __x == nullptr ) return;
+      for ( const_base_ptr __c = __root; __c != __x; ) {
+        m_path[m_depth++] = __c;
+        __c = (*__comp)(__key(__x), __key(__c)) ? __c->m_left : __c->m_right;
+      }
+    }
+
+    /// @brief Constructor from the root of a version and the path down to a node of it.
+    rb_tree_path_iterator(const_base_ptr __root, const rb_tree_path& __path) noexcept
+      : m_root{ __root }, m_node{ __path.m_nodes[__path.m_depth - 1] }, m_depth{ __path.m_depth - 1 }
+    {
+      for ( std::size_t __i = 0; __i < m_depth; ++__i ) m_path[__i] = __path.m_nodes[__i];
+    }
+
+    rb_tree_path_iterator(const self& __x) noexcept
+      : m_root{ __x.m_root }, m_node{ __x.m_node }, m_depth{ __x.m_depth }
+    {
+      for ( std::size_t __i = 0; __i < m_depth; ++__i ) m_path[__i] = __x.m_path[__i];
+    }
+
+    self&
+    operator=(const self& __x) noexcept
+    {
+      m_root  = __x.m_root;
+      m_node  = __x.m_node;
+      m_depth = __x.m_depth;
+      for ( std::size_t __i = 0; __i < m_depth; ++__i ) m_path[__i] = __x.m_path[__i];
+      return *this;
+    }
+
+    /// @brief The first element of the version at __root whose key is not less than __k.
+    /// @details The ancestors are stacked during the descent, so it runs only once.
+    template <typename _Kt>
+    static self
+    __lower_bound(const_base_ptr __root, const _Kt& __k, const _Compare& __comp)
+    {
+      return __bound(__root, [&](const_base_ptr __x) { return !__comp(__key(__x), __k); });
+    }
+
+    /// @brief The first element of the version at __root whose key is greater than __k.
+    template <typename _Kt>
+    static self
+    __upper_bound(const_base_ptr __root, const _Kt& __k, const _Compare& __comp)
+    {
+      return __bound(__root, [&](const_base_ptr __x) { return __comp(__k, __key(__x)); });
+    }
+
+    /// @brief Dereference operator.
+    reference
+    operator*() const noexcept { return *static_cast<const_link_type>(m_node)->__valptr(); }
+
+    /// @brief Arrow operator.
+    pointer
+    operator->() const noexcept { return static_cast<const_link_type>(m_node)->__valptr(); }
+
+    /// @brief Pre-increment operator.
+    self&
+    operator++() noexcept
+    {
+      if ( m_node->m_right != nullptr ) {
+        m_path[m_depth++] = m_node;
+        m_node = m_node->m_right;
+        __descend_left();
+        return *this;
+      }
+      while ( m_depth != 0 && m_path[m_depth - 1]->m_right == m_node ) m_node = m_path[--m_depth];
+      m_node = m_depth != 0 ? m_path[--m_depth] : nullptr;
+      return *this;
+    }
+
+    /// @brief Post-increment operator.
+    self
+    operator++(int) noexcept
+    {
+      self __tmp = *this;
+      ++*this;
+      return __tmp;
+    }
+
+    /// @brief Pre-decrement operator.
+    self&
+    operator--() noexcept
+    {
+      if ( m_node == nullptr ) {
+        m_node = m_root;
+        __descend_right();
+        return *this;
+      }
+      if ( m_node->m_left != nullptr ) {
+        m_path[m_depth++] = m_node;
+        m_node = m_node->m_left;
+        __descend_right();
+        return *this;
+      }
+      while ( m_depth != 0 && m_path[m_depth - 1]->m_left == m_node ) m_node = m_path[--m_depth];
+      m_node = m_depth != 0 ? m_path[--m_depth] : nullptr;
+      return *this;
+    }
+
+    /// @brief Post-decrement operator.
+    self
+    operator--(int) noexcept
+    {
+      self __tmp = *this;
+      --*this;
+      return __tmp;
+    }
+
+    friend bool
+    operator==(const self& __x, const self& __y) noexcept { return __x.m_node == __y.m_node; }
+
+    friend bool
+    operator!=(const self& __x, const self& __y) noexcept { return __x.m_node != __y.m_node; }
+
+  private:
+    /// @brief Descend from __root, going left where __left holds; the result is the last node
+    /// left that way. Every node passed is stacked, and the ancestors of the result are
+    /// those stacked before it.
+    template <typename _Left>
+    static self
+    __bound(const_base_ptr __root, _Left __left)
+    {
+      self        __i;
+      std::size_t __depth = 0;
+
+      __i.m_root = __root;
+      for ( const_base_ptr __x = __root; __x != nullptr; ) {
+        const bool __goes_left = __left(__x);
+
+        if ( __goes_left ) {
+          __i.m_node  = __x;
+          __i.m_depth = __depth;
+        }
+        __i.m_path[__depth++] = __x;
+        __x = __goes_left ? __x->m_left : __x->m_right;
+      }
+      return __i;
+    }
+
+    /// @brief Move to the minimum of the subtree of m_node, stacking the nodes passed.
+    void
+    __descend_left() noexcept
+    {
+      for ( ; m_node->m_left != nullptr; m_node = m_node->m_left ) m_path[m_depth++] = m_node;
+    }
+
+    /// @brief Move to the maximum of the subtree of m_node, stacking the nodes passed.
+    void
+    __descend_right() noexcept
+    {
+      for ( ; m_node->m_right != nullptr; m_node = m_node->m_right ) m_path[m_depth++] = m_node;
+    }
+
+    static decltype(auto)
+    __key(const_base_ptr __x) { return _KeyOfValue()(*static_cast<const_link_type>(__x)->__valptr()); }
+  };
+
+} // namespace ft
+
+#endif // __FT_RB_TREE_PATH_ITERATOR__
@@ -0,0 +1,32 @@
+#ifndef   __FT_FUNCTIONAL__
+# define  __FT_FUNCTIONAL__
+
+namespace ft {
+
+  /// @brief Function object returning its argument unchanged.
+  /// @details Used as the key extractor of set-like trees, where the value is the key.
+  template <typename _Tp>
+  struct identity
+  {
+    _Tp&
+    operator()(_Tp& __x) const noexcept { return __x; }
+
+    const _Tp&
+    operator()(const _Tp& __x) const noexcept { return __x; }
+  };
+
+  /// @brief Function object returning the first member of a pair.
+  /// @details Used as the key extractor of map-like trees, where the value is a `ft::pair`.
+  template <typename _Pair>
+  struct select1st
+  {
+    typename _Pair::first_type&
+    operator()(_Pair& __x) const noexcept { return __x.first; }
+
+    const typename _Pair::first_type&
+    operator()(const _Pair& __x) const noexcept { return __x.first; }
+  };
+
+} // namespace ft
+
+#endif // __FT_FUNCTIONAL__
@@ -1,8 +1,22 @@
 #ifndef   __FT_PAIR__
 # define  __FT_PAIR__
 
+# include <cstddef>     // For std::size_t
+# include <functional>  // For std::reference_wrapper
+# include <tuple>       // For std::tuple, std::get, std::forward_as_tuple
+# include <type_traits> // For std::enable_if_t, std::is_constructible, std::decay_t
+# include <utility>     // For std::move, std::forward, std::index_sequence
+
 namespace ft {
 
+  /// @brief Tag type selecting the piecewise constructor of `ft::pair`.
+  /// @details Each member of the pair is then constructed in place from the elements of
+  /// its own tuple of arguments, which is how the tree builds map values in node storage.
+  struct piecewise_construct_t { explicit piecewise_construct_t() = default; };
+
+  /// @brief Tag value selecting the piecewise constructor of `ft::pair`.
+  inline constexpr piecewise_construct_t piecewise_construct = piecewise_construct_t();
+
   /// @brief Pair class template.
   /// @details This class template represents a pair of values, which can be of different types.
   /// It provides a simple way to store two related values together.
@@ -12,6 +26,9 @@ namespace ft {
   /// - Access the first and second elements using `first` and `second` members.
   template <typename T1, typename T2>
   struct pair {
+    using first_type  = T1; ///< The type of the first element.
+    using second_type = T2; ///< The type of the second element.
+
     T1 first;  ///< The first element of the pair.
     T2 second; ///< The second element of the pair.
 
@@ -28,12 +45,40 @@ namespace ft {
       : first{ a }, second{ b } { }
 
     /// @brief Constructor that initializes the pair with given values of different types.
-    /// @param a The first value of type U1.
-    /// @param b The second value of type U2.
-    template <typename U1, typename U2>
+    /// @param a The first value of type U1, forwarded to the constructor of `first`.
+    /// @param b The second value of type U2, forwarded to the constructor of `second`.
+    template <typename U1, typename U2, typename = std::enable_if_t<
+      std::is_constructible<T1, U1&&>::value && std::is_constructible<T2, U2&&>::value>>
     constexpr
-    pair(const U1& a, const U2& b)
-      : first{ a }, second{ b } { }
+    pair(U1&& a, U2&& b)
+      : first(std::forward<U1>(a)), second(std::forward<U2>(b)) { }
+
+    /// @brief Converting constructor from a pair of different types.
+    /// @param __p The pair to copy from.
+    template <typename U1, typename U2, typename = std::enable_if_t<
+      std::is_constructible<T1, const U1&>::value && std::is_constructible<T2, const U2&>::value>>
+    constexpr
+    pair(const pair<U1, U2>& __p)
+      : first(__p.first), second(__p.second) { }
+
+    /// @brief Converting move constructor from a pair of different types.
+    /// @param __p The pair to move from.
+    template <typename U1, typename U2, typename = std::enable_if_t<
+      std::is_constructible<T1, U1&&>::value && std::is_constructible<T2, U2&&>::value>>
+    constexpr
+    pair(pair<U1, U2>&& __p)
+      : first(std::forward<U1>(__p.first)), second(std::forward<U2>(__p.second)) { }
+
+    /// @brief Piecewise constructor.
+    /// @param __first_args The arguments for the constructor of `first`.
+    /// @param __second_args The arguments for the constructor of `second`.
+    /// @details Neither member is copied or moved: both are built directly in place, so a
+    /// map value can be constructed from a key and the mapped value's constructor arguments.
+    template <typename... Args1, typename... Args2>
+    constexpr
+    pair(piecewise_construct_t, std::tuple<Args1...> __first_args, std::tuple<Args2...> __second_args)
+      : pair(__first_args, __second_args,
+             std::index_sequence_for<Args1...>(), std::index_sequence_for<Args2...>()) { }
   
     /// @brief Copy constructor.
     /// @param __x The pair to copy from.
@@ -44,7 +89,8 @@ namespace ft {
     /// @brief Move constructor.
     /// @param __x The pair to move from.
     constexpr
-    pair(pair&& __x) noexcept
+    pair(pair&& __x) noexcept(std::is_nothrow_move_constructible<T1>::value &&
+                              std::is_nothrow_move_constructible<T2>::value)
       : first{ std::move(__x.first) }, second{ std::move(__x.second) } { }
 
     /// @brief Assignment operator.
@@ -75,6 +121,15 @@ namespace ft {
       return *this;
     }
 
+  private:
+    /// @brief Unpack the argument tuples of the piecewise constructor.
+    template <typename... Args1, typename... Args2, std::size_t... I1, std::size_t... I2>
+    constexpr
+    pair(std::tuple<Args1...>& __first_args, std::tuple<Args2...>& __second_args,
+         std::index_sequence<I1...>, std::index_sequence<I2...>)
+      : first(std::forward<Args1>(std::get<I1>(__first_args))...),
+        second(std::forward<Args2>(std::get<I2>(__second_args))...) { }
+
   };
 
   /// @brief Comparison operator for pairs.
@@ -154,16 +209,35 @@ namespace ft {
     return !(lhs < rhs);
   }
 
+  /// @brief The type `make_pair` stores for an argument of type T.
+  /// @details The argument type is decayed (arrays become pointers, references and
+  /// cv-qualifiers are dropped), except that `std::reference_wrapper<U>` becomes `U&`.
+  template <typename T>
+  struct __unwrap_ref_decay { using type = std::decay_t<T>; };
+
+  template <typename T>
+  struct __unwrap_ref_decay<std::reference_wrapper<T>> { using type = T&; };
+
+  template <typename T>
+  struct __unwrap_ref_decay<std::reference_wrapper<T>&> { using type = T&; };
+
+  template <typename T>
+  struct __unwrap_ref_decay<const std::reference_wrapper<T>&> { using type = T&; };
+
+  template <typename T>
+  using __unwrap_ref_decay_t = typename __unwrap_ref_decay<T>::type;
+
   /// @brief Make a pair.
-  /// @details Creates a pair from two values.
+  /// @details Creates a pair from two values, forwarding them so rvalues are moved
+  /// rather than copied. The element types are the decayed argument types.
   /// @param a The first value.
   /// @param b The second value.
   /// @return A pair containing the two values.
   template <typename T1, typename T2>
-  constexpr pair<T1, T2>
-  make_pair(const T1& a, const T2& b)
+  constexpr pair<__unwrap_ref_decay_t<T1>, __unwrap_ref_decay_t<T2>>
+  make_pair(T1&& a, T2&& b)
   {
-    return pair<T1, T2>(a, b);
+    return pair<__unwrap_ref_decay_t<T1>, __unwrap_ref_decay_t<T2>>(std::forward<T1>(a), std::forward<T2>(b));
   }
 
 } // namespace ft
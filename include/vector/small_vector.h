@@ -0,0 +1,1135 @@
+#ifndef   __FT_SMALL_VECTOR__
+# define  __FT_SMALL_VECTOR__
+
+# include <algorithm>        // For std::rotate, std::min
+# include <cstddef>          // For std::size_t, std::ptrdiff_t
+# include <cstring>          // For std::memcpy, std::memmove
+# include <functional>       // For std::less
+# include <initializer_list> // For std::initializer_list
+# include <iterator>         // For std::forward_iterator_tag, std::random_access_iterator_tag, std::make_move_iterator
+# include <limits>           // For std::numeric_limits
+# include <memory>           // For std::allocator, std::allocator_traits, std::addressof
+# include <new>              // For placement new
+# include <stdexcept>        // For std::out_of_range, std::length_error
+# include <type_traits>      // For std::integral_constant, std::enable_if_t, std::is_integral, std::is_trivially_destructible
+# include <utility>          // For std::move, std::forward, std::move_if_noexcept, std::swap
+
+# include "../algorithm/algorithm.h"          // For ft::equal, ft::lexicographical_compare
+# include "../iterator/iterator_base_types.h" // For iterator tags, iterator_category_t
+# include "../iterator/reverse_iterator.h"    // For ft::reverse_iterator
+# include "../memory/memory_resource.h"       // For polymorphic_allocator
+# include "vector_policy.h"                   // For is_trivially_relocatable, vector_growth
+
+namespace ft {
+
+  /// @brief The inline buffer of a `small_vector`, room for _N elements inside the object.
+  template <typename _Tp, std::size_t _N>
+  struct small_vector_storage
+  {
+    alignas(_Tp) unsigned char m_inline[_N * sizeof(_Tp)]; ///< The raw inline buffer.
+
+    _Tp*
+    __inline_data() noexcept { return reinterpret_cast<_Tp*>(m_inline); }
+
+    const _Tp*
+    __inline_data() const noexcept { return reinterpret_cast<const _Tp*>(m_inline); }
+  };
+
+  /// @brief Specialization without an inline buffer, for `ft::vector`; it takes no space.
+  template <typename _Tp>
+  struct small_vector_storage<_Tp, 0>
+  {
+    _Tp*
+    __inline_data() noexcept { return nullptr; }
+
+    const _Tp*
+    __inline_data() const noexcept { return nullptr; }
+  };
+
+  /// @brief Sequence container storing its elements contiguously, the first N inside the object.
+  /// @details Up to N elements live in an inline buffer, so small vectors allocate nothing;
+  /// beyond that the elements move to the heap like in any vector, and they only come back
+  /// with `shrink_to_fit`. With N = 0 this is `ft::vector`, which is three pointers and an
+  /// allocator.
+  ///
+  /// Types for which `is_trivially_relocatable` holds are moved around with `memcpy` and
+  /// `memmove`: reallocations, insertions and erasures in the middle copy bytes instead of
+  /// running move constructors and destructors element by element.
+  ///
+  /// Capacity is managed explicitly:
+  /// - `reserve(n)` grows by the growth policy, so calling it before every append stays
+  ///   amortized O(1); unlike `std::vector::reserve`, it may allocate more than n;
+  /// - `reserve_exact(n)` allocates exactly n, for buffers whose final size is known;
+  /// - `shrink_to_fit()` always releases the unused capacity, and moves the elements back
+  ///   inline when they fit;
+  /// - `resize_for_overwrite(n)` leaves new trivial elements uninitialized, for buffers
+  ///   about to be filled by a read or a decoder.
+  ///
+  /// Any reallocation invalidates all iterators and references; moving or swapping a vector
+  /// whose elements are inline moves the elements, so it invalidates them too.
+  ///
+  /// @tparam N The number of elements stored inline.
+  /// @tparam Growth The growth policy, see `vector_growth`.
+  template <
+    typename T,
+    std::size_t N,
+    typename Alloc  = std::allocator<T>,
+    typename Growth = vector_growth<>
+  > class small_vector
+  {
+    static_assert(std::is_same<typename Alloc::value_type, T>::value, "ft::small_vector: Alloc::value_type must be T");
+
+    protected:
+      using alloc_traits  = std::allocator_traits<Alloc>;
+      using __relocatable = std::integral_constant<bool, is_trivially_relocatable<T>::value>;
+
+    public:
+      using value_type             = T;                                    ///< The type of the elements.
+      using allocator_type         = Alloc;                                ///< The allocator type.
+      using growth_policy          = Growth;                               ///< The growth policy type.
+      using size_type              = std::size_t;                          ///< Unsigned integer type for sizes.
+      using difference_type        = std::ptrdiff_t;                       ///< Signed integer type for distances.
+      using reference              = value_type&;                          ///< Reference type to the element.
+      using const_reference        = const value_type&;                    ///< Const reference type to the element.
+      using pointer                = value_type*;                          ///< Pointer type to the element.
+      using const_pointer          = const value_type*;                    ///< Const pointer type to the element.
+      using iterator               = value_type*;                          ///< Random access iterator.
+      using const_iterator         = const value_type*;                    ///< Constant random access iterator.
+      using reverse_iterator       = ft::reverse_iterator<iterator>;       ///< Reverse iterator.
+      using const_reverse_iterator = ft::reverse_iterator<const_iterator>; ///< Constant reverse iterator.
+
+      static constexpr size_type inline_capacity = N; ///< The number of elements stored inline.
+
+    private:
+      /// @brief The vector state: allocator, inline buffer and the bounds of the elements.
+      /// @details Inheriting from the allocator lets a stateless one take no space.
+      struct small_vector_impl
+        : public Alloc,
+          public small_vector_storage<T, N>
+      {
+        pointer m_begin; ///< The first element, in the inline buffer or on the heap.
+        pointer m_end;   ///< Past the last element.
+        pointer m_cap;   ///< Past the end of the storage.
+
+        explicit
+        small_vector_impl(const Alloc& __a) noexcept
+          : Alloc(__a), m_begin{ this->__inline_data() }, m_end{ m_begin }, m_cap{ m_begin + N } { }
+
+        small_vector_impl(const small_vector_impl&) = delete;
+        small_vector_impl& operator=(const small_vector_impl&) = delete;
+
+        /// @brief Point back at the empty inline buffer, forgetting any heap storage.
+        void
+        __reset() noexcept
+        {
+          m_begin = this->__inline_data();
+          m_end   = m_begin;
+          m_cap   = m_begin + N;
+        }
+      };
+
+      small_vector_impl m_impl; ///< The allocator and storage of the vector.
+
+      /// @brief Whether a range can be measured before it is inserted: it must be multi-pass.
+      template <typename _Iter>
+      using __forward_range_t = std::integral_constant<bool,
+        std::is_convertible<iterator_category_t<_Iter>, forward_iterator_tag>::value ||
+        std::is_convertible<iterator_category_t<_Iter>, std::forward_iterator_tag>::value>;
+
+      /// @brief Whether a range can be measured in O(1).
+      template <typename _Iter>
+      using __random_access_range_t = std::integral_constant<bool,
+        std::is_convertible<iterator_category_t<_Iter>, random_access_iterator_tag>::value ||
+        std::is_convertible<iterator_category_t<_Iter>, std::random_access_iterator_tag>::value>;
+
+      /// @brief SFINAE helper rejecting integers, so that `(n, value)` never picks the range overloads.
+      template <typename _Iter>
+      using __iterator_t = std::enable_if_t<!std::is_integral<_Iter>::value>;
+
+    public:
+      /// @brief Default constructor. Allocates nothing.
+      small_vector() noexcept(noexcept(Alloc()))
+        : m_impl(Alloc()) { }
+
+      /// @brief Constructor with an allocator, such as a `polymorphic_allocator` on a resource.
+      /// @param __a The allocator.
+      explicit
+      small_vector(const allocator_type& __a) noexcept
+        : m_impl(__a) { }
+
+      /// @brief Construct __n value-initialized elements.
+      explicit
+      small_vector(size_type __n, const allocator_type& __a = allocator_type())
+        : m_impl(__a)
+      {
+        __init_with(__n, [this, __n](pointer __d) { __construct_value_n(__d, __n); });
+      }
+
+      /// @brief Construct __n copies of __x.
+      small_vector(size_type __n, const value_type& __x, const allocator_type& __a = allocator_type())
+        : m_impl(__a)
+      {
+        __init_with(__n, [this, __n, &__x](pointer __d) { __construct_fill_n(__d, __n, __x); });
+      }
+
+      /// @brief Range constructor.
+      /// @param __first The beginning of the range to copy.
+      /// @param __last The end of the range to copy.
+      template <typename _InputIterator, typename = __iterator_t<_InputIterator>>
+      small_vector(_InputIterator __first, _InputIterator __last, const allocator_type& __a = allocator_type())
+        : m_impl(__a)
+      {
+        __init_range(__first, __last, __forward_range_t<_InputIterator>());
+      }
+
+      /// @brief Initializer list constructor.
+      small_vector(std::initializer_list<value_type> __il, const allocator_type& __a = allocator_type())
+        : m_impl(__a)
+      {
+        __init_range(__il.begin(), __il.end(), std::true_type());
+      }
+
+      /// @brief Copy constructor.
+      /// @details The copy gets exactly the capacity it needs, or the inline buffer if it fits.
+      small_vector(const small_vector& __x)
+        : m_impl(alloc_traits::select_on_container_copy_construction(__x.__alloc()))
+      {
+        __init_range(__x.begin(), __x.end(), std::true_type());
+      }
+
+      /// @brief Move constructor.
+      /// @details Steals the heap storage of __x, or moves its inline elements, leaving __x empty.
+      small_vector(small_vector&& __x) noexcept(N == 0 || std::is_nothrow_move_constructible<T>::value)
+        : m_impl(std::move(__x.__alloc()))
+      {
+        __take_storage(__x);
+      }
+
+      /// @brief Destructor.
+      ~small_vector() noexcept
+      {
+        __destroy(m_impl.m_begin, m_impl.m_end);
+        __deallocate_storage();
+      }
+
+      /// @brief Copy assignment operator.
+      /// @param __x The vector to copy from.
+      /// @return A reference to this vector.
+      small_vector&
+      operator=(const small_vector& __x)
+      {
+        if ( this == &__x ) {
+          return *this;
+        }
+        __alloc_on_copy(__x, typename alloc_traits::propagate_on_container_copy_assignment());
+        assign(__x.begin(), __x.end());
+        return *this;
+      }
+
+      /// @brief Move assignment operator.
+      /// @param __x The vector to move from.
+      /// @return A reference to this vector.
+      /// @details The storage is stolen when it is on the heap and the allocators allow it;
+      /// otherwise the elements are moved one by one.
+      small_vector&
+      operator=(small_vector&& __x)
+        noexcept(( N == 0 || std::is_nothrow_move_constructible<T>::value ) &&
+                 ( alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value ))
+      {
+        if ( this == &__x ) {
+          return *this;
+        }
+        __move_assign(__x, std::integral_constant<bool,
+                             alloc_traits::propagate_on_container_move_assignment::value ||
+                             alloc_traits::is_always_equal::value>());
+        return *this;
+      }
+
+      /// @brief Replace the contents with the elements of an initializer list.
+      small_vector&
+      operator=(std::initializer_list<value_type> __il)
+      {
+        assign(__il.begin(), __il.end());
+        return *this;
+      }
+
+      /// @brief Replace the contents with __n copies of __x.
+      void
+      assign(size_type __n, const value_type& __x)
+      {
+        if ( __n > capacity() ) {
+          __replace_storage(__n, [this, __n, &__x](pointer __d) { __construct_fill_n(__d, __n, __x); });
+          return;
+        }
+
+        const size_type __common = std::min(__n, size());
+
+        for ( pointer __p = m_impl.m_begin; __p != m_impl.m_begin + __common; ++__p ) *__p = __x;
+        if ( __n > size() ) {
+          __construct_fill_n(m_impl.m_end, __n - size(), __x);
+          m_impl.m_end = m_impl.m_begin + __n;
+        } else {
+          __erase_at_end(m_impl.m_begin + __n);
+        }
+      }
+
+      /// @brief Replace the contents with the elements of a range.
+      template <typename _InputIterator, typename = __iterator_t<_InputIterator>>
+      void
+      assign(_InputIterator __first, _InputIterator __last)
+      {
+        __assign_range(__first, __last, __forward_range_t<_InputIterator>());
+      }
+
+      void
+      assign(std::initializer_list<value_type> __il) { assign(__il.begin(), __il.end()); }
+
+      allocator_type
+      get_allocator() const noexcept { return __alloc(); }
+
+    public:
+      /// @brief Access an element, with bounds checking.
+      /// @throws std::out_of_range if __n is not less than `size()`.
+      reference
+      at(size_type __n)
+      {
+        if ( __n >= size() ) throw std::out_of_range("ft::small_vector::at");
+        return m_impl.m_begin[__n];
+      }
+
+      const_reference
+      at(size_type __n) const
+      {
+        if ( __n >= size() ) throw std::out_of_range("ft::small_vector::at");
+        return m_impl.m_begin[__n];
+      }
+
+      reference       operator[](size_type __n)       noexcept { return m_impl.m_begin[__n]; }
+      const_reference operator[](size_type __n) const noexcept { return m_impl.m_begin[__n]; }
+
+      reference       front()       noexcept { return *m_impl.m_begin; }
+      const_reference front() const noexcept { return *m_impl.m_begin; }
+      reference       back()        noexcept { return *( m_impl.m_end - 1 ); }
+      const_reference back()  const noexcept { return *( m_impl.m_end - 1 ); }
+
+      pointer       data()       noexcept { return m_impl.m_begin; }
+      const_pointer data() const noexcept { return m_impl.m_begin; }
+
+    public:
+      iterator               begin()        noexcept { return m_impl.m_begin; }
+      const_iterator         begin()  const noexcept { return m_impl.m_begin; }
+      iterator               end()          noexcept { return m_impl.m_end; }
+      const_iterator         end()    const noexcept { return m_impl.m_end; }
+      reverse_iterator       rbegin()       noexcept { return reverse_iterator(end()); }
+      const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+      reverse_iterator       rend()         noexcept { return reverse_iterator(begin()); }
+      const_reverse_iterator rend()   const noexcept { return const_reverse_iterator(begin()); }
+
+    public:
+      bool
+      empty() const noexcept { return m_impl.m_begin == m_impl.m_end; }
+
+      size_type
+      size() const noexcept { return static_cast<size_type>(m_impl.m_end - m_impl.m_begin); }
+
+      size_type
+      max_size() const noexcept
+      {
+        return std::min<size_type>(alloc_traits::max_size(__alloc()),
+                                   std::numeric_limits<difference_type>::max() / sizeof(T));
+      }
+
+      /// @brief Get the number of elements the current storage holds, at least N.
+      size_type
+      capacity() const noexcept { return static_cast<size_type>(m_impl.m_cap - m_impl.m_begin); }
+
+      /// @brief Make room for __n elements, growing by the growth policy.
+      /// @details The capacity becomes at least __n, and at least the current capacity
+      /// times the growth factor, so that reserving before each append stays amortized O(1).
+      /// @throws std::length_error if __n exceeds `max_size()`.
+      void
+      reserve(size_type __n)
+      {
+        if ( __n > capacity() ) __reallocate(__recommend(__n, "ft::small_vector::reserve"));
+      }
+
+      /// @brief Make room for exactly __n elements, if the capacity is less than that.
+      /// @throws std::length_error if __n exceeds `max_size()`.
+      void
+      reserve_exact(size_type __n)
+      {
+        if ( __n <= capacity() ) return;
+        if ( __n > max_size() ) throw std::length_error("ft::small_vector::reserve_exact");
+        __reallocate(__n);
+      }
+
+      /// @brief Release the unused capacity.
+      /// @details Unlike `std::vector::shrink_to_fit`, this is binding: afterwards the
+      /// elements are either inline or on a heap buffer of exactly `size()` elements.
+      void
+      shrink_to_fit()
+      {
+        if ( !__is_inline() && capacity() > size() ) __reallocate(size());
+      }
+
+    public:
+      /// @brief Destroy every element. The capacity is kept.
+      void
+      clear() noexcept { __erase_at_end(m_impl.m_begin); }
+
+      /// @brief Insert a copy of __x before __pos.
+      /// @return An iterator to the inserted element.
+      iterator
+      insert(const_iterator __pos, const value_type& __x) { return emplace(__pos, __x); }
+
+      iterator
+      insert(const_iterator __pos, value_type&& __x) { return emplace(__pos, std::move(__x)); }
+
+      /// @brief Insert __n copies of __x before __pos.
+      /// @return An iterator to the first inserted element, or __pos if __n is 0.
+      iterator
+      insert(const_iterator __pos, size_type __n, const value_type& __x)
+      {
+        const size_type __idx = static_cast<size_type>(__pos - m_impl.m_begin);
+
+        if ( __n != 0 && __points_into(std::addressof(__x)) ) {
+          const value_type __copy(__x);
+
+          __insert_with(__idx, __n, [this, __n, &__copy](pointer __d) { __construct_fill_n(__d, __n, __copy); });
+        } else {
+          __insert_with(__idx, __n, [this, __n, &__x](pointer __d) { __construct_fill_n(__d, __n, __x); });
+        }
+        return m_impl.m_begin + __idx;
+      }
+
+      /// @brief Insert the elements of a range before __pos. The range must not be in this vector.
+      /// @return An iterator to the first inserted element, or __pos if the range is empty.
+      template <typename _InputIterator, typename = __iterator_t<_InputIterator>>
+      iterator
+      insert(const_iterator __pos, _InputIterator __first, _InputIterator __last)
+      {
+        const size_type __idx = static_cast<size_type>(__pos - m_impl.m_begin);
+
+        __insert_range(__idx, __first, __last, __forward_range_t<_InputIterator>());
+        return m_impl.m_begin + __idx;
+      }
+
+      iterator
+      insert(const_iterator __pos, std::initializer_list<value_type> __il) { return insert(__pos, __il.begin(), __il.end()); }
+
+      /// @brief Construct an element in place before __pos.
+      /// @param __args The arguments forwarded to the constructor of `value_type`; they may
+      /// refer to elements of this vector.
+      /// @return An iterator to the inserted element.
+      template <typename... _Args>
+      iterator
+      emplace(const_iterator __pos, _Args&&... __args)
+      {
+        const size_type __idx = static_cast<size_type>(__pos - m_impl.m_begin);
+
+        if ( m_impl.m_end == m_impl.m_cap ) {
+          __realloc_insert(__idx, 1, [&](pointer __d) { __construct(__d, std::forward<_Args>(__args)...); });
+        } else {
+          // Constructing at the end first keeps arguments that refer into the vector valid.
+          __construct(m_impl.m_end, std::forward<_Args>(__args)...);
+          ++m_impl.m_end;
+          if ( m_impl.m_begin + __idx != m_impl.m_end - 1 ) __rotate_last_to(m_impl.m_begin + __idx, __relocatable());
+        }
+        return m_impl.m_begin + __idx;
+      }
+
+      /// @brief Erase the element at __pos.
+      /// @return An iterator to the element after the erased one.
+      iterator
+      erase(const_iterator __pos) { return erase(__pos, __pos + 1); }
+
+      /// @brief Erase the elements of [__first, __last).
+      /// @return An iterator to the element after the erased ones.
+      iterator
+      erase(const_iterator __first, const_iterator __last)
+      {
+        pointer __f = m_impl.m_begin + ( __first - m_impl.m_begin );
+        pointer __l = m_impl.m_begin + ( __last - m_impl.m_begin );
+
+        if ( __f != __l ) __erase_range(__f, __l, __relocatable());
+        return __f;
+      }
+
+      void
+      push_back(const value_type& __x) { emplace_back(__x); }
+
+      void
+      push_back(value_type&& __x) { emplace_back(std::move(__x)); }
+
+      /// @brief Construct an element in place at the end.
+      /// @return A reference to the new element.
+      template <typename... _Args>
+      reference
+      emplace_back(_Args&&... __args)
+      {
+        if ( m_impl.m_end != m_impl.m_cap ) {
+          __construct(m_impl.m_end, std::forward<_Args>(__args)...);
+          ++m_impl.m_end;
+        } else {
+          __realloc_insert(size(), 1, [&](pointer __d) { __construct(__d, std::forward<_Args>(__args)...); });
+        }
+        return back();
+      }
+
+      void
+      pop_back() noexcept { __erase_at_end(m_impl.m_end - 1); }
+
+      /// @brief Resize to __n elements, value-initializing the new ones.
+      void
+      resize(size_type __n)
+      {
+        if ( __n <= size() ) {
+          __erase_at_end(m_impl.m_begin + __n);
+        } else {
+          const size_type __add = __n - size();
+
+          __insert_with(size(), __add, [this, __add](pointer __d) { __construct_value_n(__d, __add); });
+        }
+      }
+
+      /// @brief Resize to __n elements, copying __x into the new ones.
+      void
+      resize(size_type __n, const value_type& __x)
+      {
+        if ( __n <= size() )
+          __erase_at_end(m_impl.m_begin + __n);
+        else
+          insert(end(), __n - size(), __x);
+      }
+
+      /// @brief Resize to __n elements, default-initializing the new ones.
+      /// @details Elements of a trivially default constructible type are left uninitialized,
+      /// so a buffer sized up front and then filled in place is written only once. Reading
+      /// them before writing them is undefined behavior.
+      void
+      resize_for_overwrite(size_type __n)
+      {
+        if ( __n <= size() ) {
+          __erase_at_end(m_impl.m_begin + __n);
+        } else {
+          const size_type __add = __n - size();
+
+          __insert_with(size(), __add, [this, __add](pointer __d) {
+            __construct_default_n(__d, __add, std::is_trivially_default_constructible<T>());
+          });
+        }
+      }
+
+      /// @brief Swap the contents of two vectors.
+      /// @details Heap buffers are exchanged in O(1); inline elements are moved.
+      void
+      swap(small_vector& __x) noexcept(N == 0 || ( std::is_nothrow_move_constructible<T>::value &&
+                                                   alloc_traits::is_always_equal::value ))
+      {
+        if ( this == &__x ) return;
+        if ( !__is_inline() && !__x.__is_inline() ) {
+          std::swap(m_impl.m_begin, __x.m_impl.m_begin);
+          std::swap(m_impl.m_end, __x.m_impl.m_end);
+          std::swap(m_impl.m_cap, __x.m_impl.m_cap);
+          __alloc_on_swap(__x, typename alloc_traits::propagate_on_container_swap());
+        } else {
+          small_vector __tmp(std::move(__x));
+
+          __x   = std::move(*this);
+          *this = std::move(__tmp);
+        }
+      }
+
+    private:
+      Alloc&
+      __alloc() noexcept { return m_impl; }
+
+      const Alloc&
+      __alloc() const noexcept { return m_impl; }
+
+      pointer
+      __inline_data() noexcept { return m_impl.__inline_data(); }
+
+      /// @brief Whether the elements are in the inline buffer.
+      bool
+      __is_inline() const noexcept { return N != 0 && m_impl.m_begin == m_impl.__inline_data(); }
+
+      /// @brief Whether __p points to an element of this vector.
+      bool
+      __points_into(const_pointer __p) const noexcept
+      {
+        const std::less<const_pointer> __less;
+
+        return !__less(__p, m_impl.m_begin) && __less(__p, m_impl.m_end);
+      }
+
+      /// @brief The capacity to grow to for __n elements, as chosen by the growth policy.
+      /// @throws std::length_error with __what if __n exceeds `max_size()`.
+      size_type
+      __recommend(size_type __n, const char* __what) const
+      {
+        const size_type __max = max_size();
+
+        if ( __n > __max ) throw std::length_error(__what);
+        return Growth::next_capacity(capacity(), __n, __max);
+      }
+
+      pointer
+      __allocate(size_type __n) { return alloc_traits::allocate(__alloc(), __n); }
+
+      /// @brief Free the heap storage, if any. The elements must be destroyed already.
+      void
+      __deallocate_storage() noexcept
+      {
+        if ( !__is_inline() && m_impl.m_begin != nullptr )
+          alloc_traits::deallocate(__alloc(), m_impl.m_begin, capacity());
+      }
+
+      template <typename... _Args>
+      void
+      __construct(pointer __p, _Args&&... __args)
+      {
+        alloc_traits::construct(__alloc(), __p, std::forward<_Args>(__args)...);
+      }
+
+      void
+      __destroy(pointer __first, pointer __last) noexcept
+      {
+        __destroy(__first, __last, std::is_trivially_destructible<T>());
+      }
+
+      void
+      __destroy(pointer __first, pointer __last, std::false_type) noexcept
+      {
+        for ( ; __first != __last; ++__first ) alloc_traits::destroy(__alloc(), __first);
+      }
+
+      void
+      __destroy(pointer, pointer, std::true_type) noexcept { }
+
+      /// @brief Destroy the elements from __pos to the end.
+      void
+      __erase_at_end(pointer __pos) noexcept
+      {
+        __destroy(__pos, m_impl.m_end);
+        m_impl.m_end = __pos;
+      }
+
+    private:
+      // Every __construct_* helper constructs all of its elements or, if one throws,
+      // destroys the ones it constructed before rethrowing.
+
+      template <typename _ForwardIterator>
+      void
+      __construct_range(pointer __d, _ForwardIterator __first, size_type __n)
+      {
+        pointer __cur = __d;
+
+        try {
+          for ( ; __n != 0; --__n, ++__first, ++__cur ) __construct(__cur, *__first);
+        } catch ( ... ) {
+          __destroy(__d, __cur);
+          throw;
+        }
+      }
+
+      void
+      __construct_fill_n(pointer __d, size_type __n, const value_type& __x)
+      {
+        pointer __cur = __d;
+
+        try {
+          for ( ; __n != 0; --__n, ++__cur ) __construct(__cur, __x);
+        } catch ( ... ) {
+          __destroy(__d, __cur);
+          throw;
+        }
+      }
+
+      void
+      __construct_value_n(pointer __d, size_type __n)
+      {
+        pointer __cur = __d;
+
+        try {
+          for ( ; __n != 0; --__n, ++__cur ) __construct(__cur);
+        } catch ( ... ) {
+          __destroy(__d, __cur);
+          throw;
+        }
+      }
+
+      /// @brief Default-initialize trivial elements: nothing to do.
+      void
+      __construct_default_n(pointer __d, size_type __n, std::true_type) noexcept
+      {
+        for ( ; __n != 0; --__n, ++__d ) ::new (static_cast<void*>(__d)) T;
+      }
+
+      void
+      __construct_default_n(pointer __d, size_type __n, std::false_type) { __construct_value_n(__d, __n); }
+
+      /// @brief Move-construct [__first, __last) into __d, copying instead if moving may throw
+      /// and copying is possible, so that the source survives a failure intact.
+      pointer
+      __uninitialized_move_if_noexcept(pointer __first, pointer __last, pointer __d)
+      {
+        pointer __cur = __d;
+
+        try {
+          for ( ; __first != __last; ++__first, ++__cur ) __construct(__cur, std::move_if_noexcept(*__first));
+        } catch ( ... ) {
+          __destroy(__d, __cur);
+          throw;
+        }
+        return __cur;
+      }
+
+    private:
+      /// @brief Move the elements to __new, leaving a gap of __gap slots after the first __idx,
+      /// and end the old ones.
+      /// @details Relocatable elements are copied as bytes. Others are moved if that cannot
+      /// throw, copied otherwise, and only destroyed once all of them made it, so a failure
+      /// leaves the vector as it was.
+      void
+      __relocate_to(pointer __new, size_type __idx, size_type __gap, std::true_type) noexcept
+      {
+        const size_type __after = size() - __idx;
+
+        if ( __idx != 0 )
+          std::memcpy(static_cast<void*>(__new), static_cast<const void*>(m_impl.m_begin), __idx * sizeof(T));
+        if ( __after != 0 )
+          std::memcpy(static_cast<void*>(__new + __idx + __gap), static_cast<const void*>(m_impl.m_begin + __idx),
+                      __after * sizeof(T));
+      }
+
+      void
+      __relocate_to(pointer __new, size_type __idx, size_type __gap, std::false_type)
+      {
+        pointer __mid = __uninitialized_move_if_noexcept(m_impl.m_begin, m_impl.m_begin + __idx, __new);
+
+        try {
+          __uninitialized_move_if_noexcept(m_impl.m_begin + __idx, m_impl.m_end, __mid + __gap);
+        } catch ( ... ) {
+          __destroy(__new, __mid);
+          throw;
+        }
+        __destroy(m_impl.m_begin, m_impl.m_end);
+      }
+
+      /// @brief Move the elements to storage for __n of them: the inline buffer if __n <= N,
+      /// a heap buffer of exactly __n elements otherwise.
+      void
+      __reallocate(size_type __n)
+      {
+        const bool      __fits_inline = __n <= N;
+        const pointer   __new    = __fits_inline ? __inline_data() : __allocate(__n);
+        const size_type __size   = size();
+
+        try {
+          __relocate_to(__new, __size, 0, __relocatable());
+        } catch ( ... ) {
+          if ( !__fits_inline ) alloc_traits::deallocate(__alloc(), __new, __n);
+          throw;
+        }
+        __deallocate_storage();
+        m_impl.m_begin = __new;
+        m_impl.m_end   = __new + __size;
+        m_impl.m_cap   = __new + ( __fits_inline ? N : __n );
+      }
+
+      /// @brief Insert __n elements built by __fill at __idx, into a new, larger buffer.
+      /// @details __fill runs before anything moves, so it may read the current elements.
+      template <typename _Fill>
+      void
+      __realloc_insert(size_type __idx, size_type __n, _Fill __fill)
+      {
+        const size_type __size = size();
+        const size_type __cap  = __recommend(__size + __n, "ft::small_vector::insert");
+        const pointer   __new  = __allocate(__cap);
+
+        try {
+          __fill(__new + __idx);
+        } catch ( ... ) {
+          alloc_traits::deallocate(__alloc(), __new, __cap);
+          throw;
+        }
+        try {
+          __relocate_to(__new, __idx, __n, __relocatable());
+        } catch ( ... ) {
+          __destroy(__new + __idx, __new + __idx + __n);
+          alloc_traits::deallocate(__alloc(), __new, __cap);
+          throw;
+        }
+        __deallocate_storage();
+        m_impl.m_begin = __new;
+        m_impl.m_end   = __new + __size + __n;
+        m_impl.m_cap   = __new + __cap;
+      }
+
+      /// @brief Insert __n elements built by __fill at __idx.
+      /// @details __fill must not read the elements at or after __idx.
+      template <typename _Fill>
+      void
+      __insert_with(size_type __idx, size_type __n, _Fill __fill)
+      {
+        if ( __n == 0 ) return;
+        if ( static_cast<size_type>(m_impl.m_cap - m_impl.m_end) < __n ) {
+          __realloc_insert(__idx, __n, __fill);
+        } else if ( __idx == size() ) {
+          __fill(m_impl.m_end);
+          m_impl.m_end += __n;
+        } else {
+          __insert_in_place(m_impl.m_begin + __idx, __n, __fill, __relocatable());
+        }
+      }
+
+      /// @brief Open a gap of __n slots at __p with `memmove` and fill it, closing it again on failure.
+      template <typename _Fill>
+      void
+      __insert_in_place(pointer __p, size_type __n, _Fill& __fill, std::true_type)
+      {
+        const size_type __bytes = static_cast<size_type>(m_impl.m_end - __p) * sizeof(T);
+
+        std::memmove(static_cast<void*>(__p + __n), static_cast<const void*>(__p), __bytes);
+        try {
+          __fill(__p);
+        } catch ( ... ) {
+          std::memmove(static_cast<void*>(__p), static_cast<const void*>(__p + __n), __bytes);
+          throw;
+        }
+        m_impl.m_end += __n;
+      }
+
+      /// @brief Append the new elements, then rotate them into place.
+      template <typename _Fill>
+      void
+      __insert_in_place(pointer __p, size_type __n, _Fill& __fill, std::false_type)
+      {
+        const pointer __old_end = m_impl.m_end;
+
+        __fill(__old_end);
+        m_impl.m_end += __n;
+        std::rotate(__p, __old_end, m_impl.m_end);
+      }
+
+      /// @brief Move the last element to __p, shifting the ones from __p up by one.
+      void
+      __rotate_last_to(pointer __p, std::true_type) noexcept
+      {
+        alignas(T) unsigned char __buf[sizeof(T)];
+        const pointer            __last = m_impl.m_end - 1;
+
+        std::memcpy(__buf, static_cast<const void*>(__last), sizeof(T));
+        std::memmove(static_cast<void*>(__p + 1), static_cast<const void*>(__p), static_cast<size_type>(__last - __p) * sizeof(T));
+        std::memcpy(static_cast<void*>(__p), __buf, sizeof(T));
+      }
+
+      void
+      __rotate_last_to(pointer __p, std::false_type) { std::rotate(__p, m_impl.m_end - 1, m_impl.m_end); }
+
+      void
+      __erase_range(pointer __first, pointer __last, std::true_type) noexcept
+      {
+        __destroy(__first, __last);
+        std::memmove(static_cast<void*>(__first), static_cast<const void*>(__last),
+                     static_cast<size_type>(m_impl.m_end - __last) * sizeof(T));
+        m_impl.m_end -= __last - __first;
+      }
+
+      void
+      __erase_range(pointer __first, pointer __last, std::false_type)
+      {
+        pointer __d = __first;
+
+        for ( pointer __s = __last; __s != m_impl.m_end; ++__s, ++__d ) *__d = std::move(*__s);
+        __erase_at_end(__d);
+      }
+
+      template <typename _ForwardIterator>
+      void
+      __insert_range(size_type __idx, _ForwardIterator __first, _ForwardIterator __last, std::true_type)
+      {
+        const size_type __n = __range_length(__first, __last, __random_access_range_t<_ForwardIterator>());
+
+        __insert_with(__idx, __n, [this, __first, __n](pointer __d) { __construct_range(__d, __first, __n); });
+      }
+
+      /// @brief Append a single-pass range, then rotate it into place.
+      template <typename _InputIterator>
+      void
+      __insert_range(size_type __idx, _InputIterator __first, _InputIterator __last, std::false_type)
+      {
+        const size_type __old_size = size();
+
+        try {
+          for ( ; __first != __last; ++__first ) emplace_back(*__first);
+        } catch ( ... ) {
+          __erase_at_end(m_impl.m_begin + __old_size);
+          throw;
+        }
+        std::rotate(m_impl.m_begin + __idx, m_impl.m_begin + __old_size, m_impl.m_end);
+      }
+
+      template <typename _Iter>
+      static size_type
+      __range_length(_Iter __first, _Iter __last, std::true_type) { return static_cast<size_type>(__last - __first); }
+
+      template <typename _Iter>
+      static size_type
+      __range_length(_Iter __first, _Iter __last, std::false_type)
+      {
+        size_type __n = 0;
+
+        for ( ; __first != __last; ++__first ) ++__n;
+        return __n;
+      }
+
+    private:
+      /// @brief Get storage for __n elements and build them with __fill, in a constructor.
+      template <typename _Fill>
+      void
+      __init_with(size_type __n, _Fill __fill)
+      {
+        if ( __n > N ) {
+          if ( __n > max_size() ) throw std::length_error("ft::small_vector");
+          m_impl.m_begin = __allocate(__n);
+          m_impl.m_end   = m_impl.m_begin;
+          m_impl.m_cap   = m_impl.m_begin + __n;
+        }
+        try {
+          __fill(m_impl.m_begin);
+        } catch ( ... ) {
+          __deallocate_storage();
+          throw;
+        }
+        m_impl.m_end = m_impl.m_begin + __n;
+      }
+
+      template <typename _ForwardIterator>
+      void
+      __init_range(_ForwardIterator __first, _ForwardIterator __last, std::true_type)
+      {
+        const size_type __n = __range_length(__first, __last, __random_access_range_t<_ForwardIterator>());
+
+        __init_with(__n, [this, __first, __n](pointer __d) { __construct_range(__d, __first, __n); });
+      }
+
+      template <typename _InputIterator>
+      void
+      __init_range(_InputIterator __first, _InputIterator __last, std::false_type)
+      {
+        try {
+          for ( ; __first != __last; ++__first ) emplace_back(*__first);
+        } catch ( ... ) {
+          clear();
+          __deallocate_storage();
+          throw;
+        }
+      }
+
+      /// @brief Replace the elements with __n elements built by __fill in exactly sized new storage.
+      template <typename _Fill>
+      void
+      __replace_storage(size_type __n, _Fill __fill)
+      {
+        if ( __n > max_size() ) throw std::length_error("ft::small_vector::assign");
+
+        const pointer __new = __allocate(__n);
+
+        try {
+          __fill(__new);
+        } catch ( ... ) {
+          alloc_traits::deallocate(__alloc(), __new, __n);
+          throw;
+        }
+        clear();
+        __deallocate_storage();
+        m_impl.m_begin = __new;
+        m_impl.m_end   = __new + __n;
+        m_impl.m_cap   = __new + __n;
+      }
+
+      template <typename _ForwardIterator>
+      void
+      __assign_range(_ForwardIterator __first, _ForwardIterator __last, std::true_type)
+      {
+        const size_type __n = __range_length(__first, __last, __random_access_range_t<_ForwardIterator>());
+
+        if ( __n > capacity() ) {
+          __replace_storage(__n, [this, __first, __n](pointer __d) { __construct_range(__d, __first, __n); });
+          return;
+        }
+
+        pointer __cur = m_impl.m_begin;
+
+        for ( ; __cur != m_impl.m_end && __first != __last; ++__cur, ++__first ) *__cur = *__first;
+        if ( __first == __last ) {
+          __erase_at_end(__cur);
+        } else {
+          const size_type __rest = __n - size();
+
+          __construct_range(m_impl.m_end, __first, __rest);
+          m_impl.m_end += __rest;
+        }
+      }
+
+      template <typename _InputIterator>
+      void
+      __assign_range(_InputIterator __first, _InputIterator __last, std::false_type)
+      {
+        clear();
+        for ( ; __first != __last; ++__first ) emplace_back(*__first);
+      }
+
+      /// @brief Take the elements of __x, into an empty vector with the inline buffer.
+      /// @details A heap buffer changes hands; inline elements are moved, or relocated as bytes.
+      void
+      __take_storage(small_vector& __x)
+      {
+        if ( !__x.__is_inline() ) {
+          if ( __x.m_impl.m_begin == nullptr ) return;
+          m_impl.m_begin = __x.m_impl.m_begin;
+          m_impl.m_end   = __x.m_impl.m_end;
+          m_impl.m_cap   = __x.m_impl.m_cap;
+          __x.m_impl.__reset();
+        } else {
+          __take_inline(__x, __relocatable());
+        }
+      }
+
+      void
+      __take_inline(small_vector& __x, std::true_type) noexcept
+      {
+        const size_type __n = __x.size();
+
+        if ( __n != 0 ) std::memcpy(static_cast<void*>(m_impl.m_begin), static_cast<const void*>(__x.m_impl.m_begin), __n * sizeof(T));
+        m_impl.m_end     = m_impl.m_begin + __n;
+        __x.m_impl.m_end = __x.m_impl.m_begin;
+      }
+
+      void
+      __take_inline(small_vector& __x, std::false_type)
+      {
+        pointer __cur = m_impl.m_begin;
+
+        try {
+          for ( pointer __s = __x.m_impl.m_begin; __s != __x.m_impl.m_end; ++__s, ++__cur ) __construct(__cur, std::move(*__s));
+        } catch ( ... ) {
+          __destroy(m_impl.m_begin, __cur);
+          throw;
+        }
+        m_impl.m_end = __cur;
+        __x.clear();
+      }
+
+      void
+      __move_assign(small_vector& __x, std::true_type)
+      {
+        clear();
+        __deallocate_storage();
+        m_impl.__reset();
+        __alloc_on_move(__x, typename alloc_traits::propagate_on_container_move_assignment());
+        __take_storage(__x);
+      }
+
+      void
+      __move_assign(small_vector& __x, std::false_type)
+      {
+        if ( __alloc() == __x.__alloc() ) {
+          __move_assign(__x, std::true_type());
+        } else {
+          assign(std::make_move_iterator(__x.begin()), std::make_move_iterator(__x.end()));
+          __x.clear();
+        }
+      }
+
+      /// @brief Adopt the allocator of __x, first releasing storage the new one cannot free.
+      void
+      __alloc_on_copy(const small_vector& __x, std::true_type)
+      {
+        if ( __alloc() != __x.__alloc() ) {
+          clear();
+          __deallocate_storage();
+          m_impl.__reset();
+        }
+        __alloc() = __x.__alloc();
+      }
+
+      void
+      __alloc_on_copy(const small_vector&, std::false_type) { }
+
+      void
+      __alloc_on_move(small_vector& __x, std::true_type) { __alloc() = std::move(__x.__alloc()); }
+
+      void
+      __alloc_on_move(small_vector&, std::false_type) { }
+
+      void
+      __alloc_on_swap(small_vector& __x, std::true_type) { std::swap(__alloc(), __x.__alloc()); }
+
+      void
+      __alloc_on_swap(small_vector&, std::false_type) { }
+  };
+
+  template <typename T, std::size_t N, typename Alloc, typename Growth>
+  inline bool
+  operator==(const small_vector<T, N, Alloc, Growth>& __x, const small_vector<T, N, Alloc, Growth>& __y)
+  {
+    return __x.size() == __y.size() && ft::equal(__x.begin(), __x.end(), __y.begin());
+  }
+
+  template <typename T, std::size_t N, typename Alloc, typename Growth>
+  inline bool
+  operator!=(const small_vector<T, N, Alloc, Growth>& __x, const small_vector<T, N, Alloc, Growth>& __y)
+  {
+    return !(__x == __y);
+  }
+
+  template <typename T, std::size_t N, typename Alloc, typename Growth>
+  inline bool
+  operator<(const small_vector<T, N, Alloc, Growth>& __x, const small_vector<T, N, Alloc, Growth>& __y)
+  {
+    return ft::lexicographical_compare(__x.begin(), __x.end(), __y.begin(), __y.end());
+  }
+
+  template <typename T, std::size_t N, typename Alloc, typename Growth>
+  inline bool
+  operator>(const small_vector<T, N, Alloc, Growth>& __x, const small_vector<T, N, Alloc, Growth>& __y)
+  {
+    return __y < __x;
+  }
+
+  template <typename T, std::size_t N, typename Alloc, typename Growth>
+  inline bool
+  operator<=(const small_vector<T, N, Alloc, Growth>& __x, const small_vector<T, N, Alloc, Growth>& __y)
+  {
+    return !(__y < __x);
+  }
+
+  template <typename T, std::size_t N, typename Alloc, typename Growth>
+  inline bool
+  operator>=(const small_vector<T, N, Alloc, Growth>& __x, const small_vector<T, N, Alloc, Growth>& __y)
+  {
+    return !(__x < __y);
+  }
+
+  /// @brief Swap the contents of two vectors.
+  template <typename T, std::size_t N, typename Alloc, typename Growth>
+  inline void
+  swap(small_vector<T, N, Alloc, Growth>& __x, small_vector<T, N, Alloc, Growth>& __y) noexcept(noexcept(__x.swap(__y)))
+  {
+    __x.swap(__y);
+  }
+
+  namespace pmr {
+
+    /// @brief `small_vector` drawing its heap storage from a `memory_resource`.
+    template <typename T, std::size_t N, typename Growth = vector_growth<>>
+    using small_vector = ft::small_vector<T, N, polymorphic_allocator<T>, Growth>;
+
+  } // namespace pmr
+
+} // namespace ft
+
+#endif // __FT_SMALL_VECTOR__
@@ -0,0 +1,33 @@
+#ifndef   __FT_VECTOR__
+# define  __FT_VECTOR__
+
+# include <memory> // For std::allocator
+
+# include "../memory/memory_resource.h" // For polymorphic_allocator
+# include "small_vector.h"              // For small_vector
+# include "vector_policy.h"             // For vector_growth
+
+namespace ft {
+
+  /// @brief Sequence container storing its elements in one contiguous heap buffer.
+  /// @details A `small_vector` without an inline buffer, so it shares its interface and its
+  /// capacity controls: `reserve_exact`, a binding `shrink_to_fit`, `resize_for_overwrite`,
+  /// `memcpy` reallocation of relocatable types and a configurable growth factor. The
+  /// iterators are plain pointers, so `ft::iterator_traits` classifies them as random access.
+  template <
+    typename T,
+    typename Alloc  = std::allocator<T>,
+    typename Growth = vector_growth<>
+  > using vector = small_vector<T, 0, Alloc, Growth>;
+
+  namespace pmr {
+
+    /// @brief `vector` drawing its storage from a `memory_resource`.
+    template <typename T, typename Growth = vector_growth<>>
+    using vector = ft::vector<T, polymorphic_allocator<T>, Growth>;
+
+  } // namespace pmr
+
+} // namespace ft
+
+#endif // __FT_VECTOR__
@@ -0,0 +1,52 @@
+#ifndef   __FT_VECTOR_POLICY__
+# define  __FT_VECTOR_POLICY__
+
+# include <cstddef>     // For std::size_t
+# include <type_traits> // For std::is_trivially_copyable, std::integral_constant
+
+namespace ft {
+
+  /// @brief Whether an object of type _Tp can be moved to new storage by copying its bytes.
+  /// @details Relocating an object means moving it to new storage and ending the old one.
+  /// For a relocatable type that is the same as `memcpy` followed by forgetting the source,
+  /// without running any constructor or destructor, so the vectors reallocate, insert and
+  /// erase such elements with `memcpy` and `memmove`.
+  ///
+  /// Every trivially copyable type qualifies. Many other types do too, e.g. one that owns a
+  /// heap buffer through a pointer and never points into itself, and may opt in with
+  /// @code
+  /// template <> struct ft::is_trivially_relocatable<my_buffer> : std::true_type { };
+  /// @endcode
+  /// Types that store their own address, or register it somewhere (like the node-based
+  /// `std::list` of some standard libraries), must not.
+  template <typename _Tp>
+  struct is_trivially_relocatable : std::is_trivially_copyable<_Tp> { };
+
+  /// @brief The growth policy of the vectors: multiply the capacity by _Num / _Den.
+  /// @details A larger factor reallocates less often, a smaller one wastes less memory and
+  /// lets a freed buffer be reused sooner. The default of 2 matches most standard libraries;
+  /// `vector_growth<3, 2>` is the usual alternative.
+  ///
+  /// Any type with the same static `next_capacity` can be used as a policy.
+  template <std::size_t _Num = 2, std::size_t _Den = 1>
+  struct vector_growth
+  {
+    static_assert(_Den != 0 && _Num > _Den, "ft::vector_growth: the factor must be greater than 1");
+
+    /// @brief Choose the capacity to grow to.
+    /// @param __capacity The current capacity.
+    /// @param __required The least capacity needed, greater than __capacity.
+    /// @param __max The largest capacity the allocator can provide, at least __required.
+    /// @return A capacity in [__required, __max].
+    static constexpr std::size_t
+    next_capacity(std::size_t __capacity, std::size_t __required, std::size_t __max) noexcept
+    {
+      const std::size_t __grown = __capacity > __max / _Num ? __max : __capacity * _Num / _Den;
+
+      return __grown < __required ? __required : __grown;
+    }
+  };
+
+} // namespace ft
+
+#endif // __FT_VECTOR_POLICY__